@@ -0,0 +1,329 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  Crc32c.cpp
+
+   File Description  :  Implementation of the CRC-32C (Castagnoli) functions.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/Crc32c.hpp>
+#include <MFStore/MFStoreParallel.hpp>
+
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+# define MFStore_CRC32C_SSE42 1
+# include <nmmintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+# define MFStore_CRC32C_SSE42 1
+# include <intrin.h>
+# include <nmmintrin.h>
+#endif // #if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+// The bit-reflected Castagnoli polynomial.
+const uint32_t Crc32cPoly = 0x82F63B78;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct Crc32cTables
+{
+	Crc32cTables()
+	{
+		for (uint32_t idx_1 = 0; idx_1 < 256; ++idx_1) {
+			uint32_t crc_value = idx_1;
+			for (int idx_2 = 0; idx_2 < 8; ++idx_2)
+				crc_value = (crc_value & 1) ?
+					((crc_value >> 1) ^ Crc32cPoly) : (crc_value >> 1);
+			slice_[0][idx_1] = crc_value;
+		}
+
+		for (uint32_t idx_1 = 0; idx_1 < 256; ++idx_1) {
+			for (int idx_2 = 1; idx_2 < 8; ++idx_2)
+				slice_[idx_2][idx_1] = (slice_[idx_2 - 1][idx_1] >> 8) ^
+					slice_[0][slice_[idx_2 - 1][idx_1] & 0xFF];
+		}
+	}
+
+	uint32_t slice_[8][256];
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const Crc32cTables &GetCrc32cTables()
+{
+	static const Crc32cTables crc_tables;
+
+	return(crc_tables);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t Crc32cSoftware(const unsigned char *data_ptr,
+	std::size_t data_length, uint32_t crc_value)
+{
+	const Crc32cTables &tables = GetCrc32cTables();
+
+	while (data_length && (reinterpret_cast<uintptr_t>(data_ptr) & 7)) {
+		crc_value = (crc_value >> 8) ^
+			tables.slice_[0][(crc_value ^ *data_ptr++) & 0xFF];
+		--data_length;
+	}
+
+	while (data_length >= 8) {
+		uint32_t word_lo;
+		uint32_t word_hi;
+		::memcpy(&word_lo, data_ptr,     sizeof(word_lo));
+		::memcpy(&word_hi, data_ptr + 4, sizeof(word_hi));
+		// The slicing below presumes a little-endian host.
+		word_lo  ^= crc_value;
+		crc_value =
+			tables.slice_[7][ word_lo        & 0xFF] ^
+			tables.slice_[6][(word_lo >>  8) & 0xFF] ^
+			tables.slice_[5][(word_lo >> 16) & 0xFF] ^
+			tables.slice_[4][ word_lo >> 24        ] ^
+			tables.slice_[3][ word_hi        & 0xFF] ^
+			tables.slice_[2][(word_hi >>  8) & 0xFF] ^
+			tables.slice_[1][(word_hi >> 16) & 0xFF] ^
+			tables.slice_[0][ word_hi >> 24        ];
+		data_ptr    += 8;
+		data_length -= 8;
+	}
+
+	while (data_length--)
+		crc_value = (crc_value >> 8) ^
+			tables.slice_[0][(crc_value ^ *data_ptr++) & 0xFF];
+
+	return(crc_value);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef MFStore_CRC32C_SSE42
+
+// ////////////////////////////////////////////////////////////////////////////
+#ifndef _MSC_VER
+__attribute__((target("sse4.2")))
+#endif // #ifndef _MSC_VER
+uint32_t Crc32cHardware(const unsigned char *data_ptr,
+	std::size_t data_length, uint32_t crc_value)
+{
+	while (data_length && (reinterpret_cast<uintptr_t>(data_ptr) & 7)) {
+		crc_value = _mm_crc32_u8(crc_value, *data_ptr++);
+		--data_length;
+	}
+
+	uint64_t crc_value_64 = crc_value;
+
+	while (data_length >= 8) {
+		uint64_t this_word;
+		::memcpy(&this_word, data_ptr, sizeof(this_word));
+		crc_value_64  = _mm_crc32_u64(crc_value_64, this_word);
+		data_ptr     += 8;
+		data_length  -= 8;
+	}
+
+	crc_value = static_cast<uint32_t>(crc_value_64);
+
+	while (data_length--)
+		crc_value = _mm_crc32_u8(crc_value, *data_ptr++);
+
+	return(crc_value);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool DetectSse42()
+{
+#ifdef _MSC_VER
+	int cpu_info[4];
+
+	__cpuid(cpu_info, 1);
+
+	return((cpu_info[2] & (1 << 20)) != 0);
+#else
+	return(__builtin_cpu_supports("sse4.2") != 0);
+#endif // #ifdef _MSC_VER
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef MFStore_CRC32C_SSE42
+
+// ////////////////////////////////////////////////////////////////////////////
+using Crc32cFunc = uint32_t (*)(const unsigned char *, std::size_t, uint32_t);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+Crc32cFunc ResolveCrc32cFunc()
+{
+#ifdef MFStore_CRC32C_SSE42
+	if (DetectSse42())
+		return(Crc32cHardware);
+#endif // #ifdef MFStore_CRC32C_SSE42
+
+	return(Crc32cSoftware);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+Crc32cFunc GetCrc32cFunc()
+{
+	static const Crc32cFunc crc_func = ResolveCrc32cFunc();
+
+	return(crc_func);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Multiplication of a and b modulo the CRC polynomial, with polynomials
+	represented bit-reflected (x^0 is the most significant bit). This is the
+	same approach to CRC combination as that used by zlib.
+*/
+uint32_t MultModP(uint32_t poly_a, uint32_t poly_b)
+{
+	uint32_t bit_mask = uint32_t(1) << 31;
+	uint32_t product  = 0;
+
+	for ( ; ; ) {
+		if (poly_a & bit_mask) {
+			product ^= poly_b;
+			if (!(poly_a & (bit_mask - 1)))
+				break;
+		}
+		bit_mask >>= 1;
+		poly_b     = (poly_b & 1) ? ((poly_b >> 1) ^ Crc32cPoly) : (poly_b >> 1);
+	}
+
+	return(product);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct Crc32cX2NTable
+{
+	Crc32cX2NTable()
+	{
+		uint32_t poly_p = uint32_t(1) << 30;	// x^1
+
+		x2n_[0] = poly_p;
+
+		for (int idx = 1; idx < 32; ++idx)
+			x2n_[idx] = poly_p = MultModP(poly_p, poly_p);
+	}
+
+	uint32_t x2n_[32];
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Returns x^(n * 2^k) modulo the CRC polynomial.
+uint32_t X2NModP(uint64_t n_value, unsigned int k_value)
+{
+	static const Crc32cX2NTable x2n_table;
+
+	uint32_t poly_p = uint32_t(1) << 31;	// x^0
+
+	while (n_value) {
+		if (n_value & 1)
+			poly_p = MultModP(x2n_table.x2n_[k_value & 31], poly_p);
+		n_value >>= 1;
+		++k_value;
+	}
+
+	return(poly_p);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const uint64_t Crc32cParallelMinChunk = 1ULL << 20;
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t Crc32c(const void *data_ptr, std::size_t data_length,
+	uint32_t crc_value)
+{
+	return(~GetCrc32cFunc()(static_cast<const unsigned char *>(data_ptr),
+		data_length, ~crc_value));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t Crc32cCombine(uint32_t crc_value_1, uint32_t crc_value_2,
+	uint64_t data_length_2)
+{
+	return(MultModP(X2NModP(data_length_2, 3), crc_value_1) ^ crc_value_2);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t Crc32cParallel(const void *data_ptr, uint64_t data_length,
+	unsigned int thread_count)
+{
+	thread_count = ResolveThreadCount(thread_count, data_length,
+		Crc32cParallelMinChunk);
+
+	if (thread_count < 2)
+		return(Crc32c(data_ptr, static_cast<std::size_t>(data_length)));
+
+	std::vector<uint32_t> crc_list(thread_count, 0);
+	std::vector<uint64_t> length_list(thread_count, 0);
+
+	MFStoreParallelFor(data_length, thread_count,
+		[&](unsigned int chunk_index, uint64_t chunk_offset,
+			uint64_t chunk_length) {
+			crc_list[chunk_index]    = Crc32c(
+				static_cast<const char *>(data_ptr) + chunk_offset,
+				static_cast<std::size_t>(chunk_length));
+			length_list[chunk_index] = chunk_length;
+		}, Crc32cParallelMinChunk);
+
+	uint32_t crc_value = crc_list[0];
+
+	for (unsigned int chunk_index = 1; chunk_index < thread_count;
+		++chunk_index)
+		crc_value = Crc32cCombine(crc_value, crc_list[chunk_index],
+			length_list[chunk_index]);
+
+	return(crc_value);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool Crc32cIsHardware()
+{
+	return(GetCrc32cFunc() != Crc32cSoftware);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
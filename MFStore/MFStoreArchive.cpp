@@ -0,0 +1,1013 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreArchive.cpp
+
+   File Description  :  Implementation of compressed MFStore archives.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreArchive.hpp>
+#include <MFStore/CheckValues.hpp>
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/Crc32c.hpp>
+#include <MFStore/MFStoreParallel.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <zlib.h>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+/// The number of blocks compressed in parallel before being written.
+const uint64_t BlocksPerThreadBatch = 16;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t CalcBlockCount(MFStoreLen data_length, MFStoreLen block_size)
+{
+	return((data_length + (block_size - 1)) / block_size);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckBlockSize(MFStoreLen block_size)
+{
+	if ((block_size < MFStoreAllocGran) ||
+		(block_size > MFStoreArchiveMaxBlockSize))
+		throw std::invalid_argument("The archive block size (" +
+			std::to_string(block_size) + ") is outside of the permissible range "
+			"of " + std::to_string(MFStoreAllocGran) + " to " +
+			std::to_string(MFStoreArchiveMaxBlockSize) + ", inclusive.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct ArchiveBlockRef
+{
+	const char *data_ptr_;
+	MFStoreLen  data_length_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Leaves the stored form of the block in \e dst_data, which is the data
+	itself if compression doesn't make it smaller.
+*/
+void CompressBlock(const ArchiveBlockRef &block_ref, int compress_level,
+	std::vector<char> &dst_data)
+{
+	uLongf dst_length = ::compressBound(static_cast<uLong>(
+		block_ref.data_length_));
+
+	dst_data.resize(dst_length);
+
+	int z_code = ::compress2(reinterpret_cast<Bytef *>(dst_data.data()),
+		&dst_length, reinterpret_cast<const Bytef *>(block_ref.data_ptr_),
+		static_cast<uLong>(block_ref.data_length_), compress_level);
+
+	if (z_code != Z_OK)
+		throw std::runtime_error("Attempt to compress a block of " +
+			std::to_string(block_ref.data_length_) + " bytes failed with zlib "
+			"error code " + std::to_string(z_code) + ".");
+
+	if (dst_length < block_ref.data_length_)
+		dst_data.resize(dst_length);
+	else
+		dst_data.assign(block_ref.data_ptr_,
+			block_ref.data_ptr_ + block_ref.data_length_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void WriteArchiveData(std::ofstream &o_file, const void *data_ptr,
+	std::size_t data_length)
+{
+	if (!o_file.write(static_cast<const char *>(data_ptr),
+		static_cast<std::streamsize>(data_length)))
+		throw std::runtime_error("Attempt to write " +
+			std::to_string(data_length) + " bytes to the archive file failed.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void PadArchiveData(std::ofstream &o_file, uint64_t &data_offset,
+	uint64_t pad_gran)
+{
+	static const char pad_data[64] = { };
+
+	uint64_t pad_length = (pad_gran - (data_offset % pad_gran)) % pad_gran;
+
+	WriteArchiveData(o_file, pad_data, static_cast<std::size_t>(pad_length));
+
+	data_offset += pad_length;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void WriteArchive(const MFStoreControl &src_ctl,
+	const std::string &archive_file_name, MFStoreLen block_size,
+	int compress_level, unsigned int thread_count, MFStoreArchiveStats &stats)
+{
+	const MFStoreSectionList &section_list = src_ctl.GetSectionList();
+
+	if (section_list.empty())
+		throw std::invalid_argument("The MFStore has no section list.");
+
+	std::vector<MFStoreArchiveSection> directory(section_list.size());
+	std::vector<ArchiveBlockRef>       block_ref_list;
+
+	for (std::size_t section_index = 0; section_index < section_list.size();
+		++section_index) {
+		const MFStoreSection &section  =
+			src_ctl.GetSectionMapped(section_index);
+		const char           *data_ptr =
+			src_ctl.GetPtr<char>(section.section_offset_);
+		directory[section_index].section_     = section;
+		directory[section_index].first_block_ = block_ref_list.size();
+		directory[section_index].block_count_ =
+			CalcBlockCount(section.length_actual_, block_size);
+		for (MFStoreLen block_offset = 0;
+			block_offset < section.length_actual_; block_offset += block_size)
+			block_ref_list.push_back({data_ptr + block_offset,
+				std::min(block_size, section.length_actual_ - block_offset)});
+	}
+
+	std::ofstream o_file(archive_file_name,
+		std::ios::binary | std::ios::out | std::ios::trunc);
+
+	if (!o_file)
+		throw std::runtime_error("Unable to open the archive file for "
+			"writing.");
+
+	std::vector<char> header_data(MFStoreArchiveHeaderLength, '\0');
+
+	WriteArchiveData(o_file, header_data.data(), header_data.size());
+
+	uint64_t                         data_offset = MFStoreArchiveHeaderLength;
+	std::vector<MFStoreArchiveBlock> block_index(block_ref_list.size());
+	uint64_t                         batch_count =
+		ResolveThreadCount(thread_count, block_ref_list.size()) *
+		BlocksPerThreadBatch;
+	std::vector<std::vector<char>>   stored_list(static_cast<std::size_t>(
+		std::min<uint64_t>(batch_count, block_ref_list.size())));
+
+	for (uint64_t first_block = 0; first_block < block_ref_list.size();
+		first_block += batch_count) {
+		uint64_t block_count = std::min<uint64_t>(batch_count,
+			block_ref_list.size() - first_block);
+		MFStoreParallelFor(block_count, thread_count,
+			[&](unsigned int, uint64_t first_item, uint64_t item_count) {
+				for (uint64_t item_index = first_item;
+					item_index < (first_item + item_count); ++item_index) {
+					const ArchiveBlockRef &block_ref =
+						block_ref_list[first_block + item_index];
+					CompressBlock(block_ref, compress_level,
+						stored_list[item_index]);
+					block_index[first_block + item_index].checksum_ =
+						Crc32c(block_ref.data_ptr_, block_ref.data_length_);
+				}
+			});
+		for (uint64_t item_index = 0; item_index < block_count; ++item_index) {
+			const std::vector<char> &stored_data = stored_list[item_index];
+			MFStoreArchiveBlock     &block       =
+				block_index[first_block + item_index];
+			block.data_offset_   = data_offset;
+			block.stored_length_ = static_cast<uint32_t>(stored_data.size());
+			WriteArchiveData(o_file, stored_data.data(), stored_data.size());
+			data_offset              += stored_data.size();
+			stats.data_byte_count_   +=
+				block_ref_list[first_block + item_index].data_length_;
+			stats.raw_block_count_   += (stored_data.size() ==
+				block_ref_list[first_block + item_index].data_length_) ? 1 : 0;
+		}
+	}
+
+	PadArchiveData(o_file, data_offset, 64);
+
+	MFStoreArchiveHeader header;
+
+	::memset(&header, '\0', sizeof(header));
+
+	header.block_size_       = block_size;
+	header.file_size_        = src_ctl.GetFileSize();
+	header.alloc_gran_       = src_ctl.GetAllocGran();
+	header.section_count_    = directory.size();
+	header.block_count_      = block_index.size();
+	header.directory_offset_ = data_offset;
+
+	WriteArchiveData(o_file, directory.data(),
+		directory.size() * sizeof(directory[0]));
+	data_offset += directory.size() * sizeof(directory[0]);
+
+	PadArchiveData(o_file, data_offset, 64);
+
+	header.index_offset_ = data_offset;
+
+	WriteArchiveData(o_file, block_index.data(),
+		block_index.size() * sizeof(block_index[0]));
+	data_offset += block_index.size() * sizeof(block_index[0]);
+
+	if (!o_file.flush())
+		throw std::runtime_error("Attempt to flush the archive file failed.");
+
+	header.magic_ = MFStoreArchiveHeader::ArchiveMagic;
+
+	if ((!o_file.seekp(0)) || (!o_file.write(reinterpret_cast<const char *>(
+		&header), sizeof(header))) || (!o_file.flush()))
+		throw std::runtime_error("Attempt to write the archive header failed.");
+
+	stats.section_count_     = directory.size();
+	stats.block_count_       = block_index.size();
+	stats.stored_byte_count_ = data_offset;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArchiveStats::MFStoreArchiveStats()
+	:section_count_(0)
+	,block_count_(0)
+	,raw_block_count_(0)
+	,data_byte_count_(0)
+	,stored_byte_count_(0)
+	,elapsed_usecs_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreArchiveStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Sections=" << section_count_
+		<< ", Blocks=" << block_count_
+		<< ", UncompressedBlocks=" << raw_block_count_
+		<< ", DataBytes=" << data_byte_count_
+		<< ", StoredBytes=" << stored_byte_count_
+		<< ", Microseconds=" << elapsed_usecs_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArchiveCacheStats::MFStoreArchiveCacheStats()
+	:hit_count_(0)
+	,decompress_count_(0)
+	,evict_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreArchiveCacheStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Hits=" << hit_count_
+		<< ", Decompressions=" << decompress_count_
+		<< ", Evictions=" << evict_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArchiveStats ArchiveMFStore(const MFStoreControl &src_ctl,
+	const std::string &archive_file_name, MFStoreLen block_size,
+	int compress_level, unsigned int thread_count)
+{
+	MFStoreArchiveStats stats;
+	auto                start_time   = std::chrono::steady_clock::now();
+	bool                created_flag = false;
+
+	try {
+		src_ctl.CheckIsActive();
+		MLB::Utility::ThrowIfEmpty(archive_file_name, "The archive file name");
+		CheckBlockSize(block_size);
+		if ((compress_level < Z_NO_COMPRESSION) ||
+			(compress_level > Z_BEST_COMPRESSION))
+			throw std::invalid_argument("The compression level (" +
+				std::to_string(compress_level) + ") is outside of the "
+				"permissible range of " + std::to_string(Z_NO_COMPRESSION) +
+				" to " + std::to_string(Z_BEST_COMPRESSION) + ", inclusive.");
+		if (std::filesystem::exists(archive_file_name))
+			throw std::invalid_argument("The archive file already exists.");
+		created_flag = true;
+		WriteArchive(src_ctl, archive_file_name, block_size, compress_level,
+			thread_count, stats);
+	}
+	catch (const std::exception &except) {
+		if (created_flag) {
+			std::error_code error_code;
+			std::filesystem::remove(archive_file_name, error_code);
+		}
+		throw std::runtime_error("Unable to archive MFStore file '" +
+			src_ctl.GetFileName() + "' to file '" + archive_file_name + "': " +
+			std::string(except.what()));
+	}
+
+	stats.elapsed_usecs_ = static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count());
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArchive::MFStoreArchive(const std::string &file_name,
+	std::size_t max_cached_blocks)
+try
+	:file_name_(MLB::Utility::ThrowIfEmpty(file_name, "The archive file name"))
+	,max_cached_blocks_(max_cached_blocks)
+	,file_mapping_()
+	,region_()
+	,archive_ptr_(nullptr)
+	,archive_size_(std::filesystem::file_size(file_name))
+	,header_()
+	,directory_()
+	,block_index_ptr_(nullptr)
+	,section_list_()
+	,lru_mutex_()
+	,lru_list_()
+	,lru_map_()
+	,stats_()
+{
+	using namespace boost::interprocess;
+
+	if (!max_cached_blocks_)
+		throw std::invalid_argument("The maximum number of cached blocks is 0.");
+
+	if (archive_size_ < MFStoreArchiveHeaderLength)
+		throw std::invalid_argument("The file size (" +
+			std::to_string(archive_size_) + ") is less than the archive header "
+			"length (" + std::to_string(MFStoreArchiveHeaderLength) + ").");
+
+	FileMapping(file_name_.c_str(), read_only).swap(file_mapping_);
+	MappedRegion(file_mapping_, read_only, 0,
+		static_cast<std::size_t>(archive_size_)).swap(region_);
+
+	archive_ptr_ = static_cast<const char *>(region_.get_address());
+
+	CheckArchive();
+}
+catch (const std::exception &except) {
+	throw std::runtime_error("Unable to open MFStore archive file '" +
+		file_name + "': " + std::string(except.what()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &MFStoreArchive::GetFileName() const
+{
+	return(file_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreArchive::GetFileSize() const
+{
+	return(header_.file_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreArchive::GetAllocGran() const
+{
+	return(header_.alloc_gran_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreArchive::GetBlockSize() const
+{
+	return(header_.block_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreArchive::GetStoredSize() const
+{
+	return(archive_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreSectionList &MFStoreArchive::GetSectionList() const
+{
+	return(section_list_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArchive::Read(MFStoreOff datum_offset, void *dst_ptr,
+	MFStoreLen datum_length)
+{
+	CheckExtent(header_.file_size_, datum_offset, datum_length);
+	MLB::Utility::ThrowIfNull(dst_ptr, "The destination pointer");
+
+	char *out_ptr = static_cast<char *>(dst_ptr);
+
+	while (datum_length) {
+		auto section_iter = std::upper_bound(section_list_.begin(),
+			section_list_.end(), datum_offset,
+			[](MFStoreOff offset, const MFStoreSection &section) {
+				return(offset < (section.section_offset_ + section.length_actual_));
+			});
+		MFStoreLen this_length = datum_length;
+		if (section_iter == section_list_.end())
+			::memset(out_ptr, '\0', datum_length);
+		else if (datum_offset < section_iter->section_offset_) {
+			this_length = std::min(datum_length,
+				section_iter->section_offset_ - datum_offset);
+			::memset(out_ptr, '\0', this_length);
+		}
+		else {
+			this_length = std::min(datum_length, (section_iter->section_offset_ +
+				section_iter->length_actual_) - datum_offset);
+			ReadSection(static_cast<std::size_t>(
+				section_iter - section_list_.begin()),
+				datum_offset - section_iter->section_offset_, out_ptr,
+				this_length);
+		}
+		out_ptr      += this_length;
+		datum_offset += this_length;
+		datum_length -= this_length;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArchive::ReadSection(std::size_t section_index,
+	MFStoreOff datum_offset, void *dst_ptr, MFStoreLen datum_length)
+{
+	const MFStoreSection &section = section_list_.at(section_index);
+
+	CheckExtent(section.length_actual_, datum_offset, datum_length);
+	MLB::Utility::ThrowIfNull(dst_ptr, "The destination pointer");
+
+	char *out_ptr = static_cast<char *>(dst_ptr);
+
+	while (datum_length) {
+		uint64_t        block_index  = datum_offset / header_.block_size_;
+		MFStoreOff      block_offset = datum_offset % header_.block_size_;
+		CachedBlockSPtr block_sptr(GetBlock(section_index, block_index));
+		MFStoreLen      this_length  = std::min(datum_length,
+			block_sptr->block_data_.size() - block_offset);
+		::memcpy(out_ptr, block_sptr->block_data_.data() + block_offset,
+			this_length);
+		out_ptr      += this_length;
+		datum_offset += this_length;
+		datum_length -= this_length;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreControl MFStoreArchive::Extract(const std::string &dst_file_name,
+	unsigned int thread_count) const
+{
+	bool created_flag = false;
+
+	try {
+		if (std::filesystem::exists(dst_file_name))
+			throw std::invalid_argument("The file already exists.");
+		created_flag = true;
+		{
+			MFStoreControl dst_ctl(CreateMFStore(dst_file_name,
+				header_.file_size_, header_.file_size_, header_.alloc_gran_));
+			for (std::size_t section_index = 0;
+				section_index < directory_.size(); ++section_index) {
+				char *section_ptr = dst_ctl.GetPtr<char>(
+					section_list_[section_index].section_offset_);
+				MFStoreParallelFor(directory_[section_index].block_count_,
+					thread_count,
+					[&](unsigned int, uint64_t first_block, uint64_t block_count) {
+						for (uint64_t block_index = first_block;
+							block_index < (first_block + block_count); ++block_index)
+							DecompressBlock(section_index, block_index,
+								section_ptr + (block_index * header_.block_size_));
+					});
+			}
+			dst_ctl.Flush();
+		}
+		return(MFStoreControl(dst_file_name, false, header_.file_size_,
+			header_.file_size_, header_.alloc_gran_, section_list_));
+	}
+	catch (const std::exception &except) {
+		if (created_flag) {
+			std::error_code error_code;
+			std::filesystem::remove(dst_file_name, error_code);
+		}
+		throw std::runtime_error("Unable to extract MFStore archive file '" +
+			file_name_ + "' to file '" + dst_file_name + "': " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArchive::ReleaseBlocks()
+{
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	stats_.evict_count_ += lru_list_.size();
+
+	lru_map_.clear();
+	lru_list_.clear();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArchiveCacheStats MFStoreArchive::GetStats() const
+{
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	return(stats_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArchive::CheckArchive()
+{
+	::memcpy(&header_, archive_ptr_, sizeof(header_));
+
+	if (header_.magic_ != MFStoreArchiveHeader::ArchiveMagic)
+		throw std::invalid_argument("The file is not an MFStore archive or was "
+			"not completely written.");
+
+	CheckBlockSize(header_.block_size_);
+
+	if ((header_.directory_offset_ > archive_size_) ||
+		(header_.section_count_ > ((archive_size_ - header_.directory_offset_) /
+		sizeof(MFStoreArchiveSection))))
+		throw std::invalid_argument("The section directory extends beyond the "
+			"end of the file.");
+
+	if ((header_.index_offset_ % alignof(MFStoreArchiveBlock)) ||
+		(header_.index_offset_ > archive_size_) ||
+		(header_.block_count_ > ((archive_size_ - header_.index_offset_) /
+		sizeof(MFStoreArchiveBlock))))
+		throw std::invalid_argument("The block index is misaligned or extends "
+			"beyond the end of the file.");
+
+	directory_.resize(static_cast<std::size_t>(header_.section_count_));
+	::memcpy(directory_.data(), archive_ptr_ + header_.directory_offset_,
+		directory_.size() * sizeof(directory_[0]));
+
+	block_index_ptr_ = reinterpret_cast<const MFStoreArchiveBlock *>(
+		archive_ptr_ + header_.index_offset_);
+
+	for (std::size_t section_index = 0; section_index < directory_.size();
+		++section_index) {
+		const MFStoreArchiveSection &entry = directory_[section_index];
+		if ((entry.block_count_ != CalcBlockCount(entry.section_.length_actual_,
+			header_.block_size_)) || (entry.first_block_ > header_.block_count_) ||
+			(entry.block_count_ > (header_.block_count_ - entry.first_block_)))
+			throw std::invalid_argument("The blocks of the section at index " +
+				std::to_string(section_index) + " of the section directory are "
+				"inconsistent with the block index.");
+		section_list_.push_back(entry.section_);
+	}
+
+	MFStoreSection::CheckSectionList(section_list_, header_.alloc_gran_,
+		header_.file_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreArchive::GetBlockLength(std::size_t section_index,
+	uint64_t block_index) const
+{
+	MFStoreLen block_offset = block_index * header_.block_size_;
+
+	return(std::min(header_.block_size_,
+		section_list_[section_index].length_actual_ - block_offset));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArchive::DecompressBlock(std::size_t section_index,
+	uint64_t block_index, char *dst_ptr) const
+{
+	const MFStoreArchiveBlock &block        = block_index_ptr_[
+		directory_[section_index].first_block_ + block_index];
+	MFStoreLen                 block_length =
+		GetBlockLength(section_index, block_index);
+
+	try {
+		if ((block.stored_length_ > block_length) ||
+			(block.data_offset_ > archive_size_) ||
+			(block.stored_length_ > (archive_size_ - block.data_offset_)))
+			throw std::invalid_argument("The stored block of " +
+				std::to_string(block.stored_length_) + " bytes at offset " +
+				std::to_string(block.data_offset_) + " is invalid.");
+		if (block.stored_length_ == block_length)
+			::memcpy(dst_ptr, archive_ptr_ + block.data_offset_, block_length);
+		else {
+			uLongf dst_length = static_cast<uLongf>(block_length);
+			int    z_code     = ::uncompress(reinterpret_cast<Bytef *>(dst_ptr),
+				&dst_length, reinterpret_cast<const Bytef *>(archive_ptr_ +
+				block.data_offset_), static_cast<uLong>(block.stored_length_));
+			if (z_code != Z_OK)
+				throw std::runtime_error("Decompression failed with zlib error "
+					"code " + std::to_string(z_code) + ".");
+			if (dst_length != block_length)
+				throw std::runtime_error("Decompression produced " +
+					std::to_string(dst_length) + " bytes, but " +
+					std::to_string(block_length) + " were expected.");
+		}
+		if (Crc32c(dst_ptr, block_length) != block.checksum_)
+			throw std::runtime_error("The checksum of the block data does not "
+				"match that recorded in the block index.");
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to read block " +
+			std::to_string(block_index) + " of the section at index " +
+			std::to_string(section_index) + " of MFStore archive file '" +
+			file_name_ + "': " + std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Blocks are decompressed without holding the cache lock. If another thread
+	decompresses the same block in the meantime, the first to finish is
+	retained.
+*/
+MFStoreArchive::CachedBlockSPtr MFStoreArchive::GetBlock(
+	std::size_t section_index, uint64_t block_index)
+{
+	uint64_t cache_key = directory_[section_index].first_block_ + block_index;
+
+	{
+		std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+		auto map_iter = lru_map_.find(cache_key);
+		if (map_iter != lru_map_.end()) {
+			lru_list_.splice(lru_list_.begin(), lru_list_, map_iter->second);
+			++stats_.hit_count_;
+			return(lru_list_.front());
+		}
+	}
+
+	std::shared_ptr<CachedBlock> block_sptr(std::make_shared<CachedBlock>());
+
+	block_sptr->block_index_ = cache_key;
+	block_sptr->block_data_.resize(static_cast<std::size_t>(
+		GetBlockLength(section_index, block_index)));
+
+	DecompressBlock(section_index, block_index, block_sptr->block_data_.data());
+
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	++stats_.decompress_count_;
+
+	auto map_iter = lru_map_.find(cache_key);
+
+	if (map_iter != lru_map_.end())
+		return(*map_iter->second);
+
+	lru_list_.push_front(block_sptr);
+	lru_map_[cache_key] = lru_list_.begin();
+
+	if (lru_list_.size() > max_cached_blocks_) {
+		lru_map_.erase(lru_list_.back()->block_index_);
+		lru_list_.pop_back();
+		++stats_.evict_count_;
+	}
+
+	return(block_sptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreArchiveStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreArchiveCacheStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <random>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreArchive.bin");
+const std::string TEST_ArchiveName("./TEST_MAIN.MFStoreArchive.arc");
+const std::string TEST_ExtractName("./TEST_MAIN.MFStoreArchive.Extract.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_TickIndex   = 1;
+const std::size_t TEST_NoiseIndex  = 2;
+const uint64_t    TEST_TickCount   = 2 * 1024 * 1024;
+const uint64_t    TEST_NoiseCount  = 256 * 1024;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Tick
+{
+	uint64_t time_;
+	uint64_t security_id_;
+	double   price_;
+	uint32_t quantity_;
+	uint32_t flags_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+TEST_Tick TEST_MakeTick(uint64_t tick_index)
+{
+	return(TEST_Tick{1000000 + (tick_index * 10), 100 + (tick_index % 50),
+		100.0 + (static_cast<double>(tick_index % 400) / 4.0),
+		static_cast<uint32_t>(100 * ((tick_index % 7) + 1)), 0});
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(TEST_Tick),
+		TEST_TickCount, 0, 0, 0, 0, 0, "Ticks"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint64_t),
+		TEST_NoiseCount, 0, 0, 0, 0, 0, "Noise"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CheckFiles(const MFStoreControl &src_ctl,
+	const MFStoreControl &dst_ctl)
+{
+	if (::memcmp(src_ctl.GetMmapAddress(), dst_ctl.GetMmapAddress(),
+		static_cast<std::size_t>(src_ctl.GetFileSize())))
+		throw std::logic_error("The extracted MFStore file differs from the "
+			"original.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Archive()
+{
+	MFStoreSectionList section_list(TEST_MakeSectionList());
+	MFStoreLen         file_size = section_list.back().CalcNextOffset();
+
+	for (const auto &this_name : {TEST_FileName, TEST_ArchiveName,
+		TEST_ExtractName})
+		std::filesystem::remove(this_name);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	TEST_Tick     *tick_ptr  = mfstore_ctl.GetPtr<TEST_Tick>(
+		mfstore_ctl.GetSectionMapped(TEST_TickIndex).section_offset_);
+	uint64_t      *noise_ptr = mfstore_ctl.GetPtr<uint64_t>(
+		mfstore_ctl.GetSectionMapped(TEST_NoiseIndex).section_offset_);
+	std::mt19937_64 random_gen(42);
+
+	::strcpy(mfstore_ctl.GetPtr<char>(0), "MFStoreArchive test header");
+
+	for (uint64_t tick_index = 0; tick_index < TEST_TickCount; ++tick_index)
+		tick_ptr[tick_index] = TEST_MakeTick(tick_index);
+
+	for (uint64_t noise_index = 0; noise_index < TEST_NoiseCount;
+		++noise_index)
+		noise_ptr[noise_index] = random_gen();
+
+	MFStoreArchiveStats archive_stats = ArchiveMFStore(mfstore_ctl,
+		TEST_ArchiveName);
+
+	std::cout << "Archived: " << archive_stats << std::endl;
+
+	if (archive_stats.stored_byte_count_ >= (file_size / 2))
+		throw std::logic_error("The archive is not substantially smaller than "
+			"the original.");
+
+	if (!archive_stats.raw_block_count_)
+		throw std::logic_error("No incompressible blocks were stored "
+			"uncompressed.");
+
+	MFStoreArchive archive(TEST_ArchiveName, 8);
+
+	if ((archive.GetFileSize() != file_size) ||
+		(archive.GetSectionList().size() != section_list.size()) ||
+		(archive.GetSectionList()[TEST_NoiseIndex].section_offset_ !=
+		section_list[TEST_NoiseIndex].section_offset_))
+		throw std::logic_error("The archive directory doesn't describe the "
+			"original MFStore.");
+
+	{
+		std::mt19937_64 index_gen(7);
+		auto            start_time = std::chrono::steady_clock::now();
+		for (int count = 0; count < 5000; ++count) {
+			uint64_t  tick_index = index_gen() % TEST_TickCount;
+			TEST_Tick tick       =
+				archive.GetElement<TEST_Tick>(TEST_TickIndex, tick_index);
+			if (::memcmp(&tick, tick_ptr + tick_index, sizeof(tick)))
+				throw std::logic_error("The tick at index " +
+					std::to_string(tick_index) + " read from the archive is "
+					"incorrect.");
+		}
+		std::cout << "Random reads: " << archive.GetStats() << " in " <<
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now() - start_time).count() << " ms" <<
+			std::endl;
+	}
+
+	{
+		archive.ReleaseBlocks();
+		MFStoreArchiveCacheStats before_stats = archive.GetStats();
+		for (uint64_t tick_index = 0; tick_index < 10000; ++tick_index) {
+			TEST_Tick tick =
+				archive.GetElement<TEST_Tick>(TEST_TickIndex, tick_index);
+			if (tick.time_ != tick_ptr[tick_index].time_)
+				throw std::logic_error("A sequentially read tick is incorrect.");
+		}
+		MFStoreArchiveCacheStats after_stats = archive.GetStats();
+		uint64_t                 expected    = ((10000 * sizeof(TEST_Tick)) +
+			(archive.GetBlockSize() - 1)) / archive.GetBlockSize();
+		if ((after_stats.decompress_count_ - before_stats.decompress_count_) !=
+			expected)
+			throw std::logic_error("Sequential reads decompressed " +
+				std::to_string(after_stats.decompress_count_ -
+				before_stats.decompress_count_) + " blocks, but " +
+				std::to_string(expected) + " were expected.");
+		std::cout << "Sequential reads decompress each block once: OK" <<
+			std::endl;
+	}
+
+	{
+		std::vector<char> src_data(3 * MFStoreAllocGran);
+		std::vector<char> dst_data(src_data.size());
+		MFStoreOff        span_offset =
+			section_list[TEST_TickIndex].CalcNextOffset() - MFStoreAllocGran;
+		archive.Read(span_offset, dst_data.data(), dst_data.size());
+		::memcpy(src_data.data(), mfstore_ctl.GetPtr<char>(span_offset),
+			src_data.size());
+		if (src_data != dst_data)
+			throw std::logic_error("A read spanning sections is incorrect.");
+		std::cout << "Reads spanning sections: OK" << std::endl;
+	}
+
+	{
+		MFStoreControl extract_ctl(archive.Extract(TEST_ExtractName));
+		TEST_CheckFiles(mfstore_ctl, extract_ctl);
+		std::cout << "Extracted MFStore matches the original: OK" << std::endl;
+	}
+
+	{
+		bool rejected_flag = false;
+		try {
+			ArchiveMFStore(mfstore_ctl, TEST_ArchiveName);
+		}
+		catch (const std::exception &) {
+			rejected_flag = true;
+		}
+		if (!rejected_flag)
+			throw std::logic_error("An existing archive was overwritten.");
+	}
+
+	for (const auto &this_name : {TEST_FileName, TEST_ArchiveName,
+		TEST_ExtractName})
+		std::filesystem::remove(this_name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CorruptArchive()
+{
+	MFStoreSectionList section_list(TEST_MakeSectionList());
+	MFStoreLen         file_size = section_list.back().CalcNextOffset();
+
+	for (const auto &this_name : {TEST_FileName, TEST_ArchiveName})
+		std::filesystem::remove(this_name);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		TEST_Tick     *tick_ptr  = mfstore_ctl.GetPtr<TEST_Tick>(
+			mfstore_ctl.GetSectionMapped(TEST_TickIndex).section_offset_);
+		for (uint64_t tick_index = 0; tick_index < TEST_TickCount; ++tick_index)
+			tick_ptr[tick_index] = TEST_MakeTick(tick_index);
+		ArchiveMFStore(mfstore_ctl, TEST_ArchiveName);
+	}
+
+	{
+		std::fstream io_file(TEST_ArchiveName,
+			std::ios::binary | std::ios::in | std::ios::out);
+		io_file.seekp(static_cast<std::streamoff>(
+			std::filesystem::file_size(TEST_ArchiveName) / 2));
+		io_file.put('\x5A');
+	}
+
+	MFStoreArchive archive(TEST_ArchiveName);
+	bool           rejected_flag = false;
+
+	std::filesystem::remove(TEST_ExtractName);
+
+	try {
+		archive.Extract(TEST_ExtractName);
+	}
+	catch (const std::exception &except) {
+		rejected_flag = true;
+		std::cout << "Corrupt block rejected: " << except.what() << std::endl;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("A corrupt block was accepted.");
+
+	if (std::filesystem::exists(TEST_ExtractName))
+		throw std::logic_error("The incompletely extracted file was not "
+			"removed.");
+
+	for (const auto &this_name : {TEST_FileName, TEST_ArchiveName})
+		std::filesystem::remove(this_name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Archive();
+		TEST_CorruptArchive();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
@@ -0,0 +1,303 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreArena.cpp
+
+   File Description  :  Implementation of the MFStoreArena class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreArena.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const uint64_t ArenaPrefixLength = sizeof(uint64_t);
+const uint64_t ArenaAlignment    = sizeof(uint64_t);
+const uint64_t ArenaElementSize  = sizeof(MFStoreArenaHeader);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t CalcAllocLength(uint64_t data_length)
+{
+	return((ArenaPrefixLength + data_length + (ArenaAlignment - 1)) &
+		~(ArenaAlignment - 1));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArena::MFStoreArena(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, bool format_flag)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,section_offset_(0)
+	,section_ptr_(nullptr)
+	,header_ptr_(nullptr)
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.CalcLengthUsed() <= sizeof(MFStoreArenaHeader))
+			throw std::invalid_argument("The section length (" +
+				std::to_string(section.CalcLengthUsed()) + ") leaves no room "
+				"for allocations after the arena header.");
+		if (section.section_offset_ % alignof(MFStoreArenaHeader))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreArenaHeader)) + "-byte "
+				"boundary.");
+		section_offset_ = section.section_offset_;
+		section_ptr_    = mfstore_ctl.GetPtr<char>(section_offset_);
+		header_ptr_     = reinterpret_cast<MFStoreArenaHeader *>(section_ptr_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			header_ptr_->magic_    = 0;
+			header_ptr_->capacity_ = section.CalcLengthUsed();
+			header_ptr_->used_length_.store(sizeof(MFStoreArenaHeader),
+				std::memory_order_relaxed);
+			header_ptr_->alloc_count_.store(0, std::memory_order_relaxed);
+			::memset(header_ptr_->reserved_, '\0',
+				sizeof(header_ptr_->reserved_));
+			std::atomic_thread_fence(std::memory_order_release);
+			header_ptr_->magic_    = MFStoreArenaHeader::HeaderMagic;
+		}
+		else if (header_ptr_->magic_ != MFStoreArenaHeader::HeaderMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"an arena.");
+		else if (header_ptr_->capacity_ != section.CalcLengthUsed())
+			throw std::invalid_argument("The arena capacity (" +
+				std::to_string(header_ptr_->capacity_) + ") doesn't match the "
+				"section length (" + std::to_string(section.CalcLengthUsed()) +
+				").");
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as an arena: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArenaHandle MFStoreArena::TryAllocate(uint64_t data_length)
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	uint64_t alloc_length = CalcAllocLength(data_length);
+	uint64_t used_length  =
+		header_ptr_->used_length_.load(std::memory_order_relaxed);
+
+	do {
+		if ((data_length > header_ptr_->capacity_) ||
+			(alloc_length > (header_ptr_->capacity_ - used_length)))
+			return(MFStoreArenaNullHandle);
+	} while (!header_ptr_->used_length_.compare_exchange_weak(used_length,
+		used_length + alloc_length, std::memory_order_acq_rel,
+		std::memory_order_relaxed));
+
+	::memcpy(section_ptr_ + used_length, &data_length, sizeof(data_length));
+
+	header_ptr_->alloc_count_.fetch_add(1, std::memory_order_relaxed);
+
+	return(used_length + ArenaPrefixLength);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArenaHandle MFStoreArena::Allocate(uint64_t data_length)
+{
+	MFStoreArenaHandle arena_handle = TryAllocate(data_length);
+
+	if (arena_handle == MFStoreArenaNullHandle)
+		throw std::runtime_error("Unable to allocate " +
+			std::to_string(data_length) + " bytes from the arena in MFStore "
+			"file '" + mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + ": " +
+			std::to_string(GetUsedLength()) + " of its " +
+			std::to_string(GetCapacity()) + " bytes are in use.");
+
+	return(arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreArenaHandle MFStoreArena::AddData(const void *data_ptr,
+	uint64_t data_length)
+{
+	MFStoreArenaHandle arena_handle = Allocate(data_length);
+
+	::memcpy(section_ptr_ + arena_handle, data_ptr, data_length);
+
+	return(arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The NUL terminator is stored but not counted in the allocation length.
+*/
+MFStoreArenaHandle MFStoreArena::AddString(const std::string &src)
+{
+	MFStoreArenaHandle arena_handle = Allocate(src.size() + 1);
+
+	::memcpy(section_ptr_ + arena_handle, src.c_str(), src.size() + 1);
+
+	uint64_t data_length = src.size();
+
+	::memcpy(section_ptr_ + arena_handle - ArenaPrefixLength, &data_length,
+		sizeof(data_length));
+
+	return(arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+char *MFStoreArena::GetPtr(MFStoreArenaHandle arena_handle)
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	CheckHandle(arena_handle);
+
+	return(section_ptr_ + arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *MFStoreArena::GetPtr(MFStoreArenaHandle arena_handle) const
+{
+	CheckHandle(arena_handle);
+
+	return(section_ptr_ + arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreArena::GetLength(MFStoreArenaHandle arena_handle) const
+{
+	CheckHandle(arena_handle);
+
+	uint64_t data_length;
+
+	::memcpy(&data_length, section_ptr_ + arena_handle - ArenaPrefixLength,
+		sizeof(data_length));
+
+	return(data_length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string MFStoreArena::GetString(MFStoreArenaHandle arena_handle) const
+{
+	uint64_t data_length = GetLength(arena_handle);
+
+	return(std::string(section_ptr_ + arena_handle,
+		static_cast<std::size_t>(data_length)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreOff MFStoreArena::GetOffset(MFStoreArenaHandle arena_handle) const
+{
+	CheckHandle(arena_handle);
+
+	return(section_offset_ + arena_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreArena::GetCapacity() const
+{
+	return(header_ptr_->capacity_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreArena::GetUsedLength() const
+{
+	return(header_ptr_->used_length_.load(std::memory_order_acquire));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreArena::GetAllocatedCount() const
+{
+	return(header_ptr_->alloc_count_.load(std::memory_order_relaxed));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArena::Reset()
+{
+	mfstore_ctl_ptr_->CheckIsWriter();
+
+	header_ptr_->used_length_.store(sizeof(MFStoreArenaHeader),
+		std::memory_order_release);
+	header_ptr_->alloc_count_.store(0, std::memory_order_relaxed);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreArena::MakeArenaSection(uint64_t arena_length,
+	const std::string &description)
+{
+	return(MFStoreSection(0, ArenaElementSize,
+		(sizeof(MFStoreArenaHeader) + arena_length + (ArenaElementSize - 1)) /
+		ArenaElementSize, 0, 0, 0, 0, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreArena::CheckHandle(MFStoreArenaHandle arena_handle) const
+{
+	uint64_t used_length = GetUsedLength();
+	uint64_t data_length = 0;
+
+	if ((arena_handle >= (sizeof(MFStoreArenaHeader) + ArenaPrefixLength)) &&
+		(!(arena_handle % ArenaAlignment)) && (arena_handle <= used_length)) {
+		::memcpy(&data_length, section_ptr_ + arena_handle - ArenaPrefixLength,
+			sizeof(data_length));
+		if (data_length <= (used_length - arena_handle))
+			return;
+	}
+
+	throw std::invalid_argument("The arena handle (" +
+		std::to_string(arena_handle) + ") is not that of an allocation within "
+		"the arena in MFStore file '" + mfstore_ctl_ptr_->GetFileName() +
+		"' at offset " + std::to_string(section_offset_) + ".");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
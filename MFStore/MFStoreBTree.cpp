@@ -0,0 +1,566 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreBTree.cpp
+
+   File Description  :  Implementation of the MFStoreBTreeBase class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreBTree.hpp>
+
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreBTreeBase::MFStoreBTreeBase(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, bool format_flag, uint64_t key_size,
+	uint64_t value_size, uint64_t node_size)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,node_size_(node_size)
+	,section_ptr_(nullptr)
+	,header_ptr_(nullptr)
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.element_size_ != node_size)
+			throw std::invalid_argument("The section element size (" +
+				std::to_string(section.element_size_) + ") is not equal to the "
+				"node size (" + std::to_string(node_size) + ").");
+		if (section.element_count_ < 2)
+			throw std::invalid_argument("The section element count (" +
+				std::to_string(section.element_count_) + ") leaves no room for "
+				"nodes after the B+tree header.");
+		if (section.element_count_ > 0xFFFFFFFFULL)
+			throw std::invalid_argument("The section element count (" +
+				std::to_string(section.element_count_) + ") exceeds the "
+				"maximum number of nodes in a B+tree.");
+		if (section.section_offset_ % NodeAlignment)
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(NodeAlignment) + "-byte boundary.");
+		section_ptr_ = mfstore_ctl.GetPtr<char>(section.section_offset_);
+		header_ptr_  = reinterpret_cast<MFStoreBTreeHeader *>(section_ptr_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			header_ptr_->magic_       = 0;
+			header_ptr_->key_size_    = key_size;
+			header_ptr_->value_size_  = value_size;
+			header_ptr_->node_size_   = node_size;
+			header_ptr_->node_count_  = section.element_count_;
+			header_ptr_->next_unused_.store(1, std::memory_order_relaxed);
+			header_ptr_->entry_count_.store(0, std::memory_order_relaxed);
+			header_ptr_->root_node_.store(
+				AllocateNode(MFStoreBTreeNodeHeader::FlagLeaf),
+				std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			header_ptr_->magic_       = MFStoreBTreeHeader::HeaderMagic;
+		}
+		else if (header_ptr_->magic_ != MFStoreBTreeHeader::HeaderMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"a B+tree.");
+		else if ((header_ptr_->key_size_ != key_size) ||
+			(header_ptr_->value_size_ != value_size) ||
+			(header_ptr_->node_size_ != node_size) ||
+			(header_ptr_->node_count_ != section.element_count_))
+			throw std::invalid_argument("The B+tree header (key size " +
+				std::to_string(header_ptr_->key_size_) + ", value size " +
+				std::to_string(header_ptr_->value_size_) + ", node size " +
+				std::to_string(header_ptr_->node_size_) + ", node count " +
+				std::to_string(header_ptr_->node_count_) + ") doesn't match the "
+				"expected key size (" + std::to_string(key_size) + "), value "
+				"size (" + std::to_string(value_size) + ") and section.");
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as a B+tree: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreBTreeBase::GetNodeSize() const
+{
+	return(node_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreBTreeBase::GetNodeCapacity() const
+{
+	return(header_ptr_->node_count_ - 1);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreBTreeBase::GetNodesUsed() const
+{
+	return(header_ptr_->next_unused_.load(std::memory_order_relaxed) - 1);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreBTreeBase::GetEntryCount() const
+{
+	return(header_ptr_->entry_count_.load(std::memory_order_relaxed));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The node count excludes the node occupied by the B+tree header.
+*/
+MFStoreSection MFStoreBTreeBase::MakeBTreeSection(uint64_t node_size,
+	uint64_t node_count, const std::string &description)
+{
+	if ((!node_size) || (node_size % NodeAlignment))
+		throw std::invalid_argument("The B+tree node size (" +
+			std::to_string(node_size) + ") is not a non-zero multiple of " +
+			std::to_string(NodeAlignment) + ".");
+
+	return(MFStoreSection(0, node_size, node_count + 1, 0, 0, 0, 0, 0,
+		description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreBTreeBase::SetRootNode(uint32_t node_index)
+{
+	header_ptr_->root_node_.store(node_index, std::memory_order_release);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The new node isn't reachable by readers until the writer links it into
+	the tree, and so it is initialized without regard to its version.
+*/
+void MFStoreBTreeBase::CheckNodesFree(uint64_t node_count) const
+{
+	uint64_t node_index =
+		header_ptr_->next_unused_.load(std::memory_order_relaxed);
+
+	if ((node_index + node_count) > header_ptr_->node_count_)
+		throw std::runtime_error("Unable to allocate " +
+			std::to_string(node_count) + " node(s) for the B+tree in MFStore "
+			"file '" + mfstore_ctl_ptr_->GetFileName() + "': " +
+			std::to_string(header_ptr_->node_count_ - node_index) + " of " +
+			std::to_string(header_ptr_->node_count_ - 1) + " nodes are free.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreBTreeBase::AllocateNode(uint16_t node_flags)
+{
+	CheckNodesFree(1);
+
+	uint64_t node_index =
+		header_ptr_->next_unused_.load(std::memory_order_relaxed);
+
+	MFStoreBTreeNodeHeader *node_ptr =
+		GetNodePtr(static_cast<uint32_t>(node_index));
+
+	::memset(static_cast<void *>(node_ptr), '\0', node_size_);
+	node_ptr->node_flags_ = node_flags;
+
+	header_ptr_->next_unused_.store(node_index + 1, std::memory_order_relaxed);
+
+	return(static_cast<uint32_t>(node_index));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreBTreeBase::CheckWriter() const
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <filesystem>
+#include <map>
+#include <random>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreBTree.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_TreeIndex   = 1;
+const std::size_t TEST_OrderIndex  = 2;
+const std::size_t TEST_SmallIndex  = 3;
+const uint64_t    TEST_SmallNodes  = 20;
+const uint64_t    TEST_NodeCount   = 200000;
+const uint64_t    TEST_KeyCount    = 400000;
+const unsigned    TEST_ReaderCount = 3;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Orders are kept in instrument, price and order number sequence.
+struct TEST_OrderKey
+{
+	uint32_t instrument_id_;
+	int64_t  price_;
+	uint64_t order_id_;
+
+	bool operator < (const TEST_OrderKey &other) const
+	{
+		return((instrument_id_ < other.instrument_id_) ||
+			((instrument_id_ == other.instrument_id_) &&
+			((price_ < other.price_) ||
+			((price_ == other.price_) && (order_id_ < other.order_id_)))));
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+using TEST_Tree      = MFStoreBTree<uint64_t, uint64_t>;
+using TEST_OrderTree = MFStoreBTree<TEST_OrderKey, uint64_t, 512>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Check(bool condition, const std::string &error_text)
+{
+	if (!condition)
+		throw std::logic_error(error_text);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CompareWithMap(const TEST_Tree &tree,
+	const std::map<uint64_t, uint64_t> &check_map, std::mt19937_64 &rng)
+{
+	TEST_Check(tree.GetEntryCount() == check_map.size(), "The tree holds " +
+		std::to_string(tree.GetEntryCount()) + " entries, but " +
+		std::to_string(check_map.size()) + " were expected.");
+
+	auto             map_iter = check_map.begin();
+	TEST_Tree::Cursor cursor(tree.Begin());
+
+	for ( ; cursor.IsValid(); cursor.Next(), ++map_iter)
+		TEST_Check((map_iter != check_map.end()) &&
+			(cursor.GetKey() == map_iter->first) &&
+			(cursor.GetValue() == map_iter->second), "A full scan of the tree "
+			"differs from the expected contents at key " +
+			std::to_string(cursor.GetKey()) + ".");
+	TEST_Check(map_iter == check_map.end(), "A full scan of the tree ended "
+		"early.");
+
+	for (unsigned count_1 = 0; count_1 < 1000; ++count_1) {
+		uint64_t    first_key = rng() % (TEST_KeyCount * 4);
+		uint64_t    last_key  = first_key + (rng() % 5000);
+		auto        map_first = check_map.lower_bound(first_key);
+		auto        map_last  = check_map.lower_bound(last_key);
+		std::size_t scan_count = tree.ScanRange(first_key, last_key,
+			[&](const uint64_t &key, const uint64_t &value) {
+				TEST_Check((map_first != map_last) && (key == map_first->first) &&
+					(value == map_first->second), "A range scan returned an "
+					"unexpected key (" + std::to_string(key) + ").");
+				++map_first;
+				return(true);
+			});
+		TEST_Check(map_first == map_last, "A range scan from " +
+			std::to_string(first_key) + " to " + std::to_string(last_key) +
+			" ended early after " + std::to_string(scan_count) + " keys.");
+		uint64_t value = 0;
+		TEST_Check(tree.Find(first_key, value) ==
+			(check_map.find(first_key) != check_map.end()), "Find() of key " +
+			std::to_string(first_key) + " disagrees with the expected "
+			"contents.");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Each scan must return every even key exactly once and in order while the
+	writer inserts and erases odd keys.
+*/
+void TEST_ConcurrentScan(const TEST_Tree &tree, const std::atomic<bool> &done,
+	uint64_t &scan_count)
+{
+	while (!done.load(std::memory_order_acquire)) {
+		uint64_t expected_key = 0;
+		uint64_t last_key     = 0;
+		bool     first_flag   = true;
+		for (TEST_Tree::Cursor cursor(tree.Begin()); cursor.IsValid();
+			cursor.Next()) {
+			TEST_Check(first_flag || (last_key < cursor.GetKey()), "A "
+				"concurrent scan returned key " + std::to_string(cursor.GetKey()) +
+				" after key " + std::to_string(last_key) + ".");
+			TEST_Check(cursor.GetValue() == (cursor.GetKey() * 3), "A "
+				"concurrent scan returned an incorrect value for key " +
+				std::to_string(cursor.GetKey()) + ".");
+			first_flag = false;
+			last_key   = cursor.GetKey();
+			if (!(last_key & 1)) {
+				TEST_Check(last_key == expected_key, "A concurrent scan "
+					"returned key " + std::to_string(last_key) + " but expected "
+					"key " + std::to_string(expected_key) + ".");
+				expected_key += 2;
+			}
+		}
+		TEST_Check(expected_key == (TEST_KeyCount * 2), "A concurrent scan "
+			"missed keys after key " + std::to_string(expected_key) + ".");
+		++scan_count;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Fills a small tree until a split can't allocate its nodes, and checks that
+	the failed insertions leave the tree unchanged and usable.
+
+	Ascending keys fill the root's 18 leaves with one node to spare, so that
+	the first failure is a split which has its new leaf but not the new inner
+	node and root.
+*/
+void TEST_NodesExhausted(MFStoreControl &mfstore_ctl, std::mt19937_64 &rng)
+{
+	TEST_Tree                    tree(mfstore_ctl, TEST_SmallIndex, true);
+	std::map<uint64_t, uint64_t> check_map;
+	uint64_t                     failure_count = 0;
+
+	for (uint64_t count_1 = 0; count_1 < 20000; ++count_1) {
+		uint64_t this_key   = (!failure_count) ? count_1 :
+			(rng() % (TEST_KeyCount * 4));
+		uint64_t nodes_used = tree.GetNodesUsed();
+		try {
+			if (tree.Insert(this_key, this_key * 3))
+				check_map[this_key] = this_key * 3;
+		}
+		catch (const std::runtime_error &) {
+			TEST_Check(tree.GetNodesUsed() == nodes_used, "A failed insertion "
+				"allocated nodes.");
+			++failure_count;
+		}
+		if (failure_count && (!(count_1 % 7))) {
+			auto map_iter = check_map.lower_bound(rng() % (TEST_KeyCount * 4));
+			if (map_iter != check_map.end()) {
+				TEST_Check(tree.Erase(map_iter->first), "Erasure of key " +
+					std::to_string(map_iter->first) + " failed.");
+				check_map.erase(map_iter);
+			}
+		}
+	}
+
+	TEST_Check(failure_count > 0, "No insertion into the small tree failed.");
+	TEST_CompareWithMap(tree, check_map, rng);
+
+	std::cout << "Node exhaustion: " << failure_count << " insertions into " <<
+		tree.GetNodesUsed() << " nodes failed, " << tree.GetEntryCount() <<
+		" keys intact: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreBTree()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(TEST_Tree::MakeBTreeSection(256,
+		TEST_NodeCount, "Keys"), section_list);
+	MFStoreSection::AppendSection(TEST_OrderTree::MakeBTreeSection(512,
+		10000, "Orders"), section_list);
+	MFStoreSection::AppendSection(TEST_Tree::MakeBTreeSection(256,
+		TEST_SmallNodes, "Small"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	std::mt19937_64 rng(42);
+
+	{
+		MFStoreControl               mfstore_ctl(TEST_FileName, true, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		TEST_Tree                    tree(mfstore_ctl, TEST_TreeIndex, true);
+		std::map<uint64_t, uint64_t> check_map;
+		std::vector<uint64_t>        key_list(TEST_KeyCount);
+		for (uint64_t count_1 = 0; count_1 < TEST_KeyCount; ++count_1)
+			key_list[count_1] = count_1 * 2;
+		std::shuffle(key_list.begin(), key_list.end(), rng);
+		for (const auto &this_key : key_list) {
+			TEST_Check(tree.Insert(this_key, this_key * 3), "Insertion of key " +
+				std::to_string(this_key) + " failed.");
+			check_map[this_key] = this_key * 3;
+		}
+		TEST_Check(!tree.Insert(key_list[0], 0), "A duplicate key was "
+			"inserted.");
+		TEST_CompareWithMap(tree, check_map, rng);
+		std::cout << "Inserted " << tree.GetEntryCount() << " keys into " <<
+			tree.GetNodesUsed() << " nodes (leaf capacity " <<
+			TEST_Tree::LeafCapacity << ", inner capacity " <<
+			TEST_Tree::InnerCapacity << "): OK" << std::endl;
+
+		std::atomic<bool>               done(false);
+		std::vector<uint64_t>           scan_counts(TEST_ReaderCount, 0);
+		std::vector<std::exception_ptr> except_list(TEST_ReaderCount);
+		std::vector<std::thread>        thread_list;
+		for (unsigned thread_index = 0; thread_index < TEST_ReaderCount;
+			++thread_index)
+			thread_list.emplace_back([&, thread_index]() {
+				try {
+					TEST_ConcurrentScan(tree, done, scan_counts[thread_index]);
+				}
+				catch (...) {
+					except_list[thread_index] = std::current_exception();
+				}
+			});
+		uint64_t odd_count = 0;
+		for (uint64_t count_1 = 0; count_1 < (TEST_KeyCount / 2); ++count_1) {
+			uint64_t odd_key = ((rng() % TEST_KeyCount) * 2) + 1;
+			if (tree.Insert(odd_key, odd_key * 3))
+				++odd_count;
+			if (!(count_1 % 3)) {
+				uint64_t erase_key = ((rng() % TEST_KeyCount) * 2) + 1;
+				if (tree.Erase(erase_key))
+					--odd_count;
+			}
+		}
+		done.store(true, std::memory_order_release);
+		for (auto &this_thread : thread_list)
+			this_thread.join();
+		for (const auto &this_except : except_list) {
+			if (this_except)
+				std::rethrow_exception(this_except);
+		}
+		TEST_Check(tree.GetEntryCount() == (TEST_KeyCount + odd_count),
+			"The entry count is incorrect after the concurrent scans.");
+		std::cout << "Concurrent scans:";
+		for (const auto &this_count : scan_counts)
+			std::cout << " " << this_count;
+		std::cout << " with " << odd_count << " odd keys remaining: OK" <<
+			std::endl;
+
+		for (uint64_t count_1 = 0; count_1 < (TEST_KeyCount * 2); ++count_1) {
+			if (count_1 & 1)
+				tree.Erase(count_1);
+			else if (!(count_1 % 3))
+				TEST_Check(tree.Erase(count_1), "Erasure of key " +
+					std::to_string(count_1) + " failed.");
+		}
+		TEST_Check(!tree.InsertOrAssign(4, 5), "InsertOrAssign() inserted an "
+			"existing key.");
+		check_map.clear();
+		for (uint64_t count_1 = 0; count_1 < (TEST_KeyCount * 2); count_1 += 2) {
+			if (count_1 % 3)
+				check_map[count_1] = count_1 * 3;
+		}
+		check_map[4] = 5;
+		TEST_CompareWithMap(tree, check_map, rng);
+
+		TEST_NodesExhausted(mfstore_ctl, rng);
+
+		TEST_OrderTree order_tree(mfstore_ctl, TEST_OrderIndex, true);
+		for (uint64_t order_id = 1; order_id <= 20000; ++order_id)
+			order_tree.Insert({ static_cast<uint32_t>(order_id % 7),
+				static_cast<int64_t>(10000 + (order_id % 500)), order_id },
+				order_id);
+	}
+
+	{
+		MFStoreControl       mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		const TEST_Tree      tree(mfstore_ctl, TEST_TreeIndex);
+		const TEST_OrderTree order_tree(mfstore_ctl, TEST_OrderIndex);
+		uint64_t             value = 0;
+		TEST_Check(tree.Find(4, value) && (value == 5) && (!tree.Find(6, value)),
+			"The reopened tree has incorrect contents.");
+		uint64_t order_count = 0;
+		order_tree.ScanRange({ 3, 10100, 0 }, { 3, 10200, 0 },
+			[&](const TEST_OrderKey &key, const uint64_t &order_id) {
+				TEST_Check((key.instrument_id_ == 3) && (key.price_ >= 10100) &&
+					(key.price_ < 10200) && (key.order_id_ == order_id),
+					"The order range scan returned an unexpected order.");
+				++order_count;
+				return(true);
+			});
+		uint64_t expected_count = 0;
+		for (uint64_t order_id = 1; order_id <= 20000; ++order_id) {
+			uint64_t price = 10000 + (order_id % 500);
+			if (((order_id % 7) == 3) && (price >= 10100) && (price < 10200))
+				++expected_count;
+		}
+		TEST_Check(order_count == expected_count, "The order range scan "
+			"returned " + std::to_string(order_count) + " orders, but " +
+			std::to_string(expected_count) + " were expected.");
+		std::cout << "Reopened read-only: " << tree.GetEntryCount() <<
+			" keys, " << order_count << " orders for instrument 3 priced from "
+			"10100 to 10199: OK" << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MFStoreBTree();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
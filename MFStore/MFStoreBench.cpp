@@ -0,0 +1,483 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreBench.cpp
+
+   File Description  :  MFStore benchmark and stress program.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/EnsureFileBackingStore.hpp>
+
+#include <Utility/PageSize.hpp>
+#include <Utility/ParseNumericString.hpp>
+#include <Utility/ThrowErrno.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <vector>
+
+#ifdef __unix
+# include <sys/wait.h>
+# include <unistd.h>
+#endif // #ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+
+/*
+	Emits one line of comma-separated values per measurement:
+
+		benchmark,parameters,value,unit
+*/
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+using BenchClock = std::chrono::steady_clock;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct BenchConfig
+{
+	BenchConfig()
+		:file_name_("./MFStoreBench.bin")
+		,file_size_(256ULL * 1024ULL * 1024ULL)
+		,element_size_(64)
+		,op_count_(10000000)
+		,reader_count_(4)
+		,attach_count_(100)
+		,run_seconds_(2)
+	{
+	}
+
+	std::string file_name_;
+	MFStoreLen  file_size_;
+	std::size_t element_size_;
+	uint64_t    op_count_;
+	unsigned    reader_count_;
+	unsigned    attach_count_;
+	unsigned    run_seconds_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+volatile uint64_t BenchSink = 0;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+double ElapsedSeconds(const BenchClock::time_point &time_start,
+	const BenchClock::time_point &time_end = BenchClock::now())
+{
+	return(std::chrono::duration<double>(time_end - time_start).count());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void EmitResult(const char *bench_name, const std::string &bench_params,
+	double result_value, const char *result_unit)
+{
+	std::cout << bench_name << ',' << bench_params << ',' << std::fixed <<
+		std::setprecision(3) << result_value << ',' << result_unit << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t NextRandom(uint64_t &rng_state)
+{
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+
+	return(rng_state);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void BenchCreate(const BenchConfig &config)
+{
+	for (MFStoreLen divisor = 16; divisor; divisor /= 4) {
+		MFStoreLen file_size = FixUpValueGran(config.file_size_ / divisor,
+			MFStoreAllocGran);
+		std::filesystem::remove(config.file_name_);
+		BenchClock::time_point time_start = BenchClock::now();
+		CreateMFStore(config.file_name_, file_size, file_size);
+		double                 elapsed    = ElapsedSeconds(time_start);
+		std::string            params     = "size=" + std::to_string(file_size);
+		EmitResult("create", params, elapsed * 1000.0, "ms");
+		EmitResult("create", params, (file_size / elapsed) / 1.0e6, "MB/s");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void BenchThroughput(const BenchConfig &config)
+{
+	std::filesystem::remove(config.file_name_);
+
+	CreateMFStore(config.file_name_, config.file_size_, config.file_size_);
+
+	MFStoreControl    mfstore_ctl(config.file_name_, true, config.file_size_,
+		config.file_size_, MFStoreAllocGran);
+	char             *base_ptr      = mfstore_ctl.GetPtr<char>(0);
+	std::size_t       element_size  = config.element_size_;
+	uint64_t          element_count = config.file_size_ / element_size;
+	uint64_t          op_count      = std::min(config.op_count_, element_count);
+	std::vector<char> element_buffer(element_size, 'x');
+	std::string       params        = "element_size=" +
+		std::to_string(element_size) + ";elements=" +
+		std::to_string(element_count);
+
+	auto emit_rate = [&](const char *bench_name, uint64_t done_count,
+		double elapsed) {
+		EmitResult(bench_name, params, (done_count / elapsed) / 1.0e6, "Mops/s");
+		EmitResult(bench_name, params,
+			((done_count * element_size) / elapsed) / 1.0e6, "MB/s");
+	};
+
+	{
+		BenchClock::time_point time_start = BenchClock::now();
+		for (uint64_t count_1 = 0; count_1 < element_count; ++count_1) {
+			::memcpy(base_ptr + (count_1 * element_size), element_buffer.data(),
+				element_size);
+			::memcpy(base_ptr + (count_1 * element_size), &count_1,
+				std::min(element_size, sizeof(count_1)));
+		}
+		emit_rate("seq_write", element_count, ElapsedSeconds(time_start));
+	}
+
+	{
+		uint64_t               check_sum  = 0;
+		BenchClock::time_point time_start = BenchClock::now();
+		for (uint64_t count_1 = 0; count_1 < element_count; ++count_1)
+			check_sum += *reinterpret_cast<const uint8_t *>(
+				base_ptr + (count_1 * element_size));
+		emit_rate("seq_read", element_count, ElapsedSeconds(time_start));
+		BenchSink = check_sum;
+	}
+
+	{
+		uint64_t               rng_state  = 0x9E3779B97F4A7C15ULL;
+		uint64_t               check_sum  = 0;
+		BenchClock::time_point time_start = BenchClock::now();
+		for (uint64_t count_1 = 0; count_1 < op_count; ++count_1)
+			check_sum += *reinterpret_cast<const uint8_t *>(base_ptr +
+				((NextRandom(rng_state) % element_count) * element_size));
+		emit_rate("random_read", op_count, ElapsedSeconds(time_start));
+		BenchSink = check_sum;
+	}
+
+	{
+		uint64_t               rng_state  = 0xD1B54A32D192ED03ULL;
+		BenchClock::time_point time_start = BenchClock::now();
+		for (uint64_t count_1 = 0; count_1 < op_count; ++count_1)
+			::memcpy(base_ptr + ((NextRandom(rng_state) % element_count) *
+				element_size), element_buffer.data(), element_size);
+		emit_rate("random_write", op_count, ElapsedSeconds(time_start));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void BenchGrowth(const BenchConfig &config)
+{
+	MFStoreLen  initial_size = FixUpValueGran(config.file_size_ / 2,
+		MFStoreAllocGran);
+	MFStoreLen  grown_size   = initial_size * 2;
+	std::string params       = "from=" + std::to_string(initial_size) +
+		";to=" + std::to_string(grown_size);
+
+	std::filesystem::remove(config.file_name_);
+
+	MFStoreControl mfstore_ctl(CreateMFStore(config.file_name_, initial_size,
+		initial_size));
+
+	BenchClock::time_point time_start = BenchClock::now();
+
+	EnsureFileBackingStore(mfstore_ctl, initial_size,
+		grown_size - initial_size);
+
+	EmitResult("grow_extend", params, ElapsedSeconds(time_start) * 1000.0,
+		"ms");
+
+	time_start = BenchClock::now();
+
+	MFStoreControl grown_ctl(config.file_name_, true, grown_size, grown_size,
+		MFStoreAllocGran);
+
+	EmitResult("grow_remap", params, ElapsedSeconds(time_start) * 1000.0, "ms");
+
+	time_start = BenchClock::now();
+
+	char       *base_ptr  = grown_ctl.GetPtr<char>(0);
+	std::size_t page_size = GetPageSize();
+
+	for (MFStoreOff offset = initial_size; offset < grown_size;
+		offset += page_size)
+		base_ptr[offset] = 1;
+
+	EmitResult("grow_first_touch", params, ElapsedSeconds(time_start) * 1000.0,
+		"ms");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void BenchAttach(const BenchConfig &config)
+{
+	std::filesystem::remove(config.file_name_);
+
+	CreateMFStore(config.file_name_, config.file_size_, config.file_size_);
+
+	double total_seconds = 0.0;
+	double max_seconds   = 0.0;
+
+	for (unsigned count_1 = 0; count_1 < config.attach_count_; ++count_1) {
+		BenchClock::time_point time_start = BenchClock::now();
+		MFStoreControl         mfstore_ctl(config.file_name_, false,
+			config.file_size_, config.file_size_, MFStoreAllocGran);
+		BenchSink = *mfstore_ctl.GetPtr<uint8_t>(0);
+		double                 elapsed    = ElapsedSeconds(time_start);
+		total_seconds += elapsed;
+		max_seconds    = std::max(max_seconds, elapsed);
+	}
+
+	std::string params = "size=" + std::to_string(config.file_size_) +
+		";attaches=" + std::to_string(config.attach_count_);
+
+	EmitResult("reader_attach_avg", params,
+		(total_seconds / config.attach_count_) * 1.0e6, "us");
+	EmitResult("reader_attach_max", params, max_seconds * 1.0e6, "us");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t ContentionReader(const BenchConfig &config, unsigned reader_index)
+{
+	MFStoreControl         mfstore_ctl(config.file_name_, false,
+		config.file_size_, config.file_size_, MFStoreAllocGran);
+	const char            *base_ptr      = mfstore_ctl.GetPtr<char>(0);
+	uint64_t               element_count = config.file_size_ /
+		config.element_size_;
+	uint64_t               rng_state     = 0x2545F4914F6CDD1DULL +
+		reader_index;
+	uint64_t               read_count    = 0;
+	uint64_t               check_sum     = 0;
+	BenchClock::time_point time_end      = BenchClock::now() +
+		std::chrono::seconds(config.run_seconds_);
+
+	do {
+		for (unsigned count_1 = 0; count_1 < 1024; ++count_1)
+			check_sum += *reinterpret_cast<const uint8_t *>(base_ptr +
+				((NextRandom(rng_state) % element_count) * config.element_size_));
+		read_count += 1024;
+	} while (BenchClock::now() < time_end);
+
+	BenchSink = check_sum;
+
+	return(read_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void BenchContention(const BenchConfig &config)
+{
+	std::filesystem::remove(config.file_name_);
+
+	MFStoreControl mfstore_ctl(CreateMFStore(config.file_name_,
+		config.file_size_, config.file_size_));
+
+	std::vector<std::pair<pid_t, int>> child_list;
+
+	for (unsigned reader_idx = 0; reader_idx < config.reader_count_;
+		++reader_idx) {
+		int pipe_fds[2];
+		if (::pipe(pipe_fds) != 0)
+			ThrowErrno("Call to ::pipe() failed");
+		pid_t child_pid = ::fork();
+		if (child_pid < 0)
+			ThrowErrno("Call to ::fork() failed");
+		else if (!child_pid) {
+			::close(pipe_fds[0]);
+			uint64_t read_count = 0;
+			try {
+				read_count = ContentionReader(config, reader_idx);
+			}
+			catch (const std::exception &except) {
+				std::cerr << "Reader " << reader_idx << " failed: " <<
+					except.what() << std::endl;
+			}
+			ssize_t write_count =
+				::write(pipe_fds[1], &read_count, sizeof(read_count));
+			::_exit((write_count == sizeof(read_count)) ? EXIT_SUCCESS :
+				EXIT_FAILURE);
+		}
+		::close(pipe_fds[1]);
+		child_list.emplace_back(child_pid, pipe_fds[0]);
+	}
+
+	char                   *base_ptr      = mfstore_ctl.GetPtr<char>(0);
+	uint64_t                element_count = config.file_size_ /
+		config.element_size_;
+	uint64_t                rng_state     = 0x853C49E6748FEA9BULL;
+	uint64_t                write_count   = 0;
+	std::size_t             store_size    = std::min(config.element_size_,
+		sizeof(write_count));
+	BenchClock::time_point  time_start    = BenchClock::now();
+	BenchClock::time_point  time_end      = time_start +
+		std::chrono::seconds(config.run_seconds_);
+
+	// Elements narrower than a uint64_t receive only its low-order bytes.
+	do {
+		for (unsigned count_1 = 0; count_1 < 1024; ++count_1) {
+			uint64_t datum = write_count + count_1;
+			::memcpy(base_ptr +
+				((NextRandom(rng_state) % element_count) * config.element_size_),
+				&datum, store_size);
+		}
+		write_count += 1024;
+	} while (BenchClock::now() < time_end);
+
+	double   elapsed     = ElapsedSeconds(time_start);
+	uint64_t total_reads = 0;
+
+	for (const auto &this_child : child_list) {
+		uint64_t read_count = 0;
+		if (::read(this_child.second, &read_count, sizeof(read_count)) ==
+			sizeof(read_count))
+			total_reads += read_count;
+		::close(this_child.second);
+		int child_status = 0;
+		::waitpid(this_child.first, &child_status, 0);
+	}
+
+	std::string params = "readers=" + std::to_string(config.reader_count_) +
+		";element_size=" + std::to_string(config.element_size_) + ";seconds=" +
+		std::to_string(config.run_seconds_);
+
+	EmitResult("contention_writer", params, (write_count / elapsed) / 1.0e6,
+		"Mops/s");
+	EmitResult("contention_readers_total", params,
+		(total_reads / elapsed) / 1.0e6, "Mops/s");
+
+	if (config.reader_count_)
+		EmitResult("contention_reader_avg", params,
+			((total_reads / elapsed) / config.reader_count_) / 1.0e6, "Mops/s");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	DatumType ParseArgValue(int argc, char **argv, int &arg_idx)
+{
+	if ((arg_idx + 1) >= argc)
+		throw std::invalid_argument("Expected a value after the '" +
+			std::string(argv[arg_idx]) + "' parameter.");
+
+	return(CheckIsNumericString<DatumType>(argv[++arg_idx]));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+BenchConfig ParseCmdLine(int argc, char **argv)
+{
+	BenchConfig config;
+
+	for (int arg_idx = 1; arg_idx < argc; ++arg_idx) {
+		std::string this_arg(argv[arg_idx]);
+		if ((this_arg == "-h") || (this_arg == "-help")) {
+			std::cout << "Usage: " << argv[0] << " [ -file <name> ] "
+				"[ -size <bytes> ] [ -element_size <bytes> ] [ -ops <count> ] "
+				"[ -readers <count> ] [ -attaches <count> ] "
+				"[ -seconds <count> ]" << std::endl;
+			::exit(EXIT_SUCCESS);
+		}
+		else if (this_arg == "-file") {
+			if ((arg_idx + 1) >= argc)
+				throw std::invalid_argument("Expected a file name after the "
+					"'-file' parameter.");
+			config.file_name_ = argv[++arg_idx];
+		}
+		else if (this_arg == "-size")
+			config.file_size_    = FixUpValueGran(
+				ParseArgValue<MFStoreLen>(argc, argv, arg_idx), MFStoreAllocGran);
+		else if (this_arg == "-element_size")
+			config.element_size_ = ParseArgValue<std::size_t>(argc, argv, arg_idx);
+		else if (this_arg == "-ops")
+			config.op_count_     = ParseArgValue<uint64_t>(argc, argv, arg_idx);
+		else if (this_arg == "-readers")
+			config.reader_count_ = ParseArgValue<unsigned>(argc, argv, arg_idx);
+		else if (this_arg == "-attaches")
+			config.attach_count_ = ParseArgValue<unsigned>(argc, argv, arg_idx);
+		else if (this_arg == "-seconds")
+			config.run_seconds_  = ParseArgValue<unsigned>(argc, argv, arg_idx);
+		else
+			throw std::invalid_argument("Unknown command line parameter '" +
+				this_arg + "'.");
+	}
+
+	if ((!config.element_size_) || (config.element_size_ > config.file_size_))
+		throw std::invalid_argument("The element size must be between 1 and "
+			"the file size (" + std::to_string(config.file_size_) + ").");
+
+	if (!config.attach_count_)
+		throw std::invalid_argument("The number of reader attaches is 0.");
+
+	return(config);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	int         return_code = EXIT_SUCCESS;
+	BenchConfig config;
+
+	try {
+		config = ParseCmdLine(argc, argv);
+		std::cout << "benchmark,parameters,value,unit" << std::endl;
+		BenchCreate(config);
+		BenchThroughput(config);
+		BenchGrowth(config);
+		BenchAttach(config);
+#ifdef __unix
+		BenchContention(config);
+#endif // #ifdef __unix
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	std::filesystem::remove(config.file_name_);
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,568 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreColumnScan.cpp
+
+   File Description  :  Implementation of the column scan functions.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreColumnScan.hpp>
+
+#include <bitset>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/*
+	The GCC vector extensions (also supported by clang) are used in preference
+	to the intrinsics of any particular instruction set, so that the compiler
+	emits the widest instructions permitted by the target flags.
+*/
+#if defined(__GNUC__) || defined(__clang__)
+# define MFStore_COLUMN_VECTOR 1
+#endif // #if defined(__GNUC__) || defined(__clang__)
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+#ifdef MFStore_COLUMN_VECTOR
+
+// ////////////////////////////////////////////////////////////////////////////
+#if defined(__AVX512F__)
+const std::size_t ColumnVectorBytes = 64;
+#elif defined(__AVX__)
+const std::size_t ColumnVectorBytes = 32;
+#else
+const std::size_t ColumnVectorBytes = 16;
+#endif // #if defined(__AVX512F__)
+
+template <typename DatumType, std::size_t VectorBytes>
+	struct ColumnVectorType
+{
+	typedef DatumType type __attribute__((vector_size(VectorBytes)));
+};
+
+template <typename DatumType, std::size_t VectorBytes = ColumnVectorBytes>
+	using ColumnVector = typename ColumnVectorType<DatumType, VectorBytes>::type;
+
+template <typename VectorType, typename DatumType>
+	inline VectorType LoadVector(const DatumType *datum_ptr)
+{
+	VectorType vector_value;
+
+	::memcpy(&vector_value, datum_ptr, sizeof(vector_value));
+
+	return(vector_value);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef MFStore_COLUMN_VECTOR
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t PopCount(uint64_t word_value)
+{
+#ifdef MFStore_COLUMN_VECTOR
+	return(static_cast<uint64_t>(__builtin_popcountll(word_value)));
+#else
+	return(std::bitset<64>(word_value).count());
+#endif // #ifdef MFStore_COLUMN_VECTOR
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline unsigned int CountTrailingZeros(uint64_t word_value)
+{
+#ifdef MFStore_COLUMN_VECTOR
+	return(static_cast<unsigned int>(__builtin_ctzll(word_value)));
+#else
+	unsigned int bit_index = 0;
+
+	while (!(word_value & 1)) {
+		word_value >>= 1;
+		++bit_index;
+	}
+
+	return(bit_index);
+#endif // #ifdef MFStore_COLUMN_VECTOR
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	void CheckColumnArgs(const DatumType *column_ptr, uint64_t row_count,
+		const char *func_name)
+{
+	if (!row_count)
+		throw std::invalid_argument(std::string(func_name) + "(): the row "
+			"count is 0.");
+
+	if (!column_ptr)
+		throw std::invalid_argument(std::string(func_name) + "(): the column "
+			"pointer is NULL.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The select functor must be usable with both scalars and vectors, as are
+	the generic lambdas passed by ColumnMin() and ColumnMax().
+*/
+template <typename DatumType, typename SelectFunc>
+	DatumType ColumnReduce(const DatumType *column_ptr, uint64_t row_count,
+		SelectFunc select_func)
+{
+	DatumType result    = column_ptr[0];
+	uint64_t  row_index = 1;
+
+#ifdef MFStore_COLUMN_VECTOR
+	using VectorType = ColumnVector<DatumType>;
+
+	const uint64_t lane_count = sizeof(VectorType) / sizeof(DatumType);
+
+	if (row_count >= lane_count) {
+		VectorType accum = LoadVector<VectorType>(column_ptr);
+		for (row_index = lane_count; (row_index + lane_count) <= row_count;
+			row_index += lane_count)
+			accum = select_func(accum,
+				LoadVector<VectorType>(column_ptr + row_index));
+		for (uint64_t lane_index = 0; lane_index < lane_count; ++lane_index)
+			result = select_func(result, static_cast<DatumType>(accum[lane_index]));
+	}
+#endif // #ifdef MFStore_COLUMN_VECTOR
+
+	for ( ; row_index < row_count; ++row_index)
+		result = select_func(result, column_ptr[row_index]);
+
+	return(result);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The predicate is invoked with either two vectors or two scalars, and must
+	return a lane mask or a bool respectively.
+*/
+template <typename DatumType, typename PredFunc>
+	uint64_t ColumnFilterImpl(const DatumType *column_ptr, uint64_t row_count,
+		DatumType value_1, DatumType value_2, PredFunc pred_func,
+		MFStoreColumnBitmap &row_bitmap)
+{
+	row_bitmap.assign(static_cast<std::size_t>((row_count + 63) / 64), 0);
+
+	uint64_t row_index = 0;
+
+#ifdef MFStore_COLUMN_VECTOR
+	using VectorType = ColumnVector<DatumType>;
+
+	const uint64_t lane_count = sizeof(VectorType) / sizeof(DatumType);
+	VectorType     vector_1   = VectorType{} + value_1;
+	VectorType     vector_2   = VectorType{} + value_2;
+
+	static_assert((64 % (sizeof(VectorType) / sizeof(DatumType))) == 0,
+		"The vector lane count must evenly divide the bitmap word width.");
+
+	for ( ; (row_index + lane_count) <= row_count; row_index += lane_count) {
+		auto     lane_mask = pred_func(
+			LoadVector<VectorType>(column_ptr + row_index), vector_1, vector_2);
+		uint64_t lane_bits = 0;
+		for (uint64_t lane_index = 0; lane_index < lane_count; ++lane_index)
+			lane_bits |= static_cast<uint64_t>(lane_mask[lane_index] & 1) <<
+				lane_index;
+		row_bitmap[static_cast<std::size_t>(row_index / 64)] |=
+			lane_bits << (row_index % 64);
+	}
+#endif // #ifdef MFStore_COLUMN_VECTOR
+
+	for ( ; row_index < row_count; ++row_index) {
+		if (pred_func(column_ptr[row_index], value_1, value_2))
+			row_bitmap[static_cast<std::size_t>(row_index / 64)] |=
+				uint64_t(1) << (row_index % 64);
+	}
+
+	return(BitmapCount(row_bitmap));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	DatumType ColumnMin(const DatumType *column_ptr, uint64_t row_count)
+{
+	CheckColumnArgs(column_ptr, row_count, "ColumnMin");
+
+	return(ColumnReduce(column_ptr, row_count,
+		[](auto value_1, auto value_2) {
+			return((value_2 < value_1) ? value_2 : value_1);
+		}));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	DatumType ColumnMax(const DatumType *column_ptr, uint64_t row_count)
+{
+	CheckColumnArgs(column_ptr, row_count, "ColumnMax");
+
+	return(ColumnReduce(column_ptr, row_count,
+		[](auto value_1, auto value_2) {
+			return((value_2 > value_1) ? value_2 : value_1);
+		}));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	MFStoreColumnSum<DatumType> ColumnSum(const DatumType *column_ptr,
+		uint64_t row_count)
+{
+	using SumType = MFStoreColumnSum<DatumType>;
+
+	if (!row_count)
+		return(SumType(0));
+
+	CheckColumnArgs(column_ptr, row_count, "ColumnSum");
+
+	SumType  result    = 0;
+	uint64_t row_index = 0;
+
+#ifdef MFStore_COLUMN_VECTOR
+	// Each loaded vector of values is widened to the accumulator type.
+	using SumVector  = ColumnVector<SumType>;
+
+	const uint64_t lane_count = sizeof(SumVector) / sizeof(SumType);
+
+	using DataVector = ColumnVector<DatumType, lane_count * sizeof(DatumType)>;
+
+	SumVector accum = {};
+
+	for ( ; (row_index + lane_count) <= row_count; row_index += lane_count)
+		accum += __builtin_convertvector(
+			LoadVector<DataVector>(column_ptr + row_index), SumVector);
+
+	for (uint64_t lane_index = 0; lane_index < lane_count; ++lane_index)
+		result += accum[lane_index];
+#endif // #ifdef MFStore_COLUMN_VECTOR
+
+	for ( ; row_index < row_count; ++row_index)
+		result += column_ptr[row_index];
+
+	return(result);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	MFStoreColumnSum<DatumType> ColumnSumSelected(const DatumType *column_ptr,
+		uint64_t row_count, const MFStoreColumnBitmap &row_bitmap)
+{
+	if (row_bitmap.size() < ((row_count + 63) / 64))
+		throw std::invalid_argument("ColumnSumSelected(): the bitmap has " +
+			std::to_string(row_bitmap.size()) + " words, which is insufficient "
+			"for " + std::to_string(row_count) + " rows.");
+
+	MFStoreColumnSum<DatumType> result = 0;
+
+	for (uint64_t word_index = 0; (word_index * 64) < row_count;
+		++word_index) {
+		uint64_t word_value = row_bitmap[static_cast<std::size_t>(word_index)];
+		if (((word_index + 1) * 64) > row_count)
+			word_value &= (uint64_t(1) << (row_count % 64)) - 1;
+		while (word_value) {
+			result     += column_ptr[(word_index * 64) +
+				CountTrailingZeros(word_value)];
+			word_value &= word_value - 1;
+		}
+	}
+
+	return(result);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	uint64_t ColumnFilter(const DatumType *column_ptr, uint64_t row_count,
+		MFStoreColumnOp column_op, DatumType datum_value,
+		MFStoreColumnBitmap &row_bitmap)
+{
+	if (!row_count) {
+		row_bitmap.clear();
+		return(0);
+	}
+
+	CheckColumnArgs(column_ptr, row_count, "ColumnFilter");
+
+	switch (column_op) {
+		case MFStoreColumnOp::Less			:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value < operand);
+				}, row_bitmap));
+		case MFStoreColumnOp::LessEqual		:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value <= operand);
+				}, row_bitmap));
+		case MFStoreColumnOp::Equal			:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value == operand);
+				}, row_bitmap));
+		case MFStoreColumnOp::NotEqual		:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value != operand);
+				}, row_bitmap));
+		case MFStoreColumnOp::GreaterEqual	:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value >= operand);
+				}, row_bitmap));
+		case MFStoreColumnOp::Greater		:
+			return(ColumnFilterImpl(column_ptr, row_count, datum_value,
+				datum_value, [](auto value, auto operand, auto) {
+					return(value > operand);
+				}, row_bitmap));
+		default								:
+			break;
+	}
+
+	throw std::invalid_argument("ColumnFilter(): invalid column operator "
+		"value (" + std::to_string(static_cast<int>(column_op)) + ").");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	uint64_t ColumnFilterRange(const DatumType *column_ptr, uint64_t row_count,
+		DatumType low_value, DatumType high_value,
+		MFStoreColumnBitmap &row_bitmap)
+{
+	if (!row_count) {
+		row_bitmap.clear();
+		return(0);
+	}
+
+	CheckColumnArgs(column_ptr, row_count, "ColumnFilterRange");
+
+	return(ColumnFilterImpl(column_ptr, row_count, low_value, high_value,
+		[](auto value, auto low, auto high) {
+			return((value >= low) & (value <= high));
+		}, row_bitmap));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t BitmapCount(const MFStoreColumnBitmap &row_bitmap)
+{
+	uint64_t bit_count = 0;
+
+	for (const auto &this_word : row_bitmap)
+		bit_count += PopCount(this_word);
+
+	return(bit_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t BitmapAnd(MFStoreColumnBitmap &dst_bitmap,
+	const MFStoreColumnBitmap &src_bitmap)
+{
+	if (dst_bitmap.size() != src_bitmap.size())
+		throw std::invalid_argument("BitmapAnd(): the bitmap sizes differ (" +
+			std::to_string(dst_bitmap.size()) + " and " +
+			std::to_string(src_bitmap.size()) + ").");
+
+	uint64_t bit_count = 0;
+
+	for (std::size_t word_index = 0; word_index < dst_bitmap.size();
+		++word_index)
+		bit_count += PopCount(dst_bitmap[word_index] &= src_bitmap[word_index]);
+
+	return(bit_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t BitmapOr(MFStoreColumnBitmap &dst_bitmap,
+	const MFStoreColumnBitmap &src_bitmap)
+{
+	if (dst_bitmap.size() != src_bitmap.size())
+		throw std::invalid_argument("BitmapOr(): the bitmap sizes differ (" +
+			std::to_string(dst_bitmap.size()) + " and " +
+			std::to_string(src_bitmap.size()) + ").");
+
+	uint64_t bit_count = 0;
+
+	for (std::size_t word_index = 0; word_index < dst_bitmap.size();
+		++word_index)
+		bit_count += PopCount(dst_bitmap[word_index] |= src_bitmap[word_index]);
+
+	return(bit_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+#define MFStore_COLUMN_SCAN_INSTANTIATE(DatumType)								\
+	template DatumType ColumnMin<DatumType>(const DatumType *, uint64_t);		\
+	template DatumType ColumnMax<DatumType>(const DatumType *, uint64_t);		\
+	template MFStoreColumnSum<DatumType> ColumnSum<DatumType>(					\
+		const DatumType *, uint64_t);											\
+	template MFStoreColumnSum<DatumType> ColumnSumSelected<DatumType>(			\
+		const DatumType *, uint64_t, const MFStoreColumnBitmap &);				\
+	template uint64_t ColumnFilter<DatumType>(const DatumType *, uint64_t,		\
+		MFStoreColumnOp, DatumType, MFStoreColumnBitmap &);						\
+	template uint64_t ColumnFilterRange<DatumType>(const DatumType *,			\
+		uint64_t, DatumType, DatumType, MFStoreColumnBitmap &);
+
+MFStore_COLUMN_SCAN_INSTANTIATE(int32_t)
+MFStore_COLUMN_SCAN_INSTANTIATE(uint32_t)
+MFStore_COLUMN_SCAN_INSTANTIATE(int64_t)
+MFStore_COLUMN_SCAN_INSTANTIATE(uint64_t)
+MFStore_COLUMN_SCAN_INSTANTIATE(float)
+MFStore_COLUMN_SCAN_INSTANTIATE(double)
+
+#undef MFStore_COLUMN_SCAN_INSTANTIATE
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#ifdef TEST_MAIN
+
+#include <cmath>
+#include <iostream>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	void TEST_ScanType(const char *type_name, uint64_t row_count)
+{
+	std::vector<DatumType> column(static_cast<std::size_t>(row_count));
+	uint64_t               rng_state = 0x9E3779B97F4A7C15ULL + row_count;
+
+	for (auto &this_value : column) {
+		rng_state ^= rng_state << 13;
+		rng_state ^= rng_state >> 7;
+		rng_state ^= rng_state << 17;
+		this_value = static_cast<DatumType>(static_cast<int64_t>(
+			rng_state % 2001) - (std::is_signed<DatumType>::value ? 1000 : 0));
+	}
+
+	DatumType                   min_value = column[0];
+	DatumType                   max_value = column[0];
+	MFStoreColumnSum<DatumType> sum_value = 0;
+	MFStoreColumnSum<DatumType> sum_range = 0;
+	uint64_t                    less_count  = 0;
+	uint64_t                    range_count = 0;
+	DatumType                   low_value   = static_cast<DatumType>(100);
+	DatumType                   high_value  = static_cast<DatumType>(600);
+
+	for (const auto &this_value : column) {
+		min_value  = std::min(min_value, this_value);
+		max_value  = std::max(max_value, this_value);
+		sum_value += this_value;
+		less_count += (this_value < low_value) ? 1 : 0;
+		if ((this_value >= low_value) && (this_value <= high_value)) {
+			++range_count;
+			sum_range += this_value;
+		}
+	}
+
+	MFStoreColumnBitmap less_bitmap;
+	MFStoreColumnBitmap range_bitmap;
+
+	if (ColumnMin(column.data(), row_count) != min_value)
+		throw std::logic_error("ColumnMin() failed.");
+	if (ColumnMax(column.data(), row_count) != max_value)
+		throw std::logic_error("ColumnMax() failed.");
+	if (std::fabs(static_cast<double>(ColumnSum(column.data(), row_count) -
+		sum_value)) > 1.0e-6)
+		throw std::logic_error("ColumnSum() failed.");
+	if (ColumnFilter(column.data(), row_count, MFStoreColumnOp::Less,
+		low_value, less_bitmap) != less_count)
+		throw std::logic_error("ColumnFilter() failed.");
+	if (ColumnFilterRange(column.data(), row_count, low_value, high_value,
+		range_bitmap) != range_count)
+		throw std::logic_error("ColumnFilterRange() failed.");
+	if (std::fabs(static_cast<double>(ColumnSumSelected(column.data(),
+		row_count, range_bitmap) - sum_range)) > 1.0e-6)
+		throw std::logic_error("ColumnSumSelected() failed.");
+	if (BitmapAnd(less_bitmap, range_bitmap))
+		throw std::logic_error("BitmapAnd() of disjoint bitmaps failed.");
+
+	for (uint64_t row_index = 0; row_index < row_count; ++row_index) {
+		bool is_set = ((range_bitmap[row_index / 64] >> (row_index % 64)) & 1) != 0;
+		if (is_set != ((column[row_index] >= low_value) &&
+			(column[row_index] <= high_value)))
+			throw std::logic_error("The filter bitmap is incorrect at row " +
+				std::to_string(row_index) + ".");
+	}
+
+	std::cout << type_name << " x " << row_count << ": OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	void TEST_ScanType(const char *type_name)
+{
+	const uint64_t row_count_list[] = { 1, 7, 63, 64, 65, 1000, 100003 };
+
+	for (const auto &row_count : row_count_list)
+		TEST_ScanType<DatumType>(type_name, row_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_ScanType<int32_t>("int32_t");
+		TEST_ScanType<uint32_t>("uint32_t");
+		TEST_ScanType<int64_t>("int64_t");
+		TEST_ScanType<uint64_t>("uint64_t");
+		TEST_ScanType<float>("float");
+		TEST_ScanType<double>("double");
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
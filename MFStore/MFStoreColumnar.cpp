@@ -0,0 +1,392 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreColumnar.cpp
+
+   File Description  :  Implementation of the columnar section classes.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreColumnar.hpp>
+
+#include <Utility/GranularRound.hpp>
+
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreColumnSpec::MFStoreColumnSpec(const std::string &column_name,
+	uint64_t column_width)
+	:column_name_(column_name)
+	,column_width_(column_width)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreColumnLayout::MFStoreColumnLayout(uint64_t row_count,
+	const MFStoreColumnSpecList &column_list)
+	:row_count_(row_count)
+	,column_list_(column_list)
+	,offset_list_()
+	,length_used_(0)
+{
+	try {
+		if (!row_count_)
+			throw std::invalid_argument("The row count is 0.");
+		if (row_count_ > MFStoreSection::MaxElementValue)
+			throw std::invalid_argument("The row count (" +
+				std::to_string(row_count_) + ") exceeds the maximum "
+				"permissible (" + std::to_string(MFStoreSection::MaxElementValue) +
+				").");
+		if (column_list_.empty())
+			throw std::invalid_argument("The column list is empty.");
+		for (std::size_t column_index = 0; column_index < column_list_.size();
+			++column_index) {
+			const MFStoreColumnSpec &column = column_list_[column_index];
+			if (column.column_name_.empty())
+				throw std::invalid_argument("The name of the column at index " +
+					std::to_string(column_index) + " is empty.");
+			if (!column.column_width_)
+				throw std::invalid_argument("The width of column '" +
+					column.column_name_ + "' is 0.");
+			for (std::size_t other_index = 0; other_index < column_index;
+				++other_index) {
+				if (column_list_[other_index].column_name_ == column.column_name_)
+					throw std::invalid_argument("The column name '" +
+						column.column_name_ + "' appears more than once.");
+			}
+			uint64_t column_offset = MLB::Utility::GranularRoundUp(length_used_,
+				ColumnAlignment);
+			offset_list_.push_back(column_offset);
+			length_used_ = column_offset + (column.column_width_ * row_count_);
+		}
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to construct a columnar section "
+			"layout: " + std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreColumnLayout::GetRowCount() const
+{
+	return(row_count_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreColumnLayout::GetColumnCount() const
+{
+	return(column_list_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreColumnSpec &MFStoreColumnLayout::GetColumnSpec(
+	std::size_t column_index) const
+{
+	CheckColumnIndex(column_index);
+
+	return(column_list_[column_index]);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreColumnLayout::GetColumnOffset(std::size_t column_index) const
+{
+	CheckColumnIndex(column_index);
+
+	return(offset_list_[column_index]);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreColumnLayout::FindColumn(const std::string &column_name)
+	const
+{
+	for (std::size_t column_index = 0; column_index < column_list_.size();
+		++column_index) {
+		if (column_list_[column_index].column_name_ == column_name)
+			return(column_index);
+	}
+
+	throw std::invalid_argument("Column '" + column_name + "' was not found "
+		"in the columnar section layout.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreColumnLayout::GetLengthUsed() const
+{
+	return(length_used_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreColumnLayout::GetRowWidthPadded() const
+{
+	return((length_used_ + (row_count_ - 1)) / row_count_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreColumnLayout::MakeSection(
+	const std::string &description) const
+{
+	return(MFStoreSection(0, GetRowWidthPadded(), row_count_, 0, 0, 0,
+		MFStoreSection::FlagColumnar, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreColumnLayout::CheckSection(const MFStoreSection &section) const
+{
+	if (!(section.section_flags_ & MFStoreSection::FlagColumnar))
+		throw std::invalid_argument("The section is not flagged as columnar.");
+
+	if (section.element_count_ != row_count_)
+		throw std::invalid_argument("The section element count (" +
+			std::to_string(section.element_count_) + ") is not equal to the "
+			"columnar layout row count (" + std::to_string(row_count_) + ").");
+
+	if (section.CalcLengthUsed() < length_used_)
+		throw std::invalid_argument("The section length (" +
+			std::to_string(section.CalcLengthUsed()) + ") is less than the "
+			"length required by the columnar layout (" +
+			std::to_string(length_used_) + ").");
+
+	if (section.section_offset_ % ColumnAlignment)
+		throw std::invalid_argument("The section offset (" +
+			std::to_string(section.section_offset_) + ") is not aligned on a " +
+			std::to_string(ColumnAlignment) + "-byte boundary.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreColumnLayout::CheckColumnIndex(std::size_t column_index) const
+{
+	if (column_index >= column_list_.size())
+		throw std::invalid_argument("The column index (" +
+			std::to_string(column_index) + ") is not less than the number of "
+			"columns (" + std::to_string(column_list_.size()) + ").");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreColumnar::MFStoreColumnar(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, const MFStoreColumnSpecList &column_list)
+try
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,layout_(mfstore_ctl.GetSectionMapped(section_index).element_count_,
+		column_list)
+	,section_ptr_(nullptr)
+{
+	const MFStoreSection &section = mfstore_ctl.GetSectionMapped(section_index);
+
+	layout_.CheckSection(section);
+
+	section_ptr_ = mfstore_ctl.GetPtr<char>(section.section_offset_);
+}
+catch (const std::exception &except) {
+	throw std::invalid_argument("Unable to use the section at index " +
+		std::to_string(section_index) + " of MFStore file '" +
+		mfstore_ctl.GetFileName() + "' as a columnar section: " +
+		std::string(except.what()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreColumnLayout &MFStoreColumnar::GetLayout() const
+{
+	return(layout_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreColumnar::GetRowCount() const
+{
+	return(layout_.GetRowCount());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void *MFStoreColumnar::GetColumnPtr(std::size_t column_index,
+	std::size_t datum_size, std::size_t datum_alignment) const
+{
+	const MFStoreColumnSpec &column = layout_.GetColumnSpec(column_index);
+
+	if (column.column_width_ != datum_size)
+		throw std::invalid_argument("The width of column '" +
+			column.column_name_ + "' (" + std::to_string(column.column_width_) +
+			") is not equal to the size of the requested type (" +
+			std::to_string(datum_size) + ").");
+
+	if (datum_alignment > MFStoreColumnLayout::ColumnAlignment)
+		throw std::invalid_argument("The alignment of the type requested for "
+			"column '" + column.column_name_ + "' (" +
+			std::to_string(datum_alignment) + ") exceeds the column alignment (" +
+			std::to_string(MFStoreColumnLayout::ColumnAlignment) + ").");
+
+	return(section_ptr_ + layout_.GetColumnOffset(column_index));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/MFStoreColumnScan.hpp>
+
+#include <chrono>
+#include <filesystem>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreColumnar.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreColumnSpecList TEST_ColumnList = {
+	  MFStoreColumnSpec("id",       sizeof(uint64_t))
+	, MFStoreColumnSpec("flag",     sizeof(char))
+	, MFStoreColumnSpec("quantity", sizeof(int32_t))
+	, MFStoreColumnSpec("price",    sizeof(double))
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Columnar(uint64_t row_count)
+{
+	MFStoreColumnLayout layout(row_count, TEST_ColumnList);
+	MFStoreSectionList  section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(layout.MakeSection("Trades"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl  mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreColumnar columnar(mfstore_ctl, 1, TEST_ColumnList);
+		uint64_t       *id_ptr       = columnar.GetColumn<uint64_t>("id");
+		char           *flag_ptr     = columnar.GetColumn<char>("flag");
+		int32_t        *quantity_ptr = columnar.GetColumn<int32_t>("quantity");
+		double         *price_ptr    = columnar.GetColumn<double>("price");
+		for (uint64_t row_index = 0; row_index < row_count; ++row_index) {
+			id_ptr[row_index]       = row_index;
+			flag_ptr[row_index]     = static_cast<char>('A' + (row_index % 3));
+			quantity_ptr[row_index] = static_cast<int32_t>(row_index % 1000) - 500;
+			price_ptr[row_index]    = 100.0 + static_cast<double>(row_index % 50);
+		}
+		for (std::size_t column_index = 0;
+			column_index < layout.GetColumnCount(); ++column_index) {
+			if (layout.GetColumnOffset(column_index) %
+				MFStoreColumnLayout::ColumnAlignment)
+				throw std::logic_error("A column is not aligned.");
+		}
+	}
+
+	{
+		MFStoreControl         mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		const MFStoreColumnar  columnar(mfstore_ctl, 1, TEST_ColumnList);
+		const int32_t         *quantity_ptr =
+			columnar.GetColumn<int32_t>("quantity");
+		const double          *price_ptr    =
+			columnar.GetColumn<double>("price");
+		MFStoreColumnBitmap    row_bitmap;
+		auto                   time_start   = std::chrono::steady_clock::now();
+		uint64_t               match_count  = ColumnFilter(quantity_ptr,
+			row_count, MFStoreColumnOp::GreaterEqual, 0, row_bitmap);
+		double                 price_sum    = ColumnSumSelected(price_ptr,
+			row_count, row_bitmap);
+		auto                   time_end     = std::chrono::steady_clock::now();
+		if (ColumnMin(quantity_ptr, row_count) != -500)
+			throw std::logic_error("The minimum quantity is incorrect.");
+		if (ColumnMax(price_ptr, row_count) !=
+			(100.0 + static_cast<double>(std::min<uint64_t>(row_count - 1, 49))))
+			throw std::logic_error("The maximum price is incorrect.");
+		if (match_count != ((row_count / 1000) * 500) +
+			((row_count % 1000) > 500 ? ((row_count % 1000) - 500) : 0))
+			throw std::logic_error("The filtered row count is incorrect.");
+		std::cout << "Columnar section of " << row_count << " rows (" <<
+			layout.GetRowWidthPadded() << " bytes per row): " << match_count <<
+			" rows with quantity >= 0, price sum " << std::fixed << price_sum <<
+			", in " << std::chrono::duration_cast<std::chrono::microseconds>(
+			time_end - time_start).count() << " us" << std::endl;
+		bool detected = false;
+		try {
+			columnar.GetColumn<int64_t>("quantity");
+		}
+		catch (const std::exception &) {
+			detected = true;
+		}
+		if (!detected)
+			throw std::logic_error("A column type size mismatch was not "
+				"detected.");
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Columnar(1);
+		TEST_Columnar(1001);
+		TEST_Columnar(1000000);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -28,6 +28,13 @@
 #include <MFStore/CheckValues.hpp>
 
 #include <Utility/ArgCheck.hpp>
+#include <Utility/PageSize.hpp>
+
+#include <cstring>
+
+#ifdef __linux__
+# include <sys/mman.h>
+#endif // #ifdef __linux__
 
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +50,9 @@ MFStoreControl::MFStoreControl()
 	,file_size_(0)
 	,mmap_size_(0)
 	,alloc_gran_(0)
+	,section_list_()
+	,map_policy_()
+	,numa_replica_map_()
 {
 }
 // ////////////////////////////////////////////////////////////////////////////
@@ -50,7 +60,7 @@ MFStoreControl::MFStoreControl()
 // ////////////////////////////////////////////////////////////////////////////
 MFStoreControl::MFStoreControl(const std::string &file_name, bool is_writer,
 	MFStoreLen file_size, MFStoreLen mmap_size, MFStoreLen alloc_gran,
-	const MFStoreSectionList &section_list)
+	const MFStoreSectionList &section_list, const MFStoreMapPolicy &map_policy)
 try
 	:mapping_sptr_()
 	,region_sptr_()
@@ -59,6 +69,8 @@ try
 	,mmap_size_(0)
 	,alloc_gran_(0)
 	,section_list_(section_list)
+	,map_policy_(map_policy)
+	,numa_replica_map_()
 {
 	using namespace boost::interprocess;
 
@@ -66,12 +78,32 @@ try
 
 	CheckInitialFileAndMmapSizes(file_size, mmap_size, alloc_gran);
 
+	/*
+		Pre-faulting of the entire mapping by readers is best performed by the
+		kernel at mmap() time. MAP_POPULATE leaves the pages of a shared file
+		mapping write-protected, however, so writers pre-fault afterwards by
+		way of MFStoreMapPolicy::Apply() (which uses MADV_POPULATE_WRITE).
+	*/
+	map_options_t    map_options = default_map_options;
+	MFStoreMapPolicy post_policy(map_policy);
+
+#ifdef MAP_POPULATE
+	if (map_policy.pre_fault_ && (!is_writer)) {
+		map_options            = MAP_POPULATE;
+		post_policy.pre_fault_ = false;
+	}
+#endif // #ifdef MAP_POPULATE
+
 	FileMappingSPtr  mapping_sptr(
 		std::make_shared<FileMapping>(file_name.c_str(),
 			(is_writer) ? read_write : read_only));
 	MappedRegionSPtr region_sptr(
 		std::make_shared<MappedRegion>(*mapping_sptr,
-			(is_writer) ? read_write : read_only, 0, mmap_size));
+			(is_writer) ? read_write : read_only, 0, mmap_size, nullptr,
+			map_options));
+
+	MFStoreMapPolicy::Apply(region_sptr->get_address(), mmap_size,
+		post_policy, is_writer);
 
 	mapping_sptr_.swap(mapping_sptr);
 	region_sptr_.swap(region_sptr);
@@ -204,6 +236,13 @@ void MFStoreControl::SetSectionList(const MFStoreSectionList &src)
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreMapPolicy &MFStoreControl::GetMapPolicy() const
+{
+	return(map_policy_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 void MFStoreControl::CheckSectionList() const
 {
@@ -221,6 +260,248 @@ void MFStoreControl::CheckSectionList(const MFStoreSectionList &section_list)
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::ApplyMapPolicy(const MFStoreMapPolicy &map_policy)
+{
+	CheckIsActive();
+
+	MFStoreMapPolicy::Apply(GetMmapAddress(), mmap_size_, map_policy,
+		IsWriter());
+
+	map_policy_ = map_policy;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::ApplyMapPolicy(std::size_t section_index,
+	const MFStoreMapPolicy &map_policy)
+{
+	const MFStoreSection &section = GetSectionMapped(section_index);
+
+	try {
+		MFStoreMapPolicy::Apply(GetPtr<char>(section.section_offset_),
+			section.length_padded_, map_policy, IsWriter());
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to apply the mapping policy to the "
+			"section at index " + std::to_string(section_index) + " ('" +
+			std::string(section.description_) + "'): " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::ApplyMapPolicy(
+	const MFStoreSectionPolicyList &policy_list)
+{
+	for (const auto &this_policy : policy_list)
+		ApplyMapPolicy(this_policy.first, this_policy.second);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Applying any mode other than Replicate to a section discards its
+	replicas, if any.
+*/
+void MFStoreControl::ApplyNumaPolicy(std::size_t section_index,
+	const MFStoreNumaPolicy &numa_policy)
+{
+	const MFStoreSection &section = GetSectionMapped(section_index);
+
+	try {
+		if (numa_policy.mode_ == MFStoreNumaMode::Replicate)
+			numa_replica_map_[section_index] =
+				std::make_shared<MFStoreNumaReplica>(
+				GetPtr<char>(section.section_offset_), section.length_padded_,
+				numa_policy.node_list_);
+		else {
+			numa_replica_map_.erase(section_index);
+			MFStoreNumaPolicy::Apply(GetPtr<char>(section.section_offset_),
+				section.length_padded_, numa_policy);
+		}
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to apply the NUMA policy to the "
+			"section at index " + std::to_string(section_index) + " ('" +
+			std::string(section.description_) + "'): " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::ApplyNumaPolicy(
+	const MFStoreSectionNumaPolicyList &policy_list)
+{
+	for (const auto &this_policy : policy_list)
+		ApplyNumaPolicy(this_policy.first, this_policy.second);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::RefreshNumaReplicas()
+{
+	for (auto &this_replica : numa_replica_map_)
+		this_replica.second->Refresh();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaPlacement MFStoreControl::GetNumaPlacement(
+	std::size_t section_index) const
+{
+	const MFStoreSection &section = GetSectionMapped(section_index);
+
+	return(MFStoreNumaPlacement::Get(GetPtr<char>(section.section_offset_),
+		section.length_padded_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreNumaReplica *MFStoreControl::GetNumaReplica(
+	std::size_t section_index) const
+{
+	auto iter_f = numa_replica_map_.find(section_index);
+
+	return((iter_f == numa_replica_map_.end()) ? nullptr :
+		iter_f->second.get());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreSection &MFStoreControl::GetSectionMapped(
+	std::size_t section_index) const
+{
+	CheckIsActive();
+
+	if (section_index >= section_list_.size())
+		throw std::invalid_argument("The specified section index (" +
+			std::to_string(section_index) + ") is not less than the number of "
+			"sections in the MFStore section list (" +
+			std::to_string(section_list_.size()) + ").");
+
+	const MFStoreSection &section = section_list_[section_index];
+
+	if ((section.section_offset_ + section.length_padded_) > mmap_size_)
+		throw std::invalid_argument("The section at index " +
+			std::to_string(section_index) + " ('" +
+			std::string(section.description_) + "') at offset " +
+			std::to_string(section.section_offset_) + " with a padded length "
+			"of " + std::to_string(section.length_padded_) + " bytes is not "
+			"wholly within the mapped region of " + std::to_string(mmap_size_) +
+			" bytes.");
+
+	return(section);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::Flush(bool async)
+{
+	Flush(0, mmap_size_, async);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::Flush(MFStoreOff offset, MFStoreLen length, bool async)
+{
+	CheckIsActive();
+
+	if (!length)
+		return;
+
+	CheckExtent(mmap_size_, offset, length);
+
+	/*
+		The mapped_region flush() passes the address through to msync(),
+		which requires that it lie on a page boundary.
+	*/
+	MFStoreOff page_offset = offset % MLB::Utility::GetPageSize();
+
+	if (!region_sptr_->flush(static_cast<std::size_t>(offset - page_offset),
+		static_cast<std::size_t>(length + page_offset), async))
+		throw std::runtime_error("Attempt to " +
+			std::string((async) ? "asynchronously" : "synchronously") +
+			" flush the " + std::to_string(length) + " bytes at offset " +
+			std::to_string(offset) + " of MFStore file '" + file_name_ +
+			"' failed.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::FlushSection(std::size_t section_index, bool async)
+{
+	const MFStoreSection &section = GetSectionMapped(section_index);
+
+	Flush(section.section_offset_, section.length_padded_, async);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreControl::WriteSectionList(std::size_t section_list_index)
+{
+	try {
+		CheckIsWriter();
+		MFStoreSection::CheckSectionList(section_list_index, section_list_,
+			alloc_gran_);
+		const MFStoreSection &section = GetSectionMapped(section_list_index);
+		::memcpy(GetPtr<char>(section.section_offset_), section_list_.data(),
+			section_list_.size() * sizeof(MFStoreSection));
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to write the section list to the "
+			"section at index " + std::to_string(section_list_index) + " of "
+			"MFStore file '" + file_name_ + "': " + std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Replaces the section list with that persisted in the mapping, which must
+	describe the same layout as the current one.
+*/
+void MFStoreControl::ReadSectionList(std::size_t section_list_index)
+{
+	try {
+		MFStoreSection::CheckSectionList(section_list_index, section_list_,
+			alloc_gran_);
+		const MFStoreSection &section  = GetSectionMapped(section_list_index);
+		const MFStoreSection *list_ptr =
+			GetPtr<MFStoreSection>(section.section_offset_);
+		MFStoreSectionList    tmp_list(list_ptr,
+			list_ptr + section_list_.size());
+		MFStoreSection::CheckSectionList(section_list_index, tmp_list,
+			alloc_gran_);
+		for (std::size_t section_idx = 0; section_idx < tmp_list.size();
+			++section_idx) {
+			const MFStoreSection &expected = section_list_[section_idx];
+			const MFStoreSection &actual   = tmp_list[section_idx];
+			if ((actual.element_size_ != expected.element_size_) ||
+				(actual.element_count_ != expected.element_count_) ||
+				::strcmp(actual.description_, expected.description_))
+				throw std::invalid_argument("The persisted section at index " +
+					std::to_string(section_idx) + " ('" +
+					std::string(actual.description_) + "' with " +
+					std::to_string(actual.element_count_) + " elements of " +
+					std::to_string(actual.element_size_) + " bytes) does not "
+					"match the expected section ('" +
+					std::string(expected.description_) + "' with " +
+					std::to_string(expected.element_count_) + " elements of " +
+					std::to_string(expected.element_size_) + " bytes).");
+		}
+		section_list_.swap(tmp_list);
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to read the section list from the "
+			"section at index " + std::to_string(section_list_index) + " of "
+			"MFStore file '" + file_name_ + "': " + std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 } // namespace MFStore
 
 } // namespace MLB
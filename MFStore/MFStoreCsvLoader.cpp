@@ -0,0 +1,739 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreCsvLoader.cpp
+
+   File Description  :  Implementation of the MFStoreCsvLoader class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreCsvLoader.hpp>
+#include <MFStore/MFStoreParallel.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <chrono>
+#include <climits>
+#include <filesystem>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+/// Files smaller than this are loaded by fewer threads.
+const uint64_t MinBytesPerChunk = 1ULL << 18;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Outside of a quote the quote state is zero; within one it is one more
+	than the index in the quote character list of the character which opened
+	it. Doubled quotes within a quoted value leave and re-enter the quote, and
+	so need no special handling.
+*/
+const unsigned int QuoteNone = 0;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/// The quote characters recognized by ParseCsvControl::GetValueEnd().
+std::string GetQuoteCharList(const MLB::Utility::ParseCsvControl &parse_control)
+{
+	std::string quote_char_list;
+
+	for (int this_char = CHAR_MIN; this_char <= CHAR_MAX; ++this_char) {
+		if (parse_control.IsQuoteChar(static_cast<char>(this_char)))
+			quote_char_list += static_cast<char>(this_char);
+	}
+
+	return(quote_char_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/// The character appended to a final record not followed by a line separator.
+char GetLineSepChar(const MLB::Utility::ParseCsvControl &parse_control)
+{
+	for (int this_char = CHAR_MIN; this_char <= CHAR_MAX; ++this_char) {
+		if (parse_control.IsLineSep(static_cast<char>(this_char)))
+			return(static_cast<char>(this_char));
+	}
+
+	throw std::invalid_argument("The CSV parser recognizes no line separator.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline unsigned int NextQuoteState(
+	const MLB::Utility::ParseCsvControl &parse_control,
+	const std::string &quote_char_list, unsigned int quote_state,
+	char this_char)
+{
+	if (!parse_control.IsQuoteChar(this_char))
+		return(quote_state);
+
+	if (quote_state == QuoteNone)
+		return(static_cast<unsigned int>(quote_char_list.find(this_char)) + 1);
+
+	return((this_char == quote_char_list[quote_state - 1]) ? QuoteNone :
+		quote_state);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/// A line is empty if it contains nothing but an optional carriage return.
+inline bool IsEmptyLine(const MLB::Utility::ParseCsvControl &parse_control,
+	const char *line_ptr, const char *end_ptr)
+{
+	return((line_ptr == end_ptr) || parse_control.IsLineSep(*line_ptr) ||
+		(parse_control.IsCrLfEnabled() && (*line_ptr == '\r') &&
+		(((line_ptr + 1) == end_ptr) || parse_control.IsLineSep(line_ptr[1]))));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t ElapsedUSecs(const std::chrono::steady_clock::time_point &start_time)
+{
+	return(static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreCsvLoadStats::MFStoreCsvLoadStats()
+	:byte_count_(0)
+	,record_count_(0)
+	,chunk_count_(0)
+	,thread_count_(0)
+	,scan_usecs_(0)
+	,load_usecs_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreCsvLoadStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Bytes=" << byte_count_
+		<< ", Records=" << record_count_
+		<< ", Chunks=" << chunk_count_
+		<< ", Threads=" << thread_count_
+		<< ", ScanMicroseconds=" << scan_usecs_
+		<< ", LoadMicroseconds=" << load_usecs_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreCsvLoader::MFStoreCsvLoader(const std::string &file_name,
+	const MLB::Utility::ParseCsvControl &parse_control,
+	uint64_t header_record_count, unsigned int thread_count)
+try
+	:file_name_(MLB::Utility::ThrowIfEmpty(file_name, "The CSV file name"))
+	,parse_control_(parse_control)
+	,quote_char_list_(GetQuoteCharList(parse_control_))
+	,line_sep_char_(GetLineSepChar(parse_control_))
+	,header_record_count_(header_record_count)
+	,thread_count_(0)
+	,file_mapping_()
+	,region_()
+	,file_ptr_(nullptr)
+	,file_size_(std::filesystem::file_size(file_name))
+	,tail_offset_(file_size_)
+	,chunk_list_()
+	,scan_usecs_(0)
+{
+	auto start_time = std::chrono::steady_clock::now();
+
+	thread_count_ = ResolveThreadCount(thread_count, file_size_,
+		MinBytesPerChunk);
+
+	if (file_size_) {
+		using namespace boost::interprocess;
+		FileMapping(file_name_.c_str(), read_only).swap(file_mapping_);
+		MappedRegion(file_mapping_, read_only, 0,
+			static_cast<std::size_t>(file_size_)).swap(region_);
+		region_.advise(MappedRegion::advice_sequential);
+		file_ptr_ = static_cast<const char *>(region_.get_address());
+	}
+
+	ScanChunks();
+
+	if (GetRecordCount() > MFStoreSection::MaxElementValue)
+		throw std::invalid_argument("The file contains " +
+			std::to_string(GetRecordCount()) + " records, which is more than "
+			"the maximum number of elements in a section (" +
+			std::to_string(MFStoreSection::MaxElementValue) + ").");
+
+	scan_usecs_ = ElapsedUSecs(start_time);
+}
+catch (const std::exception &except) {
+	throw std::runtime_error("Unable to prepare CSV file '" + file_name +
+		"' for loading: " + std::string(except.what()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &MFStoreCsvLoader::GetFileName() const
+{
+	return(file_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreCsvLoader::GetFileSize() const
+{
+	return(file_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreCsvLoader::GetRecordCount() const
+{
+	uint64_t record_count = (chunk_list_.empty()) ? 0 :
+		(chunk_list_.back().first_record_ + chunk_list_.back().record_count_);
+
+	return((record_count > header_record_count_) ?
+		(record_count - header_record_count_) : 0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreCsvLoader::GetChunkCount() const
+{
+	return(chunk_list_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreCsvLoader::MakeSection(uint64_t element_size,
+	const std::string &description) const
+{
+	return(MFStoreSection(0, element_size,
+		std::max<uint64_t>(1, GetRecordCount()), 0, 0, 0, 0, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreCsvLoadStats MFStoreCsvLoader::Load(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, const MFStoreCsvConvertFunc &convert_func,
+	std::size_t column_count) const
+{
+	MFStoreCsvLoadStats stats;
+
+	try {
+		auto start_time = std::chrono::steady_clock::now();
+		if (!convert_func)
+			throw std::invalid_argument("The conversion function is empty.");
+		mfstore_ctl.CheckIsWriter();
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.element_count_ < GetRecordCount())
+			throw std::invalid_argument("The section has " +
+				std::to_string(section.element_count_) + " elements, but the file "
+				"contains " + std::to_string(GetRecordCount()) + " records.");
+		char       *section_ptr  =
+			mfstore_ctl.GetPtr<char>(section.section_offset_);
+		std::size_t element_size =
+			static_cast<std::size_t>(section.element_size_);
+		MFStoreParallelFor(chunk_list_.size(), thread_count_,
+			[&](unsigned int, uint64_t first_chunk, uint64_t chunk_count) {
+				for (uint64_t chunk_index = first_chunk;
+					chunk_index < (first_chunk + chunk_count); ++chunk_index) {
+					const Chunk &chunk        = chunk_list_[chunk_index];
+					uint64_t     record_index = chunk.first_record_;
+					uint64_t     record_count = chunk.record_count_;
+					uint64_t     end_offset   =
+						std::min(chunk.end_offset_, tail_offset_);
+					if (chunk.begin_offset_ < end_offset)
+						LoadRecords(std::string_view(file_ptr_ +
+							chunk.begin_offset_, end_offset - chunk.begin_offset_),
+							chunk.begin_offset_, record_index, record_count,
+							section_ptr, element_size, convert_func, column_count);
+					/*
+						The parser requires that a record end with a line
+						separator, so a final record which doesn't is copied.
+					*/
+					if (record_count && (tail_offset_ >= chunk.begin_offset_) &&
+						(tail_offset_ < chunk.end_offset_)) {
+						std::string tail_record(file_ptr_ + tail_offset_,
+							file_size_ - tail_offset_);
+						tail_record += line_sep_char_;
+						LoadRecords(tail_record, tail_offset_, record_index,
+							record_count, section_ptr, element_size, convert_func,
+							column_count);
+					}
+					if (record_count)
+						throw std::logic_error("The CSV data at file offset " +
+							std::to_string(chunk.begin_offset_) + " ended " +
+							std::to_string(record_count) + " records before "
+							"expected.");
+				}
+			});
+		stats.byte_count_   = file_size_;
+		stats.record_count_ = GetRecordCount();
+		stats.chunk_count_  = chunk_list_.size();
+		stats.thread_count_ = thread_count_;
+		stats.scan_usecs_   = scan_usecs_;
+		stats.load_usecs_   = ElapsedUSecs(start_time);
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to load CSV file '" + file_name_ +
+			"' into the section at index " + std::to_string(section_index) +
+			" of MFStore file '" + mfstore_ctl.GetFileName() + "': " +
+			std::string(except.what()));
+	}
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Chunks are first given equal byte ranges. Each range is scanned from
+	every quote state to find the state at its end given the state at its
+	start. Chaining those from the start of the file yields the actual quote
+	state at the start of each range, after which a chunk is adjusted to
+	begin at the first line to start within its range and its records are
+	counted.
+*/
+void MFStoreCsvLoader::ScanChunks()
+{
+	std::size_t chunk_count = (file_size_) ? thread_count_ : 0;
+	uint64_t    chunk_bytes = (file_size_) ? (file_size_ / chunk_count) : 0;
+	std::size_t state_count = quote_char_list_.size() + 1;
+
+	std::vector<std::vector<unsigned int>> end_state_list(chunk_count);
+	std::vector<unsigned int>              start_state_list(chunk_count,
+		QuoteNone);
+
+	chunk_list_.assign(chunk_count, Chunk());
+
+	for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+		chunk_list_[chunk_index].begin_offset_ = chunk_index * chunk_bytes;
+		chunk_list_[chunk_index].end_offset_   =
+			((chunk_index + 1) < chunk_count) ?
+			((chunk_index + 1) * chunk_bytes) : file_size_;
+	}
+
+	// The state at the end of the last chunk isn't needed.
+	MFStoreParallelFor((chunk_count) ? (chunk_count - 1) : 0, thread_count_,
+		[&](unsigned int, uint64_t first_chunk, uint64_t count) {
+			for (uint64_t chunk_index = first_chunk;
+				chunk_index < (first_chunk + count); ++chunk_index) {
+				const Chunk               &chunk      = chunk_list_[chunk_index];
+				std::vector<unsigned int> &state_list =
+					end_state_list[chunk_index];
+				const char                *end_ptr    =
+					file_ptr_ + chunk.end_offset_;
+				state_list.resize(state_count);
+				for (std::size_t state_index = 0; state_index < state_count;
+					++state_index)
+					state_list[state_index] =
+						static_cast<unsigned int>(state_index);
+				for (const char *this_ptr = file_ptr_ + chunk.begin_offset_;
+					this_ptr < end_ptr; ++this_ptr) {
+					if (parse_control_.IsQuoteChar(*this_ptr)) {
+						for (auto &this_state : state_list)
+							this_state = NextQuoteState(parse_control_,
+								quote_char_list_, this_state, *this_ptr);
+					}
+				}
+			}
+		});
+
+	for (std::size_t chunk_index = 1; chunk_index < chunk_count; ++chunk_index)
+		start_state_list[chunk_index] = end_state_list[chunk_index - 1]
+			[start_state_list[chunk_index - 1]];
+
+	const char *file_end_ptr = file_ptr_ + file_size_;
+
+	MFStoreParallelFor(chunk_count, thread_count_,
+		[&](unsigned int, uint64_t first_chunk, uint64_t count) {
+			for (uint64_t chunk_index = first_chunk;
+				chunk_index < (first_chunk + count); ++chunk_index) {
+				Chunk        &chunk       = chunk_list_[chunk_index];
+				unsigned int  quote_state = start_state_list[chunk_index];
+				const char   *this_ptr    = file_ptr_ + chunk.begin_offset_;
+				const char   *end_ptr     = file_ptr_ + chunk.end_offset_;
+				// Find the start of the first line which starts in the range...
+				if (chunk_index && ((quote_state != QuoteNone) ||
+					(!parse_control_.IsLineSep(this_ptr[-1])))) {
+					while (this_ptr < file_end_ptr) {
+						char this_char = *this_ptr++;
+						if ((quote_state == QuoteNone) &&
+							parse_control_.IsLineSep(this_char))
+							break;
+						quote_state = NextQuoteState(parse_control_,
+							quote_char_list_, quote_state, this_char);
+					}
+				}
+				// ... and count the non-empty lines which start in the range.
+				chunk.begin_offset_ = static_cast<uint64_t>(this_ptr - file_ptr_);
+				while (this_ptr < end_ptr) {
+					const char *line_ptr = this_ptr;
+					if (!IsEmptyLine(parse_control_, line_ptr, file_end_ptr))
+						++chunk.record_count_;
+					while (this_ptr < file_end_ptr) {
+						char this_char = *this_ptr++;
+						if ((quote_state == QuoteNone) &&
+							parse_control_.IsLineSep(this_char))
+							break;
+						quote_state = NextQuoteState(parse_control_,
+							quote_char_list_, quote_state, this_char);
+					}
+					if ((this_ptr == file_end_ptr) &&
+						(!parse_control_.IsLineSep(this_ptr[-1])))
+						tail_offset_ = static_cast<uint64_t>(line_ptr - file_ptr_);
+				}
+			}
+		});
+
+	uint64_t first_record = 0;
+
+	for (std::size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+		Chunk &chunk = chunk_list_[chunk_index];
+		chunk.end_offset_   = ((chunk_index + 1) < chunk_count) ?
+			chunk_list_[chunk_index + 1].begin_offset_ : file_size_;
+		chunk.first_record_ = first_record;
+		first_record       += chunk.record_count_;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Parses records from the source data until it has loaded \e record_count
+	of them or reached the end of the data, updating \e record_index and
+	\e record_count as it goes.
+*/
+void MFStoreCsvLoader::LoadRecords(std::string_view src_data,
+	uint64_t src_offset, uint64_t &record_index, uint64_t &record_count,
+	char *section_ptr, std::size_t element_size,
+	const MFStoreCsvConvertFunc &convert_func, std::size_t column_count) const
+{
+	MLB::Utility::ParseCsvState    parse_state(src_data);
+	MLB::Utility::ParseCsvPosition current_pos;
+	MLB::Utility::ParseCsvColList  col_list;
+	const char                    *end_ptr = src_data.data() + src_data.size();
+
+	while (record_count) {
+		uint64_t line_offset = parse_state.GetPosition().row_off_;
+		if (line_offset >= src_data.size())
+			break;
+		try {
+			if (!parse_state.ParseCsvLine(parse_control_, current_pos, col_list))
+				break;
+			if (IsEmptyLine(parse_control_, src_data.data() + line_offset,
+				end_ptr))
+				continue;
+			--record_count;
+			if (record_index++ < header_record_count_)
+				continue;
+			if (column_count && (col_list.size() != column_count))
+				throw std::invalid_argument("The record has " +
+					std::to_string(col_list.size()) + " columns, but " +
+					std::to_string(column_count) + " columns were expected.");
+			uint64_t element_index = record_index - header_record_count_ - 1;
+			convert_func(col_list, section_ptr + (element_index * element_size),
+				element_index);
+		}
+		catch (const std::exception &except) {
+			throw std::runtime_error("Error in the CSV record at file offset " +
+				std::to_string(src_offset + line_offset) + ": " +
+				std::string(except.what()));
+		}
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreCsvLoader::CheckElementSize(const MFStoreControl &mfstore_ctl,
+	std::size_t section_index, std::size_t element_size) const
+{
+	const MFStoreSection &section = mfstore_ctl.GetSectionMapped(section_index);
+
+	if (section.element_size_ != element_size)
+		throw std::invalid_argument("Unable to load CSV file '" + file_name_ +
+			"' into the section at index " + std::to_string(section_index) +
+			" of MFStore file '" + mfstore_ctl.GetFileName() + "' because its "
+			"element size (" + std::to_string(section.element_size_) +
+			") differs from the size of the target type (" +
+			std::to_string(element_size) + ").");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreCsvLoadStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <fstream>
+#include <tuple>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreCsvLoader.bin");
+const std::string TEST_CsvName("./TEST_MAIN.MFStoreCsvLoader.csv");
+const uint64_t    TEST_RecordCount = 1000000;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Security
+{
+	uint64_t security_id_;
+	double   price_;
+	uint32_t lot_size_;
+	uint32_t flags_;
+	char     symbol_[16];
+	char     name_[40];
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string TEST_MakeName(uint64_t record_index)
+{
+	std::string name("Security " + std::to_string(record_index));
+
+	if (!(record_index % 7))
+		name += ", Inc.";
+	if (!(record_index % 11))
+		name += "\nClass A";
+	if (!(record_index % 13))
+		name += " \"Pref\"";
+
+	return(name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Names are quoted and may contain commas, line separators and doubled
+	quotes. Some records end with CR/LF, some are followed by empty lines and
+	the final record has no line separator.
+*/
+void TEST_WriteCsv()
+{
+	std::ofstream o_file(TEST_CsvName, std::ios::binary | std::ios::trunc);
+
+	o_file << "SecurityId,Price,LotSize,Flags,Symbol,Name\n";
+
+	for (uint64_t record_index = 0; record_index < TEST_RecordCount;
+		++record_index) {
+		std::string name(TEST_MakeName(record_index));
+		std::string quoted_name;
+		for (char this_char : name) {
+			quoted_name += this_char;
+			if (this_char == '"')
+				quoted_name += '"';
+		}
+		o_file << (record_index + 1000) << ',' << (record_index % 1000) <<
+			".25," << (((record_index % 4) + 1) * 100) << ',' <<
+			(record_index % 3) << ",SYM" << record_index << ",\"" <<
+			quoted_name << '"';
+		if ((record_index + 1) == TEST_RecordCount)
+			break;
+		o_file << ((record_index % 5) ? "\n" : "\r\n");
+		if (!(record_index % 101))
+			o_file << "\n";
+	}
+
+	if (!o_file)
+		throw std::runtime_error("Unable to write the test CSV file.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_ConvertSecurity(const MLB::Utility::ParseCsvColList &col_list,
+	TEST_Security &security)
+{
+	CsvToValue(col_list[0], security.security_id_);
+	CsvToValue(col_list[1], security.price_);
+	CsvToValue(col_list[2], security.lot_size_);
+	CsvToValue(col_list[3], security.flags_);
+	CsvToChars(col_list[4], security.symbol_);
+	CsvToChars(col_list[5], security.name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CheckSecurities(const MFStoreControl &mfstore_ctl)
+{
+	const TEST_Security *security_ptr =
+		mfstore_ctl.GetSectionPtrLocal<TEST_Security>(2);
+
+	for (uint64_t record_index = 0; record_index < TEST_RecordCount;
+		++record_index) {
+		const TEST_Security &security = security_ptr[record_index];
+		std::string          symbol("SYM" + std::to_string(record_index));
+		if ((security.security_id_ != (record_index + 1000)) ||
+			(security.price_ != (static_cast<double>(record_index % 1000) +
+			0.25)) || (security.lot_size_ != (((record_index % 4) + 1) * 100)) ||
+			(security.flags_ != (record_index % 3)) ||
+			(symbol != security.symbol_) ||
+			(TEST_MakeName(record_index) != std::string(security.name_,
+			::strnlen(security.name_, sizeof(security.name_)))))
+			throw std::logic_error("The element at index " +
+				std::to_string(record_index) + " doesn't match its CSV record.");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Load(unsigned int thread_count)
+{
+	MLB::Utility::ParseCsvControl parse_control(",", "\n", true, 1);
+	MFStoreCsvLoader              loader(TEST_CsvName, parse_control, 1,
+		thread_count);
+
+	if (loader.GetRecordCount() != TEST_RecordCount)
+		throw std::logic_error("The loader counted " +
+			std::to_string(loader.GetRecordCount()) + " records, but " +
+			std::to_string(TEST_RecordCount) + " were written.");
+
+	MFStoreSectionList section_list;
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(MFStoreSection), 3,
+		0, 0, 0, 0, 0, "SectionList"), section_list);
+	MFStoreSection::AppendSection(loader.MakeSection(sizeof(TEST_Security),
+		"Securities"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	MFStoreControl      mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreCsvLoadStats stats = loader.LoadAs<TEST_Security>(mfstore_ctl, 2,
+		TEST_ConvertSecurity, 6);
+
+	TEST_CheckSecurities(mfstore_ctl);
+
+	std::cout << "Loaded with " << thread_count << " thread(s): " << stats <<
+		std::endl;
+
+	bool rejected_flag = false;
+	try {
+		loader.Load(mfstore_ctl, 2,
+			[](const MLB::Utility::ParseCsvColList &, void *, uint64_t) { }, 5);
+	}
+	catch (const std::exception &except) {
+		rejected_flag = true;
+		if (thread_count == 1)
+			std::cout << "Incorrect column count rejected: " << except.what() <<
+				std::endl;
+	}
+	if (!rejected_flag)
+		throw std::logic_error("Records with an incorrect number of columns "
+			"were accepted.");
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_SmallFiles()
+{
+	// Without CR/LF a line holding only a carriage return isn't empty...
+	const std::vector<std::tuple<std::string, bool, uint64_t>> test_list = {
+		{ "",                       true,  0 },
+		{ "\n\n",                   true,  0 },
+		{ "A,B",                    true,  1 },
+		{ "A,B\n",                  true,  1 },
+		{ "A,B\r\n\r\nC,D\r",       true,  2 },
+		{ "A,B\r\n\r\nC,D\r",       false, 3 },
+		{ "'x\ny',B\n\"z\"\n\nC",   true,  3 }
+	};
+
+	for (const auto &this_test : test_list) {
+		{
+			std::ofstream o_file(TEST_CsvName, std::ios::binary | std::ios::trunc);
+			o_file << std::get<0>(this_test);
+		}
+		MFStoreCsvLoader loader(TEST_CsvName, MLB::Utility::ParseCsvControl(",",
+			"\n", std::get<1>(this_test), 1), 0, 4);
+		if (loader.GetRecordCount() != std::get<2>(this_test))
+			throw std::logic_error("The loader counted " +
+				std::to_string(loader.GetRecordCount()) + " records in a small "
+				"file, but " + std::to_string(std::get<2>(this_test)) + " were "
+				"expected.");
+	}
+
+	std::cout << "Small file record counts: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_SmallFiles();
+		TEST_WriteCsv();
+		TEST_Load(1);
+		TEST_Load(8);
+		TEST_Load(0);
+		std::filesystem::remove(TEST_CsvName);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
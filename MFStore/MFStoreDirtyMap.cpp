@@ -0,0 +1,231 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreDirtyMap.cpp
+
+   File Description  :  Implementation of the MFStoreDirtyMap class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreDirtyMap.hpp>
+
+#include <MFStore/CheckValues.hpp>
+
+#include <Utility/PageSize.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t BitsPerWord = 64;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen CheckGranule(MFStoreLen granule)
+{
+	if (!granule)
+		return(MLB::Utility::GetPageSize());
+
+	if (granule & (granule - 1))
+		throw std::invalid_argument("The dirty map granule (" +
+			std::to_string(granule) + ") is not a power of two.");
+
+	return(granule);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreDirtyMap::MFStoreDirtyMap(MFStoreLen map_length, MFStoreLen granule)
+	:map_length_(map_length)
+	,granule_(CheckGranule(granule))
+	,granule_count_(static_cast<std::size_t>(
+		(map_length + granule_ - 1) / granule_))
+	,word_count_((granule_count_ + BitsPerWord - 1) / BitsPerWord)
+	,word_list_()
+{
+	if (!map_length)
+		throw std::invalid_argument("The dirty map length is 0.");
+
+	word_list_.reset(new WordType[word_count_]);
+
+	Clear();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreDirtyMap::MarkDirty(MFStoreOff offset, MFStoreLen length)
+{
+	if (!length)
+		return;
+
+	CheckExtent(map_length_, offset, length, true);
+
+	std::size_t first_granule = static_cast<std::size_t>(offset / granule_);
+	std::size_t last_granule  =
+		static_cast<std::size_t>((offset + length - 1) / granule_);
+
+	while (first_granule <= last_granule) {
+		std::size_t word_idx  = first_granule / BitsPerWord;
+		std::size_t bit_first = first_granule % BitsPerWord;
+		std::size_t bit_last  = std::min<std::size_t>(BitsPerWord - 1,
+			bit_first + (last_granule - first_granule));
+		uint64_t    bit_mask  = (bit_last == (BitsPerWord - 1)) ?
+			(~uint64_t(0) << bit_first) :
+			(((uint64_t(1) << (bit_last + 1)) - 1) & (~uint64_t(0) << bit_first));
+		/*
+			Always a read-modify-write: skipping it when the bits are seen to
+			be set already could lose the mark to a concurrent Harvest().
+		*/
+		word_list_[word_idx].fetch_or(bit_mask, std::memory_order_release);
+		first_granule += (bit_last - bit_first) + 1;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreDirtyMap::MarkDirtySection(const MFStoreSection &section)
+{
+	MarkDirty(section.section_offset_, section.length_actual_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreDirtyMap::MarkDirtyElements(const MFStoreSection &section,
+	uint64_t element_index, uint64_t element_count)
+{
+	if ((element_index >= section.element_count_) ||
+		(element_count > (section.element_count_ - element_index)))
+		throw std::invalid_argument("The range of " +
+			std::to_string(element_count) + " elements starting at element "
+			"index " + std::to_string(element_index) + " is not wholly within "
+			"the " + std::to_string(section.element_count_) + " elements of "
+			"the section at index " + std::to_string(section.section_index_) +
+			".");
+
+	MarkDirty(section.section_offset_ + (element_index * section.element_size_),
+		element_count * section.element_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreDirtyMap::IsDirty(MFStoreOff offset) const
+{
+	CheckOffset(map_length_, offset, true);
+
+	std::size_t granule_idx = static_cast<std::size_t>(offset / granule_);
+
+	return((word_list_[granule_idx / BitsPerWord].load(
+		std::memory_order_acquire) >> (granule_idx % BitsPerWord)) & 1);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreDirtyMap::IsEmpty() const
+{
+	for (std::size_t word_idx = 0; word_idx < word_count_; ++word_idx) {
+		if (word_list_[word_idx].load(std::memory_order_acquire))
+			return(false);
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreDirtyMap::Harvest(MFStoreRangeList &range_list)
+{
+	range_list.clear();
+
+	MFStoreOff run_start  = 0;
+	MFStoreOff run_end    = 0;
+	bool       in_run     = false;
+
+	for (std::size_t word_idx = 0; word_idx < word_count_; ++word_idx) {
+		if (!word_list_[word_idx].load(std::memory_order_relaxed)) {
+			if (in_run) {
+				range_list.emplace_back(run_start, run_end - run_start);
+				in_run = false;
+			}
+			continue;
+		}
+		uint64_t this_word =
+			word_list_[word_idx].exchange(0, std::memory_order_acq_rel);
+		for (std::size_t bit_idx = 0; bit_idx < BitsPerWord; ++bit_idx) {
+			MFStoreOff granule_offset =
+				((word_idx * BitsPerWord) + bit_idx) * granule_;
+			if ((this_word >> bit_idx) & 1) {
+				if (!in_run) {
+					run_start = granule_offset;
+					in_run    = true;
+				}
+				run_end = std::min(granule_offset + granule_, map_length_);
+			}
+			else if (in_run) {
+				range_list.emplace_back(run_start, run_end - run_start);
+				in_run = false;
+			}
+		}
+	}
+
+	if (in_run)
+		range_list.emplace_back(run_start, run_end - run_start);
+
+	return(range_list.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreDirtyMap::Clear()
+{
+	for (std::size_t word_idx = 0; word_idx < word_count_; ++word_idx)
+		word_list_[word_idx].store(0, std::memory_order_relaxed);
+
+	std::atomic_thread_fence(std::memory_order_release);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreDirtyMap::GetMapLength() const
+{
+	return(map_length_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreDirtyMap::GetGranule() const
+{
+	return(granule_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
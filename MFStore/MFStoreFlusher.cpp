@@ -0,0 +1,449 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreFlusher.cpp
+
+   File Description  :  Implementation of the MFStoreFlusher class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreFlusher.hpp>
+
+#include <Utility/ThrowErrno.hpp>
+
+#ifdef __linux__
+# include <fcntl.h>
+# include <unistd.h>
+#endif // #ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreFlusherStats::MFStoreFlusherStats()
+	:pass_count_(0)
+	,barrier_count_(0)
+	,range_count_(0)
+	,byte_count_(0)
+	,sync_range_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreFlusherStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Passes=" << pass_count_
+		<< ", Barriers=" << barrier_count_
+		<< ", Ranges=" << range_count_
+		<< ", Bytes=" << byte_count_
+		<< ", SyncedRanges=" << sync_range_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreFlusher::MFStoreFlusher(MFStoreControl &mfstore_ctl,
+	const FlushInterval &flush_interval, MFStoreLen granule, bool start_flag)
+	:mfstore_ctl_(mfstore_ctl)
+	,dirty_map_(mfstore_ctl.GetMmapSize(), granule)
+	,unsynced_map_(mfstore_ctl.GetMmapSize(), granule)
+	,range_list_()
+	,unsynced_list_()
+	,flush_mutex_()
+	,stats_()
+	,flush_thread_(flush_interval, [this]() { FlushPass(false); })
+{
+	mfstore_ctl_.CheckIsWriter();
+
+	if (start_flag)
+		Start();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreFlusher::~MFStoreFlusher()
+{
+	try {
+		Stop();
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreFlusher::MarkDirty(MFStoreOff offset, MFStoreLen length)
+{
+	dirty_map_.MarkDirty(offset, length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreFlusher::MarkDirtySection(std::size_t section_index)
+{
+	dirty_map_.MarkDirtySection(mfstore_ctl_.GetSectionMapped(section_index));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreFlusher::MarkDirtyElements(std::size_t section_index,
+	uint64_t element_index, uint64_t element_count)
+{
+	dirty_map_.MarkDirtyElements(mfstore_ctl_.GetSectionMapped(section_index),
+		element_index, element_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreFlusher::Flush(bool barrier)
+{
+	flush_thread_.RethrowException();
+
+	if (barrier || (!IsRunning()))
+		FlushPass(barrier);
+	else
+		flush_thread_.Wake();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreFlusher::Start()
+{
+	flush_thread_.Start();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Stops the background thread and performs a final barrier flush.
+*/
+void MFStoreFlusher::Stop()
+{
+	flush_thread_.Stop();
+
+	flush_thread_.RethrowException();
+
+	FlushPass(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreFlusher::IsRunning() const
+{
+	return(flush_thread_.IsRunning());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreFlusher::FlushInterval MFStoreFlusher::GetFlushInterval() const
+{
+	return(flush_thread_.GetInterval());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreFlusherStats MFStoreFlusher::GetStats() const
+{
+	std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+
+	return(stats_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The flush mutex is held for the entirety of the pass so that a barrier
+	can't complete while ranges harvested by the background thread are still
+	being written.
+
+	Ranges written by the background thread have been handed to the kernel
+	but not made durable, so they're recorded in the unsynced map for the
+	next barrier to msync(MS_SYNC). If a flush fails, the ranges harvested
+	by the pass are returned to the dirty map for a later pass to retry.
+*/
+void MFStoreFlusher::FlushPass(bool barrier)
+{
+	std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+
+	dirty_map_.Harvest(range_list_);
+
+	if (barrier)
+		unsynced_map_.Harvest(unsynced_list_);
+
+	++stats_.pass_count_;
+
+	if (barrier)
+		++stats_.barrier_count_;
+
+	if (range_list_.empty() && ((!barrier) || unsynced_list_.empty()))
+		return;
+
+	try {
+#ifdef __linux__
+		if (!barrier) {
+			MFStoreFileHandle file_handle = mfstore_ctl_.GetFileHandle();
+			// Queue the writeback of every range before waiting on any...
+			for (const auto &this_range : range_list_) {
+				if (::sync_file_range(file_handle,
+					static_cast<off_t>(this_range.offset_),
+					static_cast<off_t>(this_range.length_),
+					SYNC_FILE_RANGE_WRITE) != 0)
+					MLB::Utility::ThrowErrno("Call to ::sync_file_range("
+						"SYNC_FILE_RANGE_WRITE) for the " +
+						std::to_string(this_range.length_) + " bytes at offset " +
+						std::to_string(this_range.offset_) + " failed");
+			}
+			// ... then wait for them to complete.
+			for (const auto &this_range : range_list_) {
+				if (::sync_file_range(file_handle,
+					static_cast<off_t>(this_range.offset_),
+					static_cast<off_t>(this_range.length_),
+					SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+					SYNC_FILE_RANGE_WAIT_AFTER) != 0)
+					MLB::Utility::ThrowErrno("Call to ::sync_file_range("
+						"SYNC_FILE_RANGE_WAIT_AFTER) for the " +
+						std::to_string(this_range.length_) + " bytes at offset " +
+						std::to_string(this_range.offset_) + " failed");
+			}
+		}
+		else
+#endif // #ifdef __linux__
+		{
+			for (const auto &this_range : range_list_)
+				mfstore_ctl_.Flush(this_range.offset_, this_range.length_,
+					!barrier);
+			if (barrier) {
+				for (const auto &this_range : unsynced_list_)
+					mfstore_ctl_.Flush(this_range.offset_, this_range.length_,
+						false);
+			}
+		}
+	}
+	catch (const std::exception &except) {
+		for (const auto &this_range : range_list_)
+			dirty_map_.MarkDirty(this_range.offset_, this_range.length_);
+		if (barrier) {
+			for (const auto &this_range : unsynced_list_)
+				unsynced_map_.MarkDirty(this_range.offset_, this_range.length_);
+		}
+		throw std::runtime_error("Attempt to flush " +
+			std::to_string(range_list_.size()) + " dirty ranges of MFStore "
+			"file '" + mfstore_ctl_.GetFileName() + "' failed: " +
+			std::string(except.what()));
+	}
+
+	if (!barrier) {
+		for (const auto &this_range : range_list_)
+			unsynced_map_.MarkDirty(this_range.offset_, this_range.length_);
+	}
+	else
+		stats_.sync_range_count_ += range_list_.size() + unsynced_list_.size();
+
+	stats_.range_count_ += range_list_.size();
+
+	for (const auto &this_range : range_list_)
+		stats_.byte_count_ += this_range.length_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreFlusherStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <Utility/PageSize.hpp>
+
+#include <filesystem>
+#include <random>
+#include <sstream>
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreFlusher.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_DirtyMapCoalesce()
+{
+	std::size_t      page_size = GetPageSize();
+	MFStoreDirtyMap  dirty_map(256 * page_size);
+	MFStoreRangeList range_list;
+
+	dirty_map.MarkDirty(0, 1);
+	dirty_map.MarkDirty(page_size - 1, 2);
+	dirty_map.MarkDirty(10 * page_size, 70 * page_size);
+	dirty_map.MarkDirty((255 * page_size) + 17, 1);
+
+	if (dirty_map.Harvest(range_list) != 3)
+		throw std::logic_error("Expected 3 coalesced dirty ranges, but "
+			"harvested " + std::to_string(range_list.size()) + ".");
+
+	if ((range_list[0].offset_ != 0) ||
+		 (range_list[0].length_ != (2 * page_size)) ||
+		 (range_list[1].offset_ != (10 * page_size)) ||
+		 (range_list[1].length_ != (70 * page_size)) ||
+		 (range_list[2].offset_ != (255 * page_size)) ||
+		 (range_list[2].length_ != page_size))
+		throw std::logic_error("The harvested dirty ranges are incorrect.");
+
+	if (!dirty_map.IsEmpty())
+		throw std::logic_error("The dirty map is not empty after harvest.");
+
+	std::cout << "Dirty map coalescing: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string TEST_StatsText(const MFStoreFlusherStats &stats)
+{
+	std::ostringstream o_str;
+
+	o_str << stats;
+
+	return(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_BarrierSyncsWrittenRanges(MFStoreLen file_size)
+{
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl  mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran);
+		MFStoreFlusher  flusher(mfstore_ctl,
+			MFStoreFlusher::FlushInterval(10), 0, false);
+		std::size_t     page_size = GetPageSize();
+		char           *data_ptr  = mfstore_ctl.GetPtr<char>(0);
+		for (std::size_t count_1 = 0; count_1 < 3; ++count_1) {
+			data_ptr[count_1 * 2 * page_size] = 'X';
+			flusher.MarkDirty(count_1 * 2 * page_size, 1);
+		}
+		// Without a running thread, a non-barrier flush is a background pass.
+		flusher.Flush(false);
+		MFStoreFlusherStats stats = flusher.GetStats();
+		if ((stats.range_count_ != 3) || stats.sync_range_count_)
+			throw std::logic_error("Expected a non-barrier flush to write 3 "
+				"ranges without syncing them (" + TEST_StatsText(stats) + ").");
+		flusher.Flush(true);
+		stats = flusher.GetStats();
+		if (stats.sync_range_count_ != 3)
+			throw std::logic_error("Expected a barrier to sync the 3 ranges "
+				"written by the preceding pass (" + TEST_StatsText(stats) + ").");
+		flusher.Flush(true);
+		if (flusher.GetStats().sync_range_count_ != 3)
+			throw std::logic_error("A second barrier synced ranges which had "
+				"already been synced.");
+	}
+
+	std::filesystem::remove(TEST_FileName);
+
+	std::cout << "Barrier syncs written ranges: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreFlusher(MFStoreLen file_size)
+{
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl  mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran);
+		MFStoreFlusher  flusher(mfstore_ctl,
+			MFStoreFlusher::FlushInterval(10));
+		std::size_t     page_size  = GetPageSize();
+		std::size_t     page_count = static_cast<std::size_t>(file_size /
+			page_size);
+		char           *data_ptr   = mfstore_ctl.GetPtr<char>(0);
+		std::mt19937_64 rng(42);
+		auto            time_start = std::chrono::steady_clock::now();
+		for (std::size_t count_1 = 0; count_1 < 100000; ++count_1) {
+			MFStoreOff offset = (rng() % page_count) * page_size;
+			data_ptr[offset]  = static_cast<char>(count_1);
+			flusher.MarkDirty(offset, 1);
+		}
+		auto            time_end   = std::chrono::steady_clock::now();
+		flusher.Flush(true);
+		std::cout << "Writer hot path: " <<
+			std::chrono::duration_cast<std::chrono::nanoseconds>(
+			time_end - time_start).count() / 100000 << " ns per write+mark" <<
+			std::endl;
+		std::cout << "Flusher stats  : " << flusher.GetStats() << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_DirtyMapCoalesce();
+		TEST_BarrierSyncsWrittenRanges(256 * MFStoreAllocGran);
+		TEST_MFStoreFlusher(256 * MFStoreAllocGran);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
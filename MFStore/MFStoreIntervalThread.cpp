@@ -0,0 +1,182 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreIntervalThread.cpp
+
+   File Description  :  Implementation of the MFStoreIntervalThread class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreIntervalThread.hpp>
+
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreIntervalThread::MFStoreIntervalThread(const Interval &interval,
+	const PassFunc &pass_func)
+	:interval_(interval)
+	,pass_func_(pass_func)
+	,thread_mutex_()
+	,thread_cv_()
+	,stop_flag_(false)
+	,wake_flag_(false)
+	,running_flag_(false)
+	,thread_except_()
+	,thread_()
+{
+	if (interval_.count() < 1)
+		throw std::invalid_argument("The MFStore thread interval must be at "
+			"least one millisecond.");
+
+	if (!pass_func_)
+		throw std::invalid_argument("The MFStore thread pass function is "
+			"empty.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreIntervalThread::~MFStoreIntervalThread()
+{
+	Stop();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreIntervalThread::Start()
+{
+	if (IsRunning())
+		return;
+
+	// Reap a thread which ended because of an exception...
+	if (thread_.joinable())
+		thread_.join();
+
+	{
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		stop_flag_    = false;
+		wake_flag_    = false;
+		running_flag_ = true;
+	}
+
+	try {
+		thread_ = std::thread(&MFStoreIntervalThread::RunThread, this);
+	}
+	catch (...) {
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		running_flag_ = false;
+		throw;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreIntervalThread::Stop()
+{
+	if (!thread_.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		stop_flag_ = true;
+		thread_cv_.notify_one();
+	}
+
+	thread_.join();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreIntervalThread::Wake()
+{
+	std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+
+	wake_flag_ = true;
+
+	thread_cv_.notify_one();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreIntervalThread::IsRunning() const
+{
+	std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+
+	return(running_flag_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreIntervalThread::RethrowException()
+{
+	std::exception_ptr tmp_except;
+
+	{
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		tmp_except.swap(thread_except_);
+	}
+
+	if (tmp_except)
+		std::rethrow_exception(tmp_except);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreIntervalThread::Interval MFStoreIntervalThread::GetInterval() const
+{
+	return(interval_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreIntervalThread::RunThread()
+{
+	std::unique_lock<std::mutex> thread_lock(thread_mutex_);
+
+	try {
+		while (!stop_flag_) {
+			thread_cv_.wait_for(thread_lock, interval_,
+				[this]() { return(stop_flag_ || wake_flag_); });
+			if (stop_flag_)
+				break;
+			wake_flag_ = false;
+			thread_lock.unlock();
+			pass_func_();
+			thread_lock.lock();
+		}
+	}
+	catch (...) {
+		if (!thread_lock.owns_lock())
+			thread_lock.lock();
+		thread_except_ = std::current_exception();
+	}
+
+	running_flag_ = false;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
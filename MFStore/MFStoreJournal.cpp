@@ -0,0 +1,870 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreJournal.cpp
+
+   File Description  :  Implementation of the MFStoreJournal class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreJournal.hpp>
+#include <MFStore/Crc32c.hpp>
+
+#include <Utility/ArgCheck.hpp>
+#include <Utility/PageSize.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreLen JournalAlignment = sizeof(uint64_t);
+const MFStoreLen JournalDataStart = sizeof(MFStoreJournalHeader);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline MFStoreLen CalcRecordLength(MFStoreLen data_length)
+{
+	return(sizeof(MFStoreJournalRecord) +
+		((data_length + (JournalAlignment - 1)) & ~(JournalAlignment - 1)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint32_t CalcHeaderCrc(const MFStoreJournalRecord &record)
+{
+	return(Crc32c(&record, offsetof(MFStoreJournalRecord, header_crc_)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreJournalRecord MakeRecord(uint32_t record_type, uint64_t sequence,
+	uint64_t offset, uint64_t length, uint32_t data_crc)
+{
+	MFStoreJournalRecord record;
+
+	record.magic_       = MFStoreJournalRecord::RecordMagic;
+	record.record_type_ = record_type;
+	record.sequence_    = sequence;
+	record.offset_      = offset;
+	record.length_      = length;
+	record.data_crc_    = data_crc;
+	record.header_crc_  = CalcHeaderCrc(record);
+
+	return(record);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreJournalStats::MFStoreJournalStats()
+	:batch_count_(0)
+	,write_count_(0)
+	,byte_count_(0)
+	,sync_count_(0)
+	,checkpoint_count_(0)
+	,recovered_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreJournalStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Batches=" << batch_count_
+		<< ", Writes=" << write_count_
+		<< ", Bytes=" << byte_count_
+		<< ", Syncs=" << sync_count_
+		<< ", Checkpoints=" << checkpoint_count_
+		<< ", Recovered=" << recovered_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreJournal::MFStoreJournal(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, bool format_flag)
+	:mfstore_ctl_(mfstore_ctl)
+	,section_offset_(0)
+	,section_length_(0)
+	,section_ptr_(nullptr)
+	,header_ptr_(nullptr)
+	,batch_buffer_()
+	,batch_write_count_(0)
+	,tail_offset_(JournalDataStart)
+	,sync_offset_(JournalDataStart)
+	,sequence_(0)
+	,synced_sequence_(0)
+	,applied_list_()
+	,recovered_count_(0)
+	,stats_()
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.CalcLengthUsed() <= (JournalDataStart +
+			(2 * sizeof(MFStoreJournalRecord))))
+			throw std::invalid_argument("The section length (" +
+				std::to_string(section.CalcLengthUsed()) + ") leaves no room "
+				"for batches after the journal header.");
+		if (section.section_offset_ % alignof(MFStoreJournalHeader))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreJournalHeader)) + "-byte "
+				"boundary.");
+		section_offset_ = section.section_offset_;
+		section_length_ = section.CalcLengthUsed();
+		section_ptr_    = mfstore_ctl.GetPtr<char>(section_offset_);
+		header_ptr_     = reinterpret_cast<MFStoreJournalHeader *>(section_ptr_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			::memset(header_ptr_, '\0', sizeof(*header_ptr_));
+			header_ptr_->capacity_            = section_length_;
+			header_ptr_->head_offset_         = JournalDataStart;
+			header_ptr_->checkpoint_sequence_ = 0;
+			header_ptr_->magic_               = MFStoreJournalHeader::HeaderMagic;
+			mfstore_ctl.Flush(section_offset_, sizeof(*header_ptr_));
+		}
+		else if (header_ptr_->magic_ != MFStoreJournalHeader::HeaderMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"a journal.");
+		else if (header_ptr_->capacity_ != section_length_)
+			throw std::invalid_argument("The journal capacity (" +
+				std::to_string(header_ptr_->capacity_) + ") doesn't match the "
+				"section length (" + std::to_string(section_length_) + ").");
+		else if (mfstore_ctl.IsWriter())
+			recovered_count_ = Recover();
+		else
+			sequence_ = synced_sequence_ = header_ptr_->checkpoint_sequence_;
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as a journal: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Batches committed without a sync are made durable (and applied) by the
+	destructor. Those still being built are discarded.
+*/
+MFStoreJournal::~MFStoreJournal()
+{
+	try {
+		if (mfstore_ctl_.IsWriter())
+			Sync();
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::AddWrite(MFStoreOff offset, const void *data_ptr,
+	MFStoreLen length)
+{
+	mfstore_ctl_.CheckIsWriter();
+
+	MLB::Utility::ThrowIfNull(data_ptr, "The journal write data pointer");
+
+	CheckTarget(offset, length);
+
+	MFStoreJournalRecord record(MakeRecord(MFStoreJournalRecord::RecordWrite,
+		sequence_ + 1, offset, length, Crc32c(data_ptr,
+		static_cast<std::size_t>(length))));
+	std::size_t          record_offset = batch_buffer_.size();
+
+	batch_buffer_.resize(record_offset +
+		static_cast<std::size_t>(CalcRecordLength(length)), '\0');
+	::memcpy(batch_buffer_.data() + record_offset, &record, sizeof(record));
+	::memcpy(batch_buffer_.data() + record_offset + sizeof(record), data_ptr,
+		static_cast<std::size_t>(length));
+
+	++batch_write_count_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the sequence number of the batch. If no writes have been added
+	since the last commit, no batch is created and the sequence number of the
+	last batch is returned.
+*/
+uint64_t MFStoreJournal::Commit(bool sync_flag)
+{
+	mfstore_ctl_.CheckIsWriter();
+
+	if (batch_write_count_) {
+		MFStoreLen batch_length = batch_buffer_.size() +
+			sizeof(MFStoreJournalRecord);
+		if ((tail_offset_ + batch_length) > section_length_) {
+			Checkpoint();
+			if ((tail_offset_ + batch_length) > section_length_)
+				throw std::runtime_error("The batch length of " +
+					std::to_string(batch_length) + " bytes exceeds the capacity "
+					"of the journal in MFStore file '" +
+					mfstore_ctl_.GetFileName() + "' (" +
+					std::to_string(GetCapacity()) + " bytes).");
+		}
+		MFStoreJournalRecord record(MakeRecord(
+			MFStoreJournalRecord::RecordCommit, sequence_ + 1,
+			batch_write_count_, batch_buffer_.size(), Crc32c(
+			batch_buffer_.data(), batch_buffer_.size())));
+		::memcpy(section_ptr_ + tail_offset_, batch_buffer_.data(),
+			batch_buffer_.size());
+		::memcpy(section_ptr_ + tail_offset_ + batch_buffer_.size(), &record,
+			sizeof(record));
+		tail_offset_ += batch_length;
+		++sequence_;
+		++stats_.batch_count_;
+		stats_.write_count_ += batch_write_count_;
+		stats_.byte_count_  += batch_length;
+		batch_buffer_.clear();
+		batch_write_count_ = 0;
+	}
+
+	if (sync_flag)
+		Sync();
+
+	return(sequence_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::Abort()
+{
+	batch_buffer_.clear();
+
+	batch_write_count_ = 0;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::Sync()
+{
+	if (sync_offset_ == tail_offset_)
+		return;
+
+	mfstore_ctl_.Flush(section_offset_ + sync_offset_,
+		tail_offset_ - sync_offset_);
+
+	ApplyBatches(sync_offset_, tail_offset_);
+
+	sync_offset_     = tail_offset_;
+	synced_sequence_ = sequence_;
+
+	++stats_.sync_count_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The applied writes must be durable before the header is changed to mark
+	their batches as checkpointed.
+*/
+void MFStoreJournal::Checkpoint()
+{
+	mfstore_ctl_.CheckIsWriter();
+
+	Sync();
+
+	if ((tail_offset_ == JournalDataStart) &&
+		(header_ptr_->head_offset_ == JournalDataStart) &&
+		(header_ptr_->checkpoint_sequence_ == synced_sequence_))
+		return;
+
+	FlushApplied();
+
+	header_ptr_->head_offset_         = JournalDataStart;
+	header_ptr_->checkpoint_sequence_ = synced_sequence_;
+
+	mfstore_ctl_.Flush(section_offset_, sizeof(*header_ptr_));
+
+	tail_offset_ = JournalDataStart;
+	sync_offset_ = JournalDataStart;
+
+	++stats_.checkpoint_count_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Copies data from the mapping as it will be once all pending writes
+	(those of batches committed but not yet synced, and those added to the
+	batch being built) have been applied.
+*/
+void MFStoreJournal::Read(MFStoreOff offset, void *dst_ptr,
+	MFStoreLen length) const
+{
+	MLB::Utility::ThrowIfNull(dst_ptr, "The journal read data pointer");
+
+	CheckTarget(offset, length);
+
+	::memcpy(dst_ptr, mfstore_ctl_.GetPtr<char>(offset),
+		static_cast<std::size_t>(length));
+
+	OverlayWrites(section_ptr_ + sync_offset_, section_ptr_ + tail_offset_,
+		offset, dst_ptr, length);
+	OverlayWrites(batch_buffer_.data(),
+		batch_buffer_.data() + batch_buffer_.size(), offset, dst_ptr, length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreJournal::GetSequence() const
+{
+	return(sequence_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreJournal::GetSyncedSequence() const
+{
+	return(synced_sequence_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreJournal::GetCapacity() const
+{
+	return(section_length_ - JournalDataStart);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreJournal::GetUsedLength() const
+{
+	return(tail_offset_ - JournalDataStart);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreJournal::GetRecoveredCount() const
+{
+	return(recovered_count_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreJournalStats &MFStoreJournal::GetStats() const
+{
+	return(stats_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreJournal::MakeJournalSection(MFStoreLen journal_length,
+	const std::string &description)
+{
+	return(MFStoreSection(0, JournalDataStart,
+		(JournalDataStart + journal_length + (JournalDataStart - 1)) /
+		JournalDataStart, 0, 0, 0, 0, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Re-applies each complete batch following the last checkpoint, stopping
+	at the first record which is damaged or which is out of sequence (and
+	so was left by a batch written before the last checkpoint). Then
+	checkpoints the journal, discarding anything which follows.
+*/
+std::size_t MFStoreJournal::Recover()
+{
+	MFStoreOff           record_offset     = header_ptr_->head_offset_;
+	uint64_t             expected_sequence =
+		header_ptr_->checkpoint_sequence_ + 1;
+	std::size_t          batch_count       = 0;
+	MFStoreJournalRecord record;
+
+	if ((record_offset < JournalDataStart) ||
+		(record_offset > section_length_) ||
+		(record_offset % JournalAlignment))
+		throw std::runtime_error("The journal head offset (" +
+			std::to_string(record_offset) + ") is invalid.");
+
+	for ( ; ; ) {
+		MFStoreOff batch_offset   = record_offset;
+		uint64_t   write_count    = 0;
+		bool       complete_flag  = false;
+		while (IsValidRecord(record_offset, expected_sequence, record)) {
+			if (record.record_type_ == MFStoreJournalRecord::RecordWrite) {
+				++write_count;
+				record_offset += CalcRecordLength(record.length_);
+				continue;
+			}
+			complete_flag = (record.offset_ == write_count) &&
+				(record.length_ == (record_offset - batch_offset)) &&
+				(Crc32c(section_ptr_ + batch_offset,
+				static_cast<std::size_t>(record.length_)) == record.data_crc_);
+			break;
+		}
+		if (!complete_flag)
+			break;
+		ApplyBatches(batch_offset, record_offset);
+		record_offset += sizeof(record);
+		++expected_sequence;
+		++batch_count;
+	}
+
+	sequence_        = expected_sequence - 1;
+	synced_sequence_ = sequence_;
+	tail_offset_     = record_offset;
+	sync_offset_     = record_offset;
+
+	Checkpoint();
+
+	stats_.recovered_count_ += batch_count;
+
+	return(batch_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::ApplyBatches(MFStoreOff begin_offset,
+	MFStoreOff end_offset)
+{
+	MFStoreJournalRecord record;
+
+	while (begin_offset < end_offset) {
+		::memcpy(&record, section_ptr_ + begin_offset, sizeof(record));
+		if (record.record_type_ == MFStoreJournalRecord::RecordWrite) {
+			CheckTarget(record.offset_, record.length_);
+			::memcpy(mfstore_ctl_.GetPtr<char>(record.offset_),
+				section_ptr_ + begin_offset + sizeof(record),
+				static_cast<std::size_t>(record.length_));
+			applied_list_.emplace_back(record.offset_, record.length_);
+			begin_offset += CalcRecordLength(record.length_);
+		}
+		else
+			begin_offset += sizeof(record);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Ranges within a page of one another are flushed together.
+*/
+void MFStoreJournal::FlushApplied()
+{
+	if (applied_list_.empty())
+		return;
+
+	MFStoreLen page_size = MLB::Utility::GetPageSize();
+
+	std::sort(applied_list_.begin(), applied_list_.end());
+
+	AppliedRange this_range(applied_list_.front());
+
+	for (const auto &next_range : applied_list_) {
+		if (next_range.first <= (this_range.first + this_range.second +
+			page_size))
+			this_range.second = std::max(this_range.first + this_range.second,
+				next_range.first + next_range.second) - this_range.first;
+		else {
+			mfstore_ctl_.Flush(this_range.first, this_range.second);
+			this_range = next_range;
+		}
+	}
+
+	mfstore_ctl_.Flush(this_range.first, this_range.second);
+
+	applied_list_.clear();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::OverlayWrites(const char *begin_ptr,
+	const char *end_ptr, MFStoreOff offset, void *dst_ptr,
+	MFStoreLen length) const
+{
+	MFStoreJournalRecord record;
+
+	while (begin_ptr < end_ptr) {
+		::memcpy(&record, begin_ptr, sizeof(record));
+		if (record.record_type_ != MFStoreJournalRecord::RecordWrite) {
+			begin_ptr += sizeof(record);
+			continue;
+		}
+		MFStoreOff first_offset = std::max(offset, record.offset_);
+		MFStoreOff last_offset  = std::min(offset + length,
+			record.offset_ + record.length_);
+		if (first_offset < last_offset)
+			::memcpy(static_cast<char *>(dst_ptr) + (first_offset - offset),
+				begin_ptr + sizeof(record) + (first_offset - record.offset_),
+				static_cast<std::size_t>(last_offset - first_offset));
+		begin_ptr += CalcRecordLength(record.length_);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreJournal::CheckTarget(MFStoreOff offset, MFStoreLen length) const
+{
+	MFStoreLen mmap_size = mfstore_ctl_.GetMmapSize();
+
+	if ((offset > mmap_size) || (length > (mmap_size - offset)))
+		throw std::invalid_argument("The journal write of " +
+			std::to_string(length) + " bytes at offset " +
+			std::to_string(offset) + " extends beyond the mapping of MFStore "
+			"file '" + mfstore_ctl_.GetFileName() + "' (" +
+			std::to_string(mmap_size) + " bytes).");
+
+	if ((offset < (section_offset_ + section_length_)) &&
+		((offset + length) > section_offset_))
+		throw std::invalid_argument("The journal write of " +
+			std::to_string(length) + " bytes at offset " +
+			std::to_string(offset) + " overlaps the journal itself.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreJournal::IsValidRecord(MFStoreOff record_offset,
+	uint64_t expected_sequence, MFStoreJournalRecord &record) const
+{
+	if ((record_offset + sizeof(record)) > section_length_)
+		return(false);
+
+	::memcpy(&record, section_ptr_ + record_offset, sizeof(record));
+
+	if ((record.magic_ != MFStoreJournalRecord::RecordMagic) ||
+		(record.header_crc_ != CalcHeaderCrc(record)) ||
+		(record.sequence_ != expected_sequence))
+		return(false);
+
+	if (record.record_type_ == MFStoreJournalRecord::RecordCommit)
+		return(true);
+	else if (record.record_type_ != MFStoreJournalRecord::RecordWrite)
+		return(false);
+
+	return((record.length_ <= (section_length_ - record_offset -
+		sizeof(record))) &&
+		(Crc32c(section_ptr_ + record_offset + sizeof(record),
+		static_cast<std::size_t>(record.length_)) == record.data_crc_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreJournalStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <numeric>
+#include <random>
+
+#ifdef __unix
+# include <sys/wait.h>
+# include <unistd.h>
+#endif // #ifdef __unix
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreJournal.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_AccountIndex  = 1;
+const std::size_t TEST_JournalIndex  = 2;
+const uint64_t    TEST_AccountCount  = 4096;
+const uint64_t    TEST_OpeningAmount = 1000;
+const MFStoreLen  TEST_JournalLength = 256 * 1024;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint64_t),
+		TEST_AccountCount, 0, 0, 0, 0, 0, "Accounts"), section_list);
+	MFStoreSection::AppendSection(MFStoreJournal::MakeJournalSection(
+		TEST_JournalLength), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Check(bool condition, const std::string &error_text)
+{
+	if (!condition)
+		throw std::logic_error(error_text);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Moves an amount between two accounts as a single batch.
+uint64_t TEST_Transfer(MFStoreControl &mfstore_ctl, MFStoreJournal &journal,
+	uint64_t from_account, uint64_t to_account, uint64_t amount,
+	bool sync_flag)
+{
+	MFStoreOff accounts_offset = mfstore_ctl.GetSectionMapped(
+		TEST_AccountIndex).section_offset_;
+	MFStoreOff from_offset     = accounts_offset +
+		(from_account * sizeof(uint64_t));
+	MFStoreOff to_offset       = accounts_offset +
+		(to_account * sizeof(uint64_t));
+	uint64_t   from_balance;
+	uint64_t   to_balance;
+
+	journal.Read(from_offset, &from_balance, sizeof(from_balance));
+	journal.Read(to_offset, &to_balance, sizeof(to_balance));
+
+	from_balance -= amount;
+	to_balance   += amount;
+
+	journal.AddWrite(from_offset, &from_balance, sizeof(from_balance));
+	journal.AddWrite(to_offset, &to_balance, sizeof(to_balance));
+
+	return(journal.Commit(sync_flag));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t TEST_GetTotal(const MFStoreControl &mfstore_ctl)
+{
+	const uint64_t *account_ptr = mfstore_ctl.GetPtr<uint64_t>(
+		mfstore_ctl.GetSectionMapped(TEST_AccountIndex).section_offset_);
+
+	return(std::accumulate(account_ptr, account_ptr + TEST_AccountCount,
+		uint64_t(0)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+double TEST_TimeTransfers(MFStoreControl &mfstore_ctl,
+	MFStoreJournal &journal, uint64_t transfer_count, uint64_t group_size,
+	std::mt19937_64 &rng)
+{
+	auto start_time = std::chrono::steady_clock::now();
+
+	for (uint64_t count_1 = 1; count_1 <= transfer_count; ++count_1) {
+		uint64_t from_account = rng() % TEST_AccountCount;
+		uint64_t to_account   = (from_account + 1 +
+			(rng() % (TEST_AccountCount - 1))) % TEST_AccountCount;
+		TEST_Transfer(mfstore_ctl, journal, from_account, to_account, 1,
+			!(count_1 % group_size));
+	}
+
+	journal.Sync();
+
+	auto end_time   = std::chrono::steady_clock::now();
+
+	return(static_cast<double>(transfer_count) /
+		std::chrono::duration<double>(end_time - start_time).count());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The child commits two batches without syncing them, applies part of the
+	first directly to the mapping (as if the crash struck during Sync()),
+	commits a third batch and damages its commit record, and then dies
+	without running any destructors.
+*/
+void TEST_Crash(const MFStoreSectionList &section_list, MFStoreLen file_size)
+{
+	std::vector<uint64_t> before_list;
+
+	{
+		MFStoreControl  mfstore_ctl(TEST_FileName, false, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		const uint64_t *account_ptr = mfstore_ctl.GetPtr<uint64_t>(
+			mfstore_ctl.GetSectionMapped(TEST_AccountIndex).section_offset_);
+		before_list.assign(account_ptr, account_ptr + 7);
+	}
+
+	pid_t child_pid = ::fork();
+
+	if (child_pid < 0)
+		throw std::runtime_error("Call to ::fork() failed.");
+	else if (!child_pid) {
+		int exit_code = EXIT_SUCCESS;
+		try {
+			MFStoreControl *mfstore_ctl = new MFStoreControl(TEST_FileName, true,
+				file_size, file_size, MFStoreAllocGran, section_list);
+			MFStoreJournal *journal     = new MFStoreJournal(*mfstore_ctl,
+				TEST_JournalIndex);
+			TEST_Transfer(*mfstore_ctl, *journal, 1, 2, 100, false);
+			TEST_Transfer(*mfstore_ctl, *journal, 3, 4, 200, false);
+			mfstore_ctl->GetPtr<uint64_t>(mfstore_ctl->GetSectionMapped(
+				TEST_AccountIndex).section_offset_)[1] -= 100;
+			TEST_Transfer(*mfstore_ctl, *journal, 5, 6, 300, false);
+			MFStoreOff commit_offset = mfstore_ctl->GetSectionMapped(
+				TEST_JournalIndex).section_offset_ +
+				sizeof(MFStoreJournalHeader) + journal->GetUsedLength() -
+				sizeof(MFStoreJournalRecord);
+			mfstore_ctl->GetPtr<MFStoreJournalRecord>(commit_offset)->
+				data_crc_ ^= 1;
+		}
+		catch (const std::exception &except) {
+			std::cerr << "Crashing process failed: " << except.what() <<
+				std::endl;
+			exit_code = EXIT_FAILURE;
+		}
+		::_exit(exit_code);
+	}
+
+	int child_status = 0;
+
+	::waitpid(child_pid, &child_status, 0);
+
+	if ((!WIFEXITED(child_status)) ||
+		(WEXITSTATUS(child_status) != EXIT_SUCCESS))
+		throw std::logic_error("The crashing process failed.");
+
+	MFStoreControl  mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreJournal  journal(mfstore_ctl, TEST_JournalIndex);
+	const uint64_t *account_ptr = mfstore_ctl.GetPtr<uint64_t>(
+		mfstore_ctl.GetSectionMapped(TEST_AccountIndex).section_offset_);
+
+	TEST_Check(journal.GetRecoveredCount() == 2, "Recovery replayed " +
+		std::to_string(journal.GetRecoveredCount()) + " batches, but 2 were "
+		"expected.");
+	TEST_Check(TEST_GetTotal(mfstore_ctl) ==
+		(TEST_AccountCount * TEST_OpeningAmount), "The account total is "
+		"incorrect after recovery.");
+	TEST_Check((account_ptr[1] == (before_list[1] - 100)) &&
+		(account_ptr[2] == (before_list[2] + 100)) &&
+		(account_ptr[3] == (before_list[3] - 200)) &&
+		(account_ptr[4] == (before_list[4] + 200)) &&
+		(account_ptr[5] == before_list[5]) &&
+		(account_ptr[6] == before_list[6]), "The account balances are "
+		"incorrect after recovery.");
+
+	std::cout << "Recovery after a crash replayed " <<
+		journal.GetRecoveredCount() << " batches and discarded the damaged "
+		"batch: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreJournal()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+	std::mt19937_64    rng(42);
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreJournal journal(mfstore_ctl, TEST_JournalIndex, true);
+		MFStoreOff     accounts_offset = mfstore_ctl.GetSectionMapped(
+			TEST_AccountIndex).section_offset_;
+		for (uint64_t count_1 = 0; count_1 < TEST_AccountCount; ++count_1)
+			journal.AddWrite(accounts_offset + (count_1 * sizeof(uint64_t)),
+				&TEST_OpeningAmount, sizeof(TEST_OpeningAmount));
+		journal.Commit();
+		TEST_Check(TEST_GetTotal(mfstore_ctl) ==
+			(TEST_AccountCount * TEST_OpeningAmount), "The opening balances "
+			"are incorrect.");
+		double sync_rate  = TEST_TimeTransfers(mfstore_ctl, journal, 2000, 1,
+			rng);
+		double group_rate = TEST_TimeTransfers(mfstore_ctl, journal, 20000, 16,
+			rng);
+		TEST_Check(TEST_GetTotal(mfstore_ctl) ==
+			(TEST_AccountCount * TEST_OpeningAmount), "The account total is "
+			"incorrect after the transfers.");
+		uint64_t bad_balance = 0;
+		journal.AddWrite(accounts_offset, &bad_balance, sizeof(bad_balance));
+		journal.Abort();
+		TEST_Check(journal.Commit() == journal.GetSyncedSequence(), "An "
+			"aborted batch was committed.");
+		std::cout << std::fixed << std::setprecision(0) <<
+			"Transfers per second: " << sync_rate << " syncing each batch, " <<
+			group_rate << " syncing every 16 batches" << std::endl;
+		std::cout << "Journal statistics: " << journal.GetStats() << std::endl;
+	}
+
+#ifdef __unix
+	TEST_Crash(section_list, file_size);
+#endif // #ifdef __unix
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MFStoreJournal();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -0,0 +1,434 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreMapPolicy.cpp
+
+   File Description  :  Implementation of the MFStoreMapPolicy class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreMapPolicy.hpp>
+
+#include <Utility/ArgCheck.hpp>
+#include <Utility/PageSize.hpp>
+#include <Utility/ThrowErrno.hpp>
+
+#ifdef __unix
+# include <sys/mman.h>
+#endif // #ifdef __unix
+
+#include <sstream>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreMapPolicy::MFStoreMapPolicy(bool huge_pages, MFStoreAdvice advice,
+	bool lock_pages, bool pre_fault)
+	:huge_pages_(huge_pages)
+	,advice_(advice)
+	,lock_pages_(lock_pages)
+	,pre_fault_(pre_fault)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreMapPolicy::IsDefault() const
+{
+	return((!huge_pages_) && (advice_ == MFStoreAdvice::Normal) &&
+		(!lock_pages_) && (!pre_fault_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreMapPolicy::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "HugePages=" << ((huge_pages_) ? "Y" : "N")
+		<< ", Advice="  << AdviceToString(advice_)
+		<< ", Lock="    << ((lock_pages_) ? "Y" : "N")
+		<< ", PreFault=" << ((pre_fault_) ? "Y" : "N");
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string MFStoreMapPolicy::ToString() const
+{
+	std::ostringstream o_str;
+
+	ToStream(o_str);
+
+	return(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *MFStoreMapPolicy::AdviceToString(MFStoreAdvice advice)
+{
+	switch (advice) {
+		case MFStoreAdvice::Normal     : return("Normal");
+		case MFStoreAdvice::Random     : return("Random");
+		case MFStoreAdvice::Sequential : return("Sequential");
+		case MFStoreAdvice::WillNeed   : return("WillNeed");
+		default                        : break;
+	}
+
+	return("*INVALID*");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+#ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+void MAdviseHelper(void *mmap_address, MFStoreLen mmap_length, int advice,
+	const char *advice_name)
+{
+	if (::madvise(mmap_address, mmap_length, advice) != 0)
+		MLB::Utility::ThrowErrno("Call to ::madvise(" +
+			std::string(advice_name) + ") failed");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void PreFaultHelper(void *mmap_address, MFStoreLen mmap_length,
+	bool is_writer)
+{
+#if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+	if (::madvise(mmap_address, mmap_length, (is_writer) ?
+		MADV_POPULATE_WRITE : MADV_POPULATE_READ) == 0)
+		return;
+	else if (errno != EINVAL)
+		MLB::Utility::ThrowErrno("Call to ::madvise(" +
+			std::string((is_writer) ? "MADV_POPULATE_WRITE" :
+			"MADV_POPULATE_READ") + ") failed");
+#else
+	static_cast<void>(is_writer);
+#endif // #if defined(MADV_POPULATE_READ) && defined(MADV_POPULATE_WRITE)
+
+	/*
+		Kernels earlier than 5.14 don't support MADV_POPULATE_xxx, so we
+		fault the pages in by touching them.
+	*/
+	const volatile char *tmp_ptr  =
+		static_cast<const volatile char *>(mmap_address);
+	const volatile char *end_ptr  = tmp_ptr + mmap_length;
+	std::size_t          page_size = MLB::Utility::GetPageSize();
+
+	for ( ; tmp_ptr < end_ptr; tmp_ptr += page_size)
+		static_cast<void>(*tmp_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckApplyArgs(void *mmap_address, MFStoreLen mmap_length)
+{
+	MLB::Utility::ThrowIfNull(mmap_address, "The mmap address");
+
+	if (!mmap_length)
+		throw std::invalid_argument("The mmap length is 0.");
+
+	if (reinterpret_cast<uintptr_t>(mmap_address) %
+		MLB::Utility::GetPageSize())
+		throw std::invalid_argument("The mmap address is not aligned on a "
+			"page boundary.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreMapPolicy::Apply(void *mmap_address, MFStoreLen mmap_length,
+	const MFStoreMapPolicy &policy, bool is_writer)
+{
+	if (policy.IsDefault())
+		return;
+
+	try {
+		CheckApplyArgs(mmap_address, mmap_length);
+#ifdef __unix
+		if (policy.huge_pages_) {
+# ifdef MADV_HUGEPAGE
+			MAdviseHelper(mmap_address, mmap_length, MADV_HUGEPAGE,
+				"MADV_HUGEPAGE");
+# else
+			throw std::logic_error("Huge pages are not supported on this "
+				"operating system.");
+# endif // # ifdef MADV_HUGEPAGE
+		}
+		switch (policy.advice_) {
+			case MFStoreAdvice::Normal     :
+				break;
+			case MFStoreAdvice::Random     :
+				MAdviseHelper(mmap_address, mmap_length, MADV_RANDOM,
+					"MADV_RANDOM");
+				break;
+			case MFStoreAdvice::Sequential :
+				MAdviseHelper(mmap_address, mmap_length, MADV_SEQUENTIAL,
+					"MADV_SEQUENTIAL");
+				break;
+			case MFStoreAdvice::WillNeed   :
+				MAdviseHelper(mmap_address, mmap_length, MADV_WILLNEED,
+					"MADV_WILLNEED");
+				break;
+			default                        :
+				throw std::invalid_argument("Invalid MFStoreAdvice value (" +
+					std::to_string(static_cast<int>(policy.advice_)) + ").");
+		}
+		if (policy.pre_fault_)
+			PreFaultHelper(mmap_address, mmap_length, is_writer);
+		if (policy.lock_pages_ && (::mlock(mmap_address, mmap_length) != 0))
+			MLB::Utility::ThrowErrno("Call to ::mlock() failed");
+#else
+		static_cast<void>(is_writer);
+		throw std::logic_error("No logic to implement MFStore mapping "
+			"policies is available.");
+#endif // #ifdef __unix
+	}
+	catch (const std::exception &except) {
+		std::ostringstream o_str;
+		o_str << "Attempt to apply the mapping policy (" << policy <<
+			") to the " << mmap_length << " bytes at address " <<
+			mmap_address << " failed: " << except.what();
+		throw std::runtime_error(o_str.str());
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreMapPolicy &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <Utility/ParseNumericString.hpp>
+#include <Utility/RsrcUsage.hpp>
+
+#include <filesystem>
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreMapPolicy.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Check(bool condition, const std::string &error_text)
+{
+	if (!condition)
+		throw std::logic_error(error_text);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename ExceptionType, typename FuncType>
+	void TEST_CheckThrows(const char *test_name, FuncType func)
+{
+	try {
+		func();
+	}
+	catch (const ExceptionType &) {
+		return;
+	}
+
+	throw std::logic_error(std::string(test_name) + " did not throw the "
+		"expected exception.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_PolicyBasics(MFStoreLen file_size)
+{
+	MFStoreMapPolicy default_policy;
+	MFStoreMapPolicy random_policy(false, MFStoreAdvice::Random);
+
+	TEST_Check(default_policy.IsDefault(), "A default-constructed policy is "
+		"not reported as the default.");
+	TEST_Check(!random_policy.IsDefault(), "A policy with MADV_RANDOM advice "
+		"is reported as the default.");
+	TEST_Check(!MFStoreMapPolicy(false, MFStoreAdvice::Normal, false,
+		true).IsDefault(), "A pre-fault policy is reported as the default.");
+	TEST_Check(random_policy.ToString() ==
+		"HugePages=N, Advice=Random, Lock=N, PreFault=N", "Unexpected "
+		"policy text '" + random_policy.ToString() + "'.");
+
+	TEST_CheckThrows<std::runtime_error>("Applying a policy to a null address",
+		[&]() { MFStoreMapPolicy::Apply(nullptr, file_size, random_policy,
+			false); });
+
+	MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, MFStoreSectionList(), random_policy);
+
+	TEST_Check(mfstore_ctl.GetMapPolicy().advice_ == MFStoreAdvice::Random,
+		"The policy supplied at construction was not retained.");
+
+	TEST_CheckThrows<std::runtime_error>("Applying a policy to an unaligned "
+		"address", [&]() { MFStoreMapPolicy::Apply(
+		mfstore_ctl.GetPtr<char>(1), file_size - 1, random_policy, true); });
+	TEST_CheckThrows<std::invalid_argument>("Applying a policy to a "
+		"non-existent section", [&]() { mfstore_ctl.ApplyMapPolicy(0,
+		random_policy); });
+
+	mfstore_ctl.ApplyMapPolicy(MFStoreMapPolicy(false,
+		MFStoreAdvice::Sequential));
+
+	TEST_Check(mfstore_ctl.GetMapPolicy().advice_ ==
+		MFStoreAdvice::Sequential, "The policy applied to the mapping was not "
+		"retained.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the number of minor faults incurred in touching each page of the
+	store. Readers verify the contents written by the writer.
+*/
+uint64_t TEST_TouchStore(const char *test_name,
+	const MFStoreMapPolicy &policy, MFStoreLen file_size, bool is_writer)
+{
+	MFStoreControl     mfstore_ctl(TEST_FileName, is_writer, file_size,
+		file_size, MFStoreAllocGran, MFStoreSectionList(), policy);
+	RsrcUsage          usage_start(true);
+	std::size_t        page_size = GetPageSize();
+	volatile char     *data_ptr  = mfstore_ctl.GetPtr<char>(0);
+	MFStoreLen         bad_count = 0;
+
+	for (MFStoreLen offset = 0; offset < file_size; offset += page_size) {
+		if (is_writer)
+			data_ptr[offset] = static_cast<char>(offset / page_size);
+		else if (data_ptr[offset] != static_cast<char>(offset / page_size))
+			++bad_count;
+	}
+
+	RsrcUsage          usage_end(true);
+	uint64_t           minor_faults =
+		usage_end.minor_pagef - usage_start.minor_pagef;
+
+	std::cout << ((is_writer) ? "Writer " : "Reader ") <<
+		std::left << std::setw(12) << test_name << ": " <<
+		std::right << std::setw(10) << minor_faults << " minor faults, " <<
+		std::setw(10) <<
+		(usage_end.major_pagef - usage_start.major_pagef) << " major faults "
+		"touching " << (file_size / page_size) << " pages (" << policy << ")" <<
+		std::endl;
+
+	TEST_Check(!bad_count, "The reader found " + std::to_string(bad_count) +
+		" pages which did not contain the values written by the writer.");
+
+	return(minor_faults);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreMapPolicy(MFStoreLen file_size)
+{
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	TEST_PolicyBasics(file_size);
+
+	uint64_t page_count = file_size / GetPageSize();
+
+	for (int is_writer = 1; is_writer >= 0; --is_writer) {
+		TEST_TouchStore("Default", MFStoreMapPolicy(), file_size, is_writer);
+		TEST_TouchStore("Sequential", MFStoreMapPolicy(false,
+			MFStoreAdvice::Sequential), file_size, is_writer);
+		TEST_TouchStore("WillNeed", MFStoreMapPolicy(false,
+			MFStoreAdvice::WillNeed), file_size, is_writer);
+		uint64_t fault_count = TEST_TouchStore("PreFault",
+			MFStoreMapPolicy(false, MFStoreAdvice::Normal, false, true),
+			file_size, is_writer);
+		/*
+			A pre-faulted mapping should incur almost no faults. Writers on
+			kernels without MADV_POPULATE_WRITE fall back to a read touch,
+			which leaves the pages write-protected, so they aren't checked.
+		*/
+#ifdef MADV_POPULATE_WRITE
+		bool check_flag = true;
+#else
+		bool check_flag = !is_writer;
+#endif // #ifdef MADV_POPULATE_WRITE
+		TEST_Check((!check_flag) || (fault_count < (page_count / 4)),
+			"Touching the " +
+			std::to_string(page_count) + " pre-faulted pages of the " +
+			std::string((is_writer) ? "writer" : "reader") + " mapping "
+			"incurred " + std::to_string(fault_count) + " minor faults.");
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		MFStoreLen file_size = 256 * MFStoreAllocGran;
+		if (argc > 2)
+			throw std::invalid_argument("Unexpected command line arguments --- "
+				"expected [ <file-size> ]");
+		else if (argc == 2)
+			file_size = FixUpValueGran(
+				CheckIsNumericString<MFStoreLen>(argv[1]), MFStoreAllocGran);
+		TEST_MFStoreMapPolicy(file_size);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -0,0 +1,609 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreNotify.cpp
+
+   File Description  :  Implementation of the MFStoreNotify class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+                        2026-10-18 --- Added GetSectionIndex().
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreNotify.hpp>
+
+#include <Utility/ThrowErrno.hpp>
+
+#ifdef __linux__
+# include <boost/interprocess/shared_memory_object.hpp>
+# include <linux/futex.h>
+# include <sys/stat.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#else
+# include <thread>
+#endif // #ifdef __linux__
+
+#include <algorithm>
+#include <climits>
+#include <sstream>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+#ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The futexes are not FUTEX_PRIVATE_FLAG because the waiters are usually
+	in other processes which have the same file mapped.
+*/
+long FutexHelper(std::atomic<uint32_t> *futex_ptr, int futex_op,
+	uint32_t futex_value, const struct timespec *timeout_ptr)
+{
+	return(::syscall(SYS_futex, reinterpret_cast<uint32_t *>(futex_ptr),
+		futex_op, futex_value, timeout_ptr, nullptr, 0));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string GetWaiterSegmentName(const std::string &file_name,
+	std::size_t notify_section_index, struct stat &stat_data)
+{
+	if (::stat(file_name.c_str(), &stat_data))
+		MLB::Utility::ThrowErrno("Call to ::stat() for MFStore file '" +
+			file_name + "' failed");
+
+	std::ostringstream o_str;
+
+	o_str << "MLB.MFStoreNotify." << std::hex <<
+		static_cast<unsigned long long>(stat_data.st_dev) << "." <<
+		static_cast<unsigned long long>(stat_data.st_ino) << "." << std::dec <<
+		notify_section_index;
+
+	return(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MappedRegionSPtr OpenWaiterRegion(const std::string &file_name,
+	std::size_t notify_section_index, std::size_t slot_count)
+{
+	using namespace boost::interprocess;
+
+	struct stat stat_data;
+	std::string segment_name(GetWaiterSegmentName(file_name,
+		notify_section_index, stat_data));
+	// Each class of user which may read the store may count itself.
+	unsigned int read_mode = static_cast<unsigned int>(stat_data.st_mode &
+		(S_IRUSR | S_IRGRP | S_IROTH));
+	permissions  segment_perm(read_mode | (read_mode >> 1));
+
+	shared_memory_object shm_object(open_or_create, segment_name.c_str(),
+		read_write, segment_perm);
+
+	std::size_t segment_size = std::max<std::size_t>(slot_count, 1) *
+		sizeof(MFStoreNotifyWaiter);
+	offset_t    current_size = 0;
+
+	/*
+		Every process sizes the segment identically, so a race to extend it
+		is harmless. It is never shrunk beneath another process's mapping.
+	*/
+	if ((!shm_object.get_size(current_size)) ||
+		(current_size < static_cast<offset_t>(segment_size)))
+		shm_object.truncate(static_cast<offset_t>(segment_size));
+
+	return(std::make_shared<MappedRegion>(shm_object, read_write, 0,
+		segment_size));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __linux__
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNotify::MFStoreNotify(MFStoreControl &mfstore_ctl,
+	std::size_t notify_section_index)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,section_index_(notify_section_index)
+	,slot_count_(0)
+	,slot_list_(nullptr)
+	,waiter_region_sptr_()
+	,waiter_list_(nullptr)
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(notify_section_index);
+		if (section.element_size_ != sizeof(MFStoreNotifySlot))
+			throw std::invalid_argument("The section element size (" +
+				std::to_string(section.element_size_) + ") is not equal to the "
+				"size of an MFStoreNotifySlot (" +
+				std::to_string(sizeof(MFStoreNotifySlot)) + ").");
+		if (section.section_offset_ % alignof(MFStoreNotifySlot))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreNotifySlot)) + "-byte "
+				"boundary.");
+		slot_count_ = static_cast<std::size_t>(section.element_count_);
+		slot_list_  =
+			mfstore_ctl.GetPtr<MFStoreNotifySlot>(section.section_offset_);
+#ifdef __linux__
+		waiter_region_sptr_ = OpenWaiterRegion(mfstore_ctl.GetFileName(),
+			notify_section_index, slot_count_);
+		waiter_list_        = static_cast<MFStoreNotifyWaiter *>(
+			waiter_region_sptr_->get_address());
+#endif // #ifdef __linux__
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(notify_section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' for change notification: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreNotify::GetSectionIndex() const
+{
+	return(section_index_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreNotify::GetSlotCount() const
+{
+	return(slot_count_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreNotify::GetGeneration(std::size_t slot_index) const
+{
+	return(GetSlot(slot_index).generation_.load(std::memory_order_acquire));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreNotify::GetWaiterCount(std::size_t slot_index) const
+{
+	static_cast<void>(GetSlot(slot_index));
+
+	return((waiter_list_) ?
+		waiter_list_[slot_index].waiter_count_.load(std::memory_order_seq_cst) :
+		0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreNotify::Advance(std::size_t slot_index, bool wake_flag)
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	// Sequentially consistent so that Wake() can't miss a new waiter.
+	uint32_t new_generation = GetSlot(slot_index).generation_.fetch_add(1,
+		std::memory_order_seq_cst) + 1;
+
+	if (wake_flag)
+		Wake(slot_index);
+
+	return(new_generation);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreNotify::Wake(std::size_t slot_index)
+{
+#ifdef __linux__
+	MFStoreNotifySlot &slot = GetSlot(slot_index);
+
+	if (!waiter_list_[slot_index].waiter_count_.load(std::memory_order_seq_cst))
+		return;
+
+	if (FutexHelper(&slot.generation_, FUTEX_WAKE, INT_MAX, nullptr) < 0)
+		MLB::Utility::ThrowErrno("Call to ::syscall(SYS_futex, FUTEX_WAKE) "
+			"failed");
+#else
+	static_cast<void>(GetSlot(slot_index));
+#endif // #ifdef __linux__
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreNotify::WaitForChange(std::size_t slot_index,
+	uint32_t last_generation) const
+{
+	return(WaitForChange(slot_index, last_generation, WaitTimeout::max()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t MFStoreNotify::WaitForChange(std::size_t slot_index,
+	uint32_t last_generation, const WaitTimeout &wait_timeout) const
+{
+	using Clock = std::chrono::steady_clock;
+
+	MFStoreNotifySlot &slot     = GetSlot(slot_index);
+	bool               infinite = (wait_timeout == WaitTimeout::max());
+	Clock::time_point  end_time = (infinite) ? Clock::time_point::max() :
+		(Clock::now() + wait_timeout);
+
+	for ( ; ; ) {
+		uint32_t this_generation =
+			slot.generation_.load(std::memory_order_acquire);
+		if (this_generation != last_generation)
+			return(this_generation);
+		WaitTimeout time_left = (infinite) ? WaitTimeout::max() :
+			std::chrono::duration_cast<WaitTimeout>(end_time - Clock::now());
+		if (time_left.count() <= 0)
+			break;
+#ifdef __linux__
+		struct timespec  timeout_spec;
+		struct timespec *timeout_ptr = nullptr;
+		if (!infinite) {
+			timeout_spec.tv_sec  = static_cast<time_t>(time_left.count() /
+				1000000000LL);
+			timeout_spec.tv_nsec = static_cast<long>(time_left.count() %
+				1000000000LL);
+			timeout_ptr          = &timeout_spec;
+		}
+		/*
+			The waiter count is raised before the generation is checked again,
+			so that either the writer sees the waiter or the waiter sees the
+			new generation. The kernel re-checks the generation, so a wake
+			can't be lost between that check and the wait.
+		*/
+		std::atomic<uint32_t> &waiter_count =
+			waiter_list_[slot_index].waiter_count_;
+		waiter_count.fetch_add(1, std::memory_order_seq_cst);
+		long futex_result = (slot.generation_.load(std::memory_order_seq_cst) !=
+			last_generation) ? 0 : FutexHelper(&slot.generation_, FUTEX_WAIT,
+			last_generation, timeout_ptr);
+		int  futex_errno  = errno;
+		waiter_count.fetch_sub(1, std::memory_order_seq_cst);
+		if ((futex_result < 0) && (futex_errno != EAGAIN) &&
+			(futex_errno != EINTR) && (futex_errno != ETIMEDOUT))
+			MLB::Utility::ThrowErrno(futex_errno, "Call to ::syscall(SYS_futex, "
+				"FUTEX_WAIT) failed");
+#else
+		std::this_thread::sleep_for(std::min<WaitTimeout>(time_left,
+			std::chrono::milliseconds(1)));
+#endif // #ifdef __linux__
+	}
+
+	return(last_generation);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreNotify::MakeNotifySection(std::size_t slot_count,
+	const std::string &description)
+{
+	return(MFStoreSection(0, sizeof(MFStoreNotifySlot), slot_count, 0, 0, 0,
+		0, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Removes the shared memory segment holding the waiter counts for the
+	notify section of the specified store. This should be done only when no
+	process has the notify section open, as a process opening it afterwards
+	would count its waiters in a new segment unseen by existing writers.
+
+	Returns true if the segment existed.
+*/
+bool MFStoreNotify::RemoveWaiterSegment(const std::string &file_name,
+	std::size_t notify_section_index)
+{
+#ifdef __linux__
+	struct stat stat_data;
+
+	return(boost::interprocess::shared_memory_object::remove(
+		GetWaiterSegmentName(file_name, notify_section_index,
+		stat_data).c_str()));
+#else
+	static_cast<void>(file_name);
+	static_cast<void>(notify_section_index);
+
+	return(false);
+#endif // #ifdef __linux__
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNotifySlot &MFStoreNotify::GetSlot(std::size_t slot_index) const
+{
+	if (slot_index >= slot_count_)
+		throw std::invalid_argument("The notification slot index (" +
+			std::to_string(slot_index) + ") is not less than the number of "
+			"slots (" + std::to_string(slot_count_) + ").");
+
+	return(slot_list_[slot_index]);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNotifyBatch::MFStoreNotifyBatch(MFStoreNotify &notify)
+	:notify_(notify)
+	,touched_list_(notify.GetSlotCount(), false)
+	,touched_flag_(false)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNotifyBatch::~MFStoreNotifyBatch()
+{
+	try {
+		Commit();
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreNotifyBatch::Touch(std::size_t slot_index)
+{
+	if (slot_index >= touched_list_.size())
+		throw std::invalid_argument("The notification slot index (" +
+			std::to_string(slot_index) + ") is not less than the number of "
+			"slots (" + std::to_string(touched_list_.size()) + ").");
+
+	touched_list_[slot_index] = true;
+	touched_flag_             = true;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Advances every touched slot before waking any of them, so that a reader
+	woken for one slot sees the new generations of all of them.
+*/
+void MFStoreNotifyBatch::Commit()
+{
+	if (!touched_flag_)
+		return;
+
+	for (std::size_t slot_idx = 0; slot_idx < touched_list_.size(); ++slot_idx) {
+		if (touched_list_[slot_idx])
+			notify_.Advance(slot_idx, false);
+	}
+
+	for (std::size_t slot_idx = 0; slot_idx < touched_list_.size(); ++slot_idx) {
+		if (touched_list_[slot_idx]) {
+			notify_.Wake(slot_idx);
+			touched_list_[slot_idx] = false;
+		}
+	}
+
+	touched_flag_ = false;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+#ifdef __unix
+# include <sys/wait.h>
+#endif // #ifdef __unix
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreNotify.bin");
+const uint32_t    TEST_BatchCount = 1000;
+const uint32_t    TEST_BatchSize  = 10;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+int TEST_Reader(MFStoreLen file_size, const MFStoreSectionList &section_list)
+{
+	MFStoreControl mfstore_ctl(TEST_FileName, false, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreNotify  notify(mfstore_ctl, 1);
+	uint32_t       last_generation = 0;
+	uint32_t       wake_count      = 0;
+
+	while (last_generation < TEST_BatchCount) {
+		uint32_t new_generation = notify.WaitForChange(2, last_generation,
+			std::chrono::seconds(10));
+		if (new_generation == last_generation) {
+			std::cerr << "Reader timed out at generation " << last_generation <<
+				std::endl;
+			return(EXIT_FAILURE);
+		}
+		last_generation = new_generation;
+		++wake_count;
+	}
+
+	std::cout << "Reader observed generation " << last_generation << " after " <<
+		wake_count << " wake-ups." << std::endl;
+
+	return(EXIT_SUCCESS);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_WaiterCount(MFStoreLen file_size,
+	const MFStoreSectionList &section_list, MFStoreControl &writer_ctl,
+	MFStoreNotify &writer_notify)
+{
+	const char  *slot_ptr        = writer_ctl.GetPtr<char>(
+		section_list[1].section_offset_);
+	std::string  slot_image(slot_ptr, sizeof(MFStoreNotifySlot));
+	uint32_t     last_generation = writer_notify.GetGeneration(0);
+	uint32_t     new_generation  = last_generation;
+	std::thread  reader_thread([&]() {
+		MFStoreControl reader_ctl(TEST_FileName, false, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreNotify  reader_notify(reader_ctl, 1);
+		new_generation = reader_notify.WaitForChange(0, last_generation,
+			std::chrono::seconds(10));
+	});
+
+	auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+	while ((!writer_notify.GetWaiterCount(0)) &&
+		(std::chrono::steady_clock::now() < end_time))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	uint32_t waiter_count = writer_notify.GetWaiterCount(0);
+	bool     store_intact = (!::memcmp(slot_image.data(), slot_ptr,
+		sizeof(MFStoreNotifySlot)));
+
+	writer_notify.Advance(0);
+	reader_thread.join();
+
+	if (waiter_count != 1)
+		throw std::logic_error("Expected the blocked reader to be counted as "
+			"a waiter, but the waiter count was " +
+			std::to_string(waiter_count) + ".");
+
+	if (!store_intact)
+		throw std::logic_error("The blocked reader modified the notify slot "
+			"in the store.");
+
+	if (new_generation != (last_generation + 1))
+		throw std::logic_error("The counted reader was not woken by the "
+			"writer.");
+
+	if (writer_notify.GetWaiterCount(0))
+		throw std::logic_error("The waiter count was not restored when the "
+			"reader was woken.");
+
+	std::cout << "Reader waiter count: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreNotify()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreNotify::MakeNotifySection(3),
+		section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, 64, 1024, 0, 0, 0, 0, 0,
+		"Data"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+	MFStoreNotify::RemoveWaiterSegment(TEST_FileName, 1);
+
+	MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreNotify  notify(mfstore_ctl, 1);
+
+#ifdef __unix
+	pid_t child_pid = ::fork();
+
+	if (child_pid < 0)
+		ThrowErrno("Call to ::fork() failed");
+	else if (!child_pid)
+		::_exit(TEST_Reader(file_size, section_list));
+
+	for (uint32_t count_1 = 0; count_1 < TEST_BatchCount; ++count_1) {
+		MFStoreNotifyBatch batch(notify);
+		for (uint32_t count_2 = 0; count_2 < TEST_BatchSize; ++count_2) {
+			mfstore_ctl.GetPtr<uint32_t>(section_list[2].section_offset_)
+				[((count_1 * TEST_BatchSize) + count_2) % 1024] = count_1;
+			batch.Touch(2);
+		}
+		if (!(count_1 % 100))
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	int child_status = 0;
+
+	if (::waitpid(child_pid, &child_status, 0) < 0)
+		ThrowErrno("Call to ::waitpid() failed");
+
+	if ((!WIFEXITED(child_status)) || (WEXITSTATUS(child_status) != 0))
+		throw std::runtime_error("The reader process failed.");
+#endif // #ifdef __unix
+
+#ifdef __linux__
+	TEST_WaiterCount(file_size, section_list, mfstore_ctl, notify);
+#endif // #ifdef __linux__
+
+#ifndef __unix
+	static_cast<void>(notify.Advance(2));
+#endif // #ifndef __unix
+
+	MFStoreNotify::RemoveWaiterSegment(TEST_FileName, 1);
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MFStoreNotify();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -0,0 +1,746 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreNuma.cpp
+
+   File Description  :  Implementation of the MFStore NUMA placement support.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreNuma.hpp>
+
+#include <Utility/ArgCheck.hpp>
+#include <Utility/PageSize.hpp>
+#include <Utility/ThrowErrno.hpp>
+
+#ifdef __linux__
+# include <linux/mempolicy.h>
+# include <sched.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif // #ifdef __linux__
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+#ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Parses the kernel's list format (for example, "0-3,8,10-11").
+*/
+MFStoreNumaNodeList ParseKernelList(const std::string &src)
+{
+	MFStoreNumaNodeList out_list;
+	std::istringstream  i_str(src);
+	std::string         this_range;
+
+	while (std::getline(i_str, this_range, ',')) {
+		if (this_range.empty() || (this_range[0] == '\n'))
+			continue;
+		std::size_t dash_pos = this_range.find('-');
+		int         first    = std::stoi(this_range.substr(0, dash_pos));
+		int         last     = (dash_pos == std::string::npos) ? first :
+			std::stoi(this_range.substr(dash_pos + 1));
+		for ( ; first <= last; ++first)
+			out_list.push_back(first);
+	}
+
+	return(out_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaNodeList GetOnlineNodeList()
+{
+	std::ifstream       i_str("/sys/devices/system/node/online");
+	std::string         node_text;
+	MFStoreNumaNodeList node_list;
+
+	if (std::getline(i_str, node_text))
+		node_list = ParseKernelList(node_text);
+
+	if (node_list.empty())
+		node_list.push_back(0);
+
+	return(node_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaNodeList ResolveNodeList(const MFStoreNumaNodeList &node_list)
+{
+	if (node_list.empty())
+		return(GetOnlineNodeList());
+
+	int node_count = GetNumaNodeCount();
+
+	for (const auto &this_node : node_list) {
+		if ((this_node < 0) || (this_node >= node_count))
+			throw std::invalid_argument("The NUMA node " +
+				std::to_string(this_node) + " is not in the range of online "
+				"nodes (0 through " + std::to_string(node_count - 1) + ").");
+	}
+
+	return(node_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MBindHelper(void *mmap_address, MFStoreLen mmap_length, int mbind_mode,
+	const MFStoreNumaNodeList &node_list, unsigned int mbind_flags)
+{
+	const std::size_t          word_bits = sizeof(unsigned long) * 8;
+	std::vector<unsigned long> node_mask(1, 0);
+
+	for (const auto &this_node : node_list) {
+		std::size_t word_index = static_cast<std::size_t>(this_node) / word_bits;
+		if (word_index >= node_mask.size())
+			node_mask.resize(word_index + 1, 0);
+		node_mask[word_index] |= 1UL << (static_cast<std::size_t>(this_node) %
+			word_bits);
+	}
+
+	/*
+		The kernel decrements the maximum node number before using it, so
+		we pass one more than the number of bits in the mask.
+	*/
+	if (::syscall(SYS_mbind, mmap_address, mmap_length, mbind_mode,
+		(mbind_mode == MPOL_DEFAULT) ? nullptr : node_mask.data(),
+		(mbind_mode == MPOL_DEFAULT) ? 0 : ((node_mask.size() * word_bits) + 1),
+		mbind_flags) != 0)
+		MLB::Utility::ThrowErrno("Call to ::mbind() failed");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckApplyArgs(const void *mmap_address, MFStoreLen mmap_length)
+{
+	MLB::Utility::ThrowIfNull(mmap_address, "The mmap address");
+
+	if (!mmap_length)
+		throw std::invalid_argument("The mmap length is 0.");
+
+	if (reinterpret_cast<uintptr_t>(mmap_address) %
+		MLB::Utility::GetPageSize())
+		throw std::invalid_argument("The mmap address is not aligned on a "
+			"page boundary.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaPolicy::MFStoreNumaPolicy(MFStoreNumaMode mode,
+	const MFStoreNumaNodeList &node_list, bool move_pages)
+	:mode_(mode)
+	,node_list_(node_list)
+	,move_pages_(move_pages)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreNumaPolicy::IsDefault() const
+{
+	return(mode_ == MFStoreNumaMode::Default);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreNumaPolicy::ToStream(std::ostream &o_str) const
+{
+	o_str << "Mode=" << ModeToString(mode_) << ", Nodes=";
+
+	if (node_list_.empty())
+		o_str << "All";
+	else {
+		for (std::size_t count_1 = 0; count_1 < node_list_.size(); ++count_1)
+			o_str << ((count_1) ? "," : "") << node_list_[count_1];
+	}
+
+	o_str << ", Move=" << ((move_pages_) ? "Y" : "N");
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string MFStoreNumaPolicy::ToString() const
+{
+	std::ostringstream o_str;
+
+	ToStream(o_str);
+
+	return(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *MFStoreNumaPolicy::ModeToString(MFStoreNumaMode mode)
+{
+	switch (mode) {
+		case MFStoreNumaMode::Default    : return("Default");
+		case MFStoreNumaMode::Bind       : return("Bind");
+		case MFStoreNumaMode::Preferred  : return("Preferred");
+		case MFStoreNumaMode::Interleave : return("Interleave");
+		case MFStoreNumaMode::Replicate  : return("Replicate");
+		default                          : break;
+	}
+
+	return("*INVALID*");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreNumaPolicy::Apply(void *mmap_address, MFStoreLen mmap_length,
+	const MFStoreNumaPolicy &policy)
+{
+	try {
+		CheckApplyArgs(mmap_address, mmap_length);
+#ifdef __linux__
+		MFStoreNumaNodeList node_list(ResolveNodeList(policy.node_list_));
+		unsigned int        mbind_flags = (policy.move_pages_) ?
+			MPOL_MF_MOVE : 0;
+		switch (policy.mode_) {
+			case MFStoreNumaMode::Default    :
+				MBindHelper(mmap_address, mmap_length, MPOL_DEFAULT, node_list,
+					0);
+				break;
+			case MFStoreNumaMode::Bind       :
+				MBindHelper(mmap_address, mmap_length, MPOL_BIND, node_list,
+					mbind_flags);
+				break;
+			case MFStoreNumaMode::Preferred  :
+				if (node_list.size() != 1)
+					throw std::invalid_argument("Preferred mode requires exactly "
+						"one node.");
+				MBindHelper(mmap_address, mmap_length, MPOL_PREFERRED, node_list,
+					mbind_flags);
+				break;
+			case MFStoreNumaMode::Interleave :
+				MBindHelper(mmap_address, mmap_length, MPOL_INTERLEAVE,
+					node_list, mbind_flags);
+				break;
+			case MFStoreNumaMode::Replicate  :
+				throw std::invalid_argument("Replicate mode can't be applied to "
+					"a mapping; use an MFStoreNumaReplica instead.");
+			default                          :
+				throw std::invalid_argument("Invalid MFStoreNumaMode value (" +
+					std::to_string(static_cast<int>(policy.mode_)) + ").");
+		}
+#else
+		throw std::logic_error("No logic to implement MFStore NUMA policies "
+			"is available.");
+#endif // #ifdef __linux__
+	}
+	catch (const std::exception &except) {
+		std::ostringstream o_str;
+		o_str << "Attempt to apply the NUMA policy (" << policy << ") to the " <<
+			mmap_length << " bytes at address " << mmap_address <<
+			" failed: " << except.what();
+		throw std::runtime_error(o_str.str());
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaPlacement::MFStoreNumaPlacement()
+	:page_count_(0)
+	,absent_count_(0)
+	,node_page_count_()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the node on which most of the resident pages reside, or -1 if no
+	pages are resident.
+*/
+int MFStoreNumaPlacement::GetPrincipalNode() const
+{
+	auto max_iter = std::max_element(node_page_count_.begin(),
+		node_page_count_.end());
+
+	return(((max_iter == node_page_count_.end()) || (!(*max_iter))) ? -1 :
+		static_cast<int>(max_iter - node_page_count_.begin()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreNumaPlacement::ToStream(std::ostream &o_str) const
+{
+	o_str << "Pages=" << page_count_ << ", Absent=" << absent_count_;
+
+	for (std::size_t count_1 = 0; count_1 < node_page_count_.size(); ++count_1)
+		o_str << ", Node" << count_1 << "=" << node_page_count_[count_1];
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string MFStoreNumaPlacement::ToString() const
+{
+	std::ostringstream o_str;
+
+	ToStream(o_str);
+
+	return(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaPlacement MFStoreNumaPlacement::Get(const void *mmap_address,
+	MFStoreLen mmap_length)
+{
+	MFStoreNumaPlacement placement;
+
+	try {
+		CheckApplyArgs(mmap_address, mmap_length);
+#ifdef __linux__
+		const std::size_t   batch_size = 4096;
+		std::size_t         page_size  = MLB::Utility::GetPageSize();
+		std::vector<void *> page_list;
+		std::vector<int>    status_list(batch_size);
+		const char         *page_ptr   = static_cast<const char *>(mmap_address);
+		const char         *end_ptr    = page_ptr + mmap_length;
+		placement.node_page_count_.resize(
+			static_cast<std::size_t>(GetNumaNodeCount()), 0);
+		page_list.reserve(batch_size);
+		while (page_ptr < end_ptr) {
+			page_list.clear();
+			for ( ; (page_ptr < end_ptr) && (page_list.size() < batch_size);
+				page_ptr += page_size)
+				page_list.push_back(const_cast<char *>(page_ptr));
+			// With a null node list, move_pages() only reports each page's node.
+			if (::syscall(SYS_move_pages, 0, page_list.size(), page_list.data(),
+				nullptr, status_list.data(), 0) != 0)
+				MLB::Utility::ThrowErrno("Call to ::move_pages() failed");
+			for (std::size_t count_1 = 0; count_1 < page_list.size(); ++count_1) {
+				int this_status = status_list[count_1];
+				if (this_status < 0)
+					++placement.absent_count_;
+				else {
+					if (static_cast<std::size_t>(this_status) >=
+						placement.node_page_count_.size())
+						placement.node_page_count_.resize(
+							static_cast<std::size_t>(this_status) + 1, 0);
+					++placement.node_page_count_[
+						static_cast<std::size_t>(this_status)];
+				}
+			}
+			placement.page_count_ += page_list.size();
+		}
+#else
+		throw std::logic_error("No logic to report NUMA placement is "
+			"available.");
+#endif // #ifdef __linux__
+	}
+	catch (const std::exception &except) {
+		std::ostringstream o_str;
+		o_str << "Unable to determine the NUMA placement of the " <<
+			mmap_length << " bytes at address " << mmap_address << ": " <<
+			except.what();
+		throw std::runtime_error(o_str.str());
+	}
+
+	return(placement);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaReplica::MFStoreNumaReplica(const void *src_ptr,
+	MFStoreLen src_length, const MFStoreNumaNodeList &node_list)
+try
+	:src_ptr_(src_ptr)
+	,src_length_(src_length)
+	,mmap_length_(((src_length + MLB::Utility::GetPageSize() - 1) /
+		MLB::Utility::GetPageSize()) * MLB::Utility::GetPageSize())
+	,node_list_()
+	,replica_list_()
+{
+	MLB::Utility::ThrowIfNull(src_ptr, "The replica source address");
+
+	if (!src_length)
+		throw std::invalid_argument("The replica source length is 0.");
+
+#ifdef __linux__
+	node_list_ = ResolveNodeList(node_list);
+
+	replica_list_.resize(static_cast<std::size_t>(GetNumaNodeCount()), nullptr);
+
+	try {
+		for (const auto &this_node : node_list_) {
+			void *&replica_ptr = replica_list_[static_cast<std::size_t>(this_node)];
+			if (replica_ptr)
+				continue;
+			replica_ptr = ::mmap(nullptr, mmap_length_, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (replica_ptr == MAP_FAILED) {
+				replica_ptr = nullptr;
+				MLB::Utility::ThrowErrno("Call to ::mmap() failed");
+			}
+			MBindHelper(replica_ptr, mmap_length_, MPOL_BIND,
+				MFStoreNumaNodeList(1, this_node), 0);
+		}
+		Refresh();
+	}
+	catch (...) {
+		Release();
+		throw;
+	}
+#else
+	static_cast<void>(node_list);
+	throw std::logic_error("No logic to implement NUMA replicas is "
+		"available.");
+#endif // #ifdef __linux__
+}
+catch (const std::exception &except) {
+	std::ostringstream o_str;
+	o_str << "Unable to replicate the " << src_length << " bytes at address " <<
+		src_ptr << " across NUMA nodes: " << except.what();
+	throw std::runtime_error(o_str.str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaReplica::~MFStoreNumaReplica()
+{
+	Release();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Each copy is written by the calling thread, but the pages of each are
+	bound to their node and so are allocated there on first touch.
+*/
+void MFStoreNumaReplica::Refresh()
+{
+	for (auto &this_replica : replica_list_) {
+		if (this_replica)
+			::memcpy(this_replica, src_ptr_, src_length_);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const void *MFStoreNumaReplica::GetPtr(int node) const
+{
+	if ((node < 0) || (static_cast<std::size_t>(node) >= replica_list_.size()) ||
+		(!replica_list_[static_cast<std::size_t>(node)]))
+		throw std::invalid_argument("There is no replica on NUMA node " +
+			std::to_string(node) + ".");
+
+	return(replica_list_[static_cast<std::size_t>(node)]);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const void *MFStoreNumaReplica::GetLocalPtr() const
+{
+	std::size_t node = static_cast<std::size_t>(GetNumaCurrentNode());
+
+	return(((node < replica_list_.size()) && replica_list_[node]) ?
+		replica_list_[node] : src_ptr_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreNumaReplica::GetLength() const
+{
+	return(src_length_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreNumaNodeList &MFStoreNumaReplica::GetNodeList() const
+{
+	return(node_list_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreNumaPlacement MFStoreNumaReplica::GetPlacement(int node) const
+{
+	return(MFStoreNumaPlacement::Get(GetPtr(node), mmap_length_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreNumaReplica::Release()
+{
+#ifdef __linux__
+	for (auto &this_replica : replica_list_) {
+		if (this_replica) {
+			::munmap(this_replica, mmap_length_);
+			this_replica = nullptr;
+		}
+	}
+#endif // #ifdef __linux__
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+int GetNumaNodeCount()
+{
+#ifdef __linux__
+	static const int node_count = GetOnlineNodeList().back() + 1;
+
+	return(node_count);
+#else
+	return(1);
+#endif // #ifdef __linux__
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+int GetNumaCurrentNode()
+{
+#ifdef __linux__
+	unsigned int cpu  = 0;
+	unsigned int node = 0;
+
+	// The glibc wrapper uses the vDSO, which avoids a system call.
+# if defined(__GLIBC__) && __GLIBC_PREREQ(2, 29)
+	if (::getcpu(&cpu, &node) != 0)
+		return(0);
+# else
+	if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+		return(0);
+# endif // # if defined(__GLIBC__) && __GLIBC_PREREQ(2, 29)
+
+	return(static_cast<int>(node));
+#else
+	return(0);
+#endif // #ifdef __linux__
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreNumaPolicy &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreNumaPlacement &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/MFStoreControl.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <numeric>
+#include <random>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreNuma.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_BoundIndex      = 1;
+const std::size_t TEST_InterleaveIndex = 2;
+const std::size_t TEST_ReplicaIndex    = 3;
+const uint64_t    TEST_SlotCount       = 1ULL << 20;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Returns the average latency of a dependent random walk through the slots.
+double TEST_ChaseLatency(const uint32_t *slot_ptr)
+{
+	const uint64_t step_count = 1ULL << 21;
+	uint32_t       slot_index = 0;
+
+	auto start_time = std::chrono::steady_clock::now();
+	for (uint64_t count_1 = 0; count_1 < step_count; ++count_1)
+		slot_index = slot_ptr[slot_index];
+	auto end_time   = std::chrono::steady_clock::now();
+
+	if (slot_index >= TEST_SlotCount)
+		throw std::logic_error("The chase left the section.");
+
+	return(std::chrono::duration<double, std::nano>(end_time -
+		start_time).count() / static_cast<double>(step_count));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreNuma()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint32_t),
+		TEST_SlotCount, 0, 0, 0, 0, 0, "Bound"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint32_t),
+		TEST_SlotCount, 0, 0, 0, 0, 0, "Interleaved"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint32_t),
+		TEST_SlotCount, 0, 0, 0, 0, 0, "Replicated"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+
+	std::cout << "NUMA nodes online: " << GetNumaNodeCount() <<
+		", current node: " << GetNumaCurrentNode() << std::endl;
+
+	mfstore_ctl.ApplyNumaPolicy({
+		{ TEST_BoundIndex,
+			MFStoreNumaPolicy(MFStoreNumaMode::Bind,
+			MFStoreNumaNodeList(1, GetNumaCurrentNode())) },
+		{ TEST_InterleaveIndex,
+			MFStoreNumaPolicy(MFStoreNumaMode::Interleave) }
+		});
+
+	// Each section holds a single random cycle through all of its slots.
+	std::vector<uint32_t> order_list(TEST_SlotCount);
+	std::iota(order_list.begin(), order_list.end(), 0);
+	std::shuffle(order_list.begin() + 1, order_list.end(), std::mt19937(42));
+	for (std::size_t section_index = 1; section_index < section_list.size();
+		++section_index) {
+		uint32_t *slot_ptr = mfstore_ctl.GetPtr<uint32_t>(
+			section_list[section_index].section_offset_);
+		for (uint64_t count_1 = 0; count_1 < TEST_SlotCount; ++count_1)
+			slot_ptr[order_list[count_1]] =
+				order_list[(count_1 + 1) % TEST_SlotCount];
+	}
+
+	mfstore_ctl.ApplyNumaPolicy(TEST_ReplicaIndex,
+		MFStoreNumaPolicy(MFStoreNumaMode::Replicate));
+
+	const MFStoreNumaReplica *replica_ptr =
+		mfstore_ctl.GetNumaReplica(TEST_ReplicaIndex);
+	if (!replica_ptr)
+		throw std::logic_error("No replica was created for the replicated "
+			"section.");
+	for (const auto &this_node : replica_ptr->GetNodeList()) {
+		MFStoreNumaPlacement placement = replica_ptr->GetPlacement(this_node);
+		if (placement.GetPrincipalNode() != this_node)
+			throw std::logic_error("The replica for node " +
+				std::to_string(this_node) + " resides elsewhere (" +
+				placement.ToString() + ").");
+		std::cout << "Replica on node " << this_node << ": " << placement <<
+			std::endl;
+	}
+
+	for (std::size_t section_index = 1; section_index < section_list.size();
+		++section_index)
+		std::cout << std::left << std::setw(12) <<
+			section_list[section_index].description_ << std::right << ": " <<
+			mfstore_ctl.GetNumaPlacement(section_index) << std::endl;
+
+	const uint32_t *local_ptr =
+		mfstore_ctl.GetSectionPtrLocal<uint32_t>(TEST_ReplicaIndex);
+	if (::memcmp(local_ptr, mfstore_ctl.GetPtr<uint32_t>(
+		section_list[TEST_ReplicaIndex].section_offset_),
+		TEST_SlotCount * sizeof(uint32_t)))
+		throw std::logic_error("The local replica differs from the section.");
+
+	mfstore_ctl.GetPtr<uint32_t>(
+		section_list[TEST_ReplicaIndex].section_offset_)[1] ^= 1;
+	if (local_ptr[1] == mfstore_ctl.GetPtr<uint32_t>(
+		section_list[TEST_ReplicaIndex].section_offset_)[1])
+		throw std::logic_error("The replica saw a change before its refresh.");
+	mfstore_ctl.RefreshNumaReplicas();
+	if (local_ptr[1] != mfstore_ctl.GetPtr<uint32_t>(
+		section_list[TEST_ReplicaIndex].section_offset_)[1])
+		throw std::logic_error("The replica missed a change after its refresh.");
+	mfstore_ctl.GetPtr<uint32_t>(
+		section_list[TEST_ReplicaIndex].section_offset_)[1] ^= 1;
+	mfstore_ctl.RefreshNumaReplicas();
+
+	std::cout << std::fixed << std::setprecision(1) <<
+		"Dependent load latency: bound "     << TEST_ChaseLatency(
+			mfstore_ctl.GetPtr<uint32_t>(
+			section_list[TEST_BoundIndex].section_offset_)) << " ns, "
+		"interleaved " << TEST_ChaseLatency(mfstore_ctl.GetPtr<uint32_t>(
+			section_list[TEST_InterleaveIndex].section_offset_)) << " ns, "
+		"local replica " << TEST_ChaseLatency(local_ptr) << " ns" << std::endl;
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MFStoreNuma();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
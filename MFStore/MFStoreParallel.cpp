@@ -0,0 +1,400 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreParallel.cpp
+
+   File Description  :  Implementation of parallel section initialization
+                        and checksum support.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreParallel.hpp>
+#include <MFStore/Crc32c.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+unsigned int ResolveThreadCount(unsigned int thread_count,
+	uint64_t item_count, uint64_t min_items_per_thread)
+{
+	if (!thread_count)
+		thread_count = std::max(1U, std::thread::hardware_concurrency());
+
+	min_items_per_thread = std::max<uint64_t>(1, min_items_per_thread);
+
+	uint64_t max_threads = std::max<uint64_t>(1,
+		item_count / min_items_per_thread);
+
+	return(static_cast<unsigned int>(
+		std::min<uint64_t>(thread_count, max_threads)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreParallelFor(uint64_t item_count, unsigned int thread_count,
+	const MFStoreParallelFunc &chunk_func, uint64_t min_items_per_thread)
+{
+	if (!item_count)
+		return;
+
+	thread_count = ResolveThreadCount(thread_count, item_count,
+		min_items_per_thread);
+
+	uint64_t                 chunk_base  = item_count / thread_count;
+	uint64_t                 chunk_extra = item_count % thread_count;
+	std::mutex               except_mutex;
+	std::exception_ptr       first_except;
+	std::vector<std::thread> thread_list;
+
+	auto run_chunk = [&](unsigned int chunk_index) {
+		uint64_t first_item = (chunk_index * chunk_base) +
+			std::min<uint64_t>(chunk_index, chunk_extra);
+		uint64_t chunk_size = chunk_base + ((chunk_index < chunk_extra) ? 1 : 0);
+		try {
+			chunk_func(chunk_index, first_item, chunk_size);
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> except_lock(except_mutex);
+			if (!first_except)
+				first_except = std::current_exception();
+		}
+	};
+
+	thread_list.reserve(thread_count - 1);
+
+	try {
+		for (unsigned int chunk_index = 1; chunk_index < thread_count;
+			++chunk_index)
+			thread_list.emplace_back(run_chunk, chunk_index);
+	}
+	catch (...) {
+		for (auto &this_thread : thread_list)
+			this_thread.join();
+		throw;
+	}
+
+	run_chunk(0);
+
+	for (auto &this_thread : thread_list)
+		this_thread.join();
+
+	if (first_except)
+		std::rethrow_exception(first_except);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+// Don't bother starting another thread for less than this many bytes.
+const uint64_t MinBytesPerThread = 1ULL << 20;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void FillElements(char *dst_ptr, uint64_t element_count,
+	const void *template_ptr, std::size_t template_size,
+	std::size_t element_size)
+{
+	if (!element_count)
+		return;
+
+	::memcpy(dst_ptr, template_ptr, template_size);
+
+	if (template_size < element_size)
+		::memset(dst_ptr + template_size, '\0', element_size - template_size);
+
+	// Double the initialized region with each copy...
+	uint64_t done_length  = element_size;
+	uint64_t total_length = element_count * element_size;
+
+	while (done_length < total_length) {
+		uint64_t copy_length = std::min(done_length, total_length - done_length);
+		::memcpy(dst_ptr + done_length, dst_ptr,
+			static_cast<std::size_t>(copy_length));
+		done_length += copy_length;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+void InitSectionParallel(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, const void *template_ptr,
+	std::size_t template_size, unsigned int thread_count)
+{
+	try {
+		mfstore_ctl.CheckIsWriter();
+		MLB::Utility::ThrowIfNull(template_ptr, "The template element pointer");
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if ((!template_size) || (template_size > section.element_size_))
+			throw std::invalid_argument("The template element size (" +
+				std::to_string(template_size) + ") is not in the range of 1 to "
+				"the section element size (" +
+				std::to_string(section.element_size_) + "), inclusive.");
+		char       *section_ptr  =
+			mfstore_ctl.GetPtr<char>(section.section_offset_);
+		std::size_t element_size =
+			static_cast<std::size_t>(section.element_size_);
+		MFStoreParallelFor(section.element_count_, thread_count,
+			[&](unsigned int, uint64_t first_element, uint64_t element_count) {
+				FillElements(section_ptr + (first_element * element_size),
+					element_count, template_ptr, template_size, element_size);
+			}, std::max<uint64_t>(1, MinBytesPerThread / element_size));
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to initialize the elements of the "
+			"section at index " + std::to_string(section_index) + ": " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t CalcSectionChecksum(const MFStoreControl &mfstore_ctl,
+	std::size_t section_index, unsigned int thread_count)
+{
+	const MFStoreSection &section = mfstore_ctl.GetSectionMapped(section_index);
+
+	return(Crc32cParallel(mfstore_ctl.GetPtr<char>(section.section_offset_),
+		section.length_actual_, thread_count));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void UpdateSectionChecksums(MFStoreControl &mfstore_ctl,
+	std::size_t section_list_index, unsigned int thread_count)
+{
+	mfstore_ctl.CheckIsWriter();
+
+	MFStoreSectionList section_list(mfstore_ctl.GetSectionList());
+
+	for (std::size_t section_idx = 0; section_idx < section_list.size();
+		++section_idx) {
+		if (section_idx == section_list_index)
+			continue;
+		section_list[section_idx].reserved_       =
+			CalcSectionChecksum(mfstore_ctl, section_idx, thread_count);
+		section_list[section_idx].section_flags_ |=
+			MFStoreSection::FlagChecksum;
+	}
+
+	mfstore_ctl.SetSectionList(section_list);
+	mfstore_ctl.WriteSectionList(section_list_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void VerifySectionChecksums(MFStoreControl &mfstore_ctl,
+	std::size_t section_list_index, unsigned int thread_count)
+{
+	mfstore_ctl.ReadSectionList(section_list_index);
+
+	const MFStoreSectionList &section_list = mfstore_ctl.GetSectionList();
+
+	for (const auto &this_section : section_list) {
+		if (!(this_section.section_flags_ & MFStoreSection::FlagChecksum))
+			continue;
+		uint32_t checksum = CalcSectionChecksum(mfstore_ctl,
+			static_cast<std::size_t>(this_section.section_index_), thread_count);
+		if (checksum != this_section.reserved_) {
+			std::ostringstream o_str;
+			o_str << "The CRC-32C checksum of the section at index " <<
+				this_section.section_index_ << " ('" << this_section.description_ <<
+				"') of MFStore file '" << mfstore_ctl.GetFileName() << "' is 0x" <<
+				std::hex << checksum << ", but the section list records 0x" <<
+				this_section.reserved_ << ".";
+			throw std::runtime_error(o_str.str());
+		}
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <chrono>
+#include <filesystem>
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreParallel.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Record
+{
+	uint64_t record_id_;
+	double   record_value_;
+	char     record_name_[48];
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Crc32c()
+{
+	const char test_vector[] = "123456789";
+
+	if (Crc32c(test_vector, 9) != 0xE3069283)
+		throw std::logic_error("The CRC-32C of '123456789' is incorrect.");
+
+	std::vector<char> test_data(3 * 1024 * 1024 + 17);
+
+	for (std::size_t count_1 = 0; count_1 < test_data.size(); ++count_1)
+		test_data[count_1] = static_cast<char>((count_1 * 131) ^ (count_1 >> 9));
+
+	uint32_t crc_serial   = Crc32c(test_data.data(), test_data.size());
+	uint32_t crc_chained  = Crc32c(test_data.data() + 1000,
+		test_data.size() - 1000, Crc32c(test_data.data(), 1000));
+	uint32_t crc_combined = Crc32cCombine(Crc32c(test_data.data(), 1000),
+		Crc32c(test_data.data() + 1000, test_data.size() - 1000),
+		test_data.size() - 1000);
+	uint32_t crc_parallel = Crc32cParallel(test_data.data(), test_data.size(),
+		4);
+
+	if ((crc_chained != crc_serial) || (crc_combined != crc_serial) ||
+		(crc_parallel != crc_serial))
+		throw std::logic_error("The chained, combined and parallel CRC-32C "
+			"values do not match the serial value.");
+
+	std::cout << "CRC-32C: OK (" << ((Crc32cIsHardware()) ? "hardware" :
+		"software") << ")" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_InitAndVerify(uint64_t record_count)
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(MFStoreSection), 3,
+		0, 0, 0, 0, 0, "Section List"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(TEST_Record),
+		record_count, 0, 0, 0, 0, 0, "Records"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	MFStoreLen file_size = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		TEST_Record    template_record = { 0, 1.5, "template" };
+		auto           time_start = std::chrono::steady_clock::now();
+		InitSectionParallel(mfstore_ctl, 2, template_record);
+		auto           time_init  = std::chrono::steady_clock::now();
+		UpdateSectionChecksums(mfstore_ctl);
+		auto           time_crc   = std::chrono::steady_clock::now();
+		std::cout << "Initialized " << record_count << " records in " <<
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+			time_init - time_start).count() << " ms, checksummed in " <<
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+			time_crc - time_init).count() << " ms" << std::endl;
+	}
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, false, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		VerifySectionChecksums(mfstore_ctl);
+		if (std::strcmp(mfstore_ctl.GetPtr<TEST_Record>(
+			section_list[2].section_offset_)[record_count - 1].record_name_,
+			"template"))
+			throw std::logic_error("The last record was not initialized.");
+		MFStoreSection::ToStreamTabular(mfstore_ctl.GetSectionList()) << '\n';
+	}
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		mfstore_ctl.GetPtr<TEST_Record>(
+			section_list[2].section_offset_)[record_count / 2].record_value_ = 2.0;
+		bool detected = false;
+		try {
+			VerifySectionChecksums(mfstore_ctl);
+		}
+		catch (const std::exception &except) {
+			std::cout << "Corruption detected: " << except.what() << std::endl;
+			detected = true;
+		}
+		if (!detected)
+			throw std::logic_error("The modification of a record was not "
+				"detected by the checksum verification.");
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Crc32c();
+		TEST_InitAndVerify(1000000);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -0,0 +1,351 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreReplicaTransport.cpp
+
+   File Description  :  Implementation of the MFStore replication transports.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreReplicaTransport.hpp>
+#include <MFStore/CheckValues.hpp>
+#include <MFStore/Crc32c.hpp>
+
+#include <Utility/ThrowErrno.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#ifdef __unix
+# include <errno.h>
+# include <unistd.h>
+#endif // #ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicaTransport::~MFStoreReplicaTransport()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicaApplier::MFStoreReplicaApplier(MFStoreControl &standby_ctl,
+	bool flush_on_commit)
+	:standby_ctl_(standby_ctl)
+	,flush_on_commit_(flush_on_commit)
+	,applied_sequence_(0)
+	,staged_sequence_(0)
+	,staged_list_()
+	,staged_data_()
+{
+	standby_ctl_.CheckIsWriter();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicaApplier::SendRange(uint64_t sequence, MFStoreOff offset,
+	MFStoreLen length, const void *data_ptr)
+{
+	try {
+		if (sequence <= applied_sequence_)
+			throw std::invalid_argument("The range sequence number (" +
+				std::to_string(sequence) + ") is not greater than that of the "
+				"last commit applied (" + std::to_string(applied_sequence_) +
+				").");
+		CheckExtent(standby_ctl_.GetMmapSize(), offset, length);
+		if (sequence != staged_sequence_) {
+			staged_list_.clear();
+			staged_data_.clear();
+			staged_sequence_ = sequence;
+		}
+		const char *src_ptr = static_cast<const char *>(data_ptr);
+		staged_data_.insert(staged_data_.end(), src_ptr, src_ptr + length);
+		staged_list_.emplace_back(offset, length);
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to apply the replicated range of " +
+			std::to_string(length) + " bytes at offset " +
+			std::to_string(offset) + " to standby MFStore file '" +
+			standby_ctl_.GetFileName() + "': " + std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicaApplier::SendCommit(uint64_t sequence)
+{
+	if (sequence <= applied_sequence_)
+		throw std::runtime_error("The replication commit sequence number (" +
+			std::to_string(sequence) + ") for standby MFStore file '" +
+			standby_ctl_.GetFileName() + "' is not greater than that of the "
+			"last commit applied (" + std::to_string(applied_sequence_) + ").");
+
+	if (sequence == staged_sequence_) {
+		const char *src_ptr = staged_data_.data();
+		for (const auto &this_range : staged_list_) {
+			::memcpy(standby_ctl_.GetPtr<char>(this_range.offset_), src_ptr,
+				static_cast<std::size_t>(this_range.length_));
+			src_ptr += this_range.length_;
+		}
+		if (flush_on_commit_)
+			FlushStagedRanges();
+	}
+
+	staged_list_.clear();
+	staged_data_.clear();
+
+	applied_sequence_ = sequence;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicaApplier::FlushStagedRanges()
+{
+	MFStoreRangeList run_list(staged_list_);
+
+	std::sort(run_list.begin(), run_list.end(),
+		[](const MFStoreRange &lhs, const MFStoreRange &rhs) {
+			return(lhs.offset_ < rhs.offset_);
+		});
+
+	/*
+		Overlapping and adjacent ranges are merged so that each run of the
+		standby written by this commit is synchronised with a single call.
+	*/
+	std::size_t run_count = 0;
+
+	for (const auto &this_range : run_list) {
+		if (run_count &&
+			(this_range.offset_ <= run_list[run_count - 1].CalcEndOffset())) {
+			MFStoreRange &last_run = run_list[run_count - 1];
+			last_run.length_ = std::max(last_run.CalcEndOffset(),
+				this_range.CalcEndOffset()) - last_run.offset_;
+		}
+		else
+			run_list[run_count++] = this_range;
+	}
+
+	for (std::size_t run_idx = 0; run_idx < run_count; ++run_idx)
+		standby_ctl_.Flush(run_list[run_idx].offset_,
+			run_list[run_idx].length_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreReplicaApplier::GetAppliedSequence() const
+{
+	return(applied_sequence_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t CalcHeaderCrc(const MFStoreReplicaRecord &record)
+{
+	return(Crc32c(&record, offsetof(MFStoreReplicaRecord, header_crc_)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void WriteAll(int stream_fd, const void *data_ptr, std::size_t data_length)
+{
+	const char *tmp_ptr = static_cast<const char *>(data_ptr);
+
+	while (data_length) {
+		ssize_t write_count = ::write(stream_fd, tmp_ptr, data_length);
+		if (write_count < 0) {
+			if (errno == EINTR)
+				continue;
+			MLB::Utility::ThrowErrno("Call to ::write() for " +
+				std::to_string(data_length) + " bytes failed");
+		}
+		tmp_ptr     += write_count;
+		data_length -= static_cast<std::size_t>(write_count);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Returns false if end-of-file is reached before any data is read.
+*/
+bool ReadAll(int stream_fd, void *data_ptr, std::size_t data_length)
+{
+	char        *tmp_ptr    = static_cast<char *>(data_ptr);
+	std::size_t  done_count = 0;
+
+	while (done_count < data_length) {
+		ssize_t read_count = ::read(stream_fd, tmp_ptr + done_count,
+			data_length - done_count);
+		if (read_count < 0) {
+			if (errno == EINTR)
+				continue;
+			MLB::Utility::ThrowErrno("Call to ::read() for " +
+				std::to_string(data_length - done_count) + " bytes failed");
+		}
+		else if (!read_count) {
+			if (!done_count)
+				return(false);
+			throw std::runtime_error("The replication stream ended after " +
+				std::to_string(done_count) + " of the " +
+				std::to_string(data_length) + " bytes expected.");
+		}
+		done_count += static_cast<std::size_t>(read_count);
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreLen MFStoreReplicaStreamTransport::StreamChunkLength;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicaStreamTransport::MFStoreReplicaStreamTransport(int stream_fd)
+	:stream_fd_(stream_fd)
+	,send_buffer_()
+{
+	if (stream_fd_ < 0)
+		throw std::invalid_argument("The replication stream file descriptor "
+			"(" + std::to_string(stream_fd_) + ") is invalid.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The primary may be modifying the range as it is sent, and so each chunk
+	is copied before its checksum is calculated. A torn chunk is re-sent by
+	the next replication pass.
+*/
+void MFStoreReplicaStreamTransport::SendRange(uint64_t sequence,
+	MFStoreOff offset, MFStoreLen length, const void *data_ptr)
+{
+	const char *src_ptr = static_cast<const char *>(data_ptr);
+
+	do {
+		MFStoreLen chunk_length = std::min(length, StreamChunkLength);
+		send_buffer_.assign(src_ptr, src_ptr + chunk_length);
+		SendRecord(MFStoreReplicaRecord::RecordRange, sequence, offset,
+			chunk_length, send_buffer_.data());
+		src_ptr += chunk_length;
+		offset  += chunk_length;
+		length  -= chunk_length;
+	} while (length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicaStreamTransport::SendCommit(uint64_t sequence)
+{
+	SendRecord(MFStoreReplicaRecord::RecordCommit, sequence, 0, 0, nullptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicaStreamTransport::SendRecord(uint32_t record_type,
+	uint64_t sequence, MFStoreOff offset, MFStoreLen length,
+	const void *data_ptr)
+{
+	MFStoreReplicaRecord record;
+
+	::memset(&record, '\0', sizeof(record));
+
+	record.magic_       = MFStoreReplicaRecord::RecordMagic;
+	record.record_type_ = record_type;
+	record.sequence_    = sequence;
+	record.offset_      = offset;
+	record.length_      = length;
+	record.data_crc_    = (length) ? Crc32c(data_ptr, length) : 0;
+	record.header_crc_  = CalcHeaderCrc(record);
+
+	try {
+		WriteAll(stream_fd_, &record, sizeof(record));
+		if (length)
+			WriteAll(stream_fd_, data_ptr, length);
+	}
+	catch (const std::exception &except) {
+		throw std::runtime_error("Unable to send a replication record with "
+			"sequence number " + std::to_string(sequence) + ": " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t ReceiveReplicaStream(int stream_fd, MFStoreReplicaTransport &target)
+{
+	uint64_t             last_commit = 0;
+	MFStoreReplicaRecord record;
+	std::vector<char>    data_buffer;
+
+	while (ReadAll(stream_fd, &record, sizeof(record))) {
+		if ((record.magic_ != MFStoreReplicaRecord::RecordMagic) ||
+			(record.header_crc_ != CalcHeaderCrc(record)))
+			throw std::runtime_error("Invalid replication record header "
+				"received after the commit with sequence number " +
+				std::to_string(last_commit) + ".");
+		if (record.record_type_ == MFStoreReplicaRecord::RecordCommit) {
+			target.SendCommit(record.sequence_);
+			last_commit = record.sequence_;
+			continue;
+		}
+		else if (record.record_type_ != MFStoreReplicaRecord::RecordRange)
+			throw std::runtime_error("Invalid replication record type (" +
+				std::to_string(record.record_type_) + ") received.");
+		else if (record.length_ >
+			MFStoreReplicaStreamTransport::StreamChunkLength)
+			throw std::runtime_error("The replicated range of " +
+				std::to_string(record.length_) + " bytes at offset " +
+				std::to_string(record.offset_) + " is longer than the maximum "
+				"of " + std::to_string(
+				MFStoreReplicaStreamTransport::StreamChunkLength) + " bytes.");
+		data_buffer.resize(static_cast<std::size_t>(record.length_));
+		if (!ReadAll(stream_fd, data_buffer.data(), data_buffer.size()))
+			throw std::runtime_error("The replication stream ended before the "
+				"data of the range at offset " + std::to_string(record.offset_) +
+				" was received.");
+		if (Crc32c(data_buffer.data(), data_buffer.size()) != record.data_crc_)
+			throw std::runtime_error("The checksum of the replicated range of " +
+				std::to_string(record.length_) + " bytes at offset " +
+				std::to_string(record.offset_) + " is incorrect.");
+		target.SendRange(record.sequence_, record.offset_, record.length_,
+			data_buffer.data());
+	}
+
+	return(last_commit);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __unix
+
+} // namespace MFStore
+
+} // namespace MLB
+
@@ -0,0 +1,693 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreReplicator.cpp
+
+   File Description  :  Implementation of the MFStoreReplicator class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreReplicator.hpp>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicatorStats::MFStoreReplicatorStats()
+	:pass_count_(0)
+	,commit_count_(0)
+	,range_count_(0)
+	,byte_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreReplicatorStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Passes=" << pass_count_
+		<< ", Commits=" << commit_count_
+		<< ", Ranges=" << range_count_
+		<< ", Bytes=" << byte_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicator::MFStoreReplicator(MFStoreControl &primary_ctl,
+	const MFStoreReplicaTransportSPtr &transport_sptr,
+	const ReplicateInterval &replicate_interval, MFStoreLen granule,
+	bool start_flag)
+	:primary_ctl_(primary_ctl)
+	,transport_sptr_(transport_sptr)
+	,dirty_map_(primary_ctl.GetMmapSize(), granule)
+	,range_list_()
+	,notify_ptr_(nullptr)
+	,generation_list_()
+	,sequence_(0)
+	,pass_mutex_()
+	,stats_()
+	,replicate_thread_(replicate_interval, [this]() { ReplicatePass(); })
+{
+	if (!transport_sptr_)
+		throw std::invalid_argument("The MFStore replication transport is "
+			"NULL.");
+
+	if (start_flag)
+		Start();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicator::~MFStoreReplicator()
+{
+	try {
+		Stop();
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::MarkDirty(MFStoreOff offset, MFStoreLen length)
+{
+	dirty_map_.MarkDirty(offset, length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::MarkDirtySection(std::size_t section_index)
+{
+	dirty_map_.MarkDirtySection(primary_ctl_.GetSectionMapped(section_index));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::MarkDirtyElements(std::size_t section_index,
+	uint64_t element_index, uint64_t element_count)
+{
+	dirty_map_.MarkDirtyElements(primary_ctl_.GetSectionMapped(section_index),
+		element_index, element_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::MarkAll()
+{
+	dirty_map_.MarkDirty(0, primary_ctl_.GetMmapSize());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Slot \e n of the notification section carries the generation of section
+	\e n. The generations current at the time of the call are taken as
+	already replicated. When a generation changes, both the section and its
+	slot are sent, so that readers of the standby see the same generation.
+*/
+void MFStoreReplicator::TrackGenerations(const MFStoreNotify &notify)
+{
+	std::lock_guard<std::mutex> pass_lock(pass_mutex_);
+
+	std::size_t slot_count = std::min(notify.GetSlotCount(),
+		primary_ctl_.GetSectionList().size());
+
+	generation_list_.resize(slot_count);
+
+	for (std::size_t slot_index = 0; slot_index < slot_count; ++slot_index)
+		generation_list_[slot_index] = notify.GetGeneration(slot_index);
+
+	notify_ptr_ = &notify;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreReplicator::Replicate()
+{
+	replicate_thread_.RethrowException();
+
+	ReplicatePass();
+
+	return(GetSequence());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::Start()
+{
+	replicate_thread_.Start();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Stops the background thread and performs a final pass.
+*/
+void MFStoreReplicator::Stop()
+{
+	replicate_thread_.Stop();
+
+	replicate_thread_.RethrowException();
+
+	ReplicatePass();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreReplicator::IsRunning() const
+{
+	return(replicate_thread_.IsRunning());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreReplicator::GetSequence() const
+{
+	std::lock_guard<std::mutex> pass_lock(pass_mutex_);
+
+	return(sequence_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreReplicatorStats MFStoreReplicator::GetStats() const
+{
+	std::lock_guard<std::mutex> pass_lock(pass_mutex_);
+
+	return(stats_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::ReplicatePass()
+{
+	std::lock_guard<std::mutex> pass_lock(pass_mutex_);
+
+	MarkChangedGenerations();
+
+	dirty_map_.Harvest(range_list_);
+
+	++stats_.pass_count_;
+
+	if (range_list_.empty())
+		return;
+
+	uint64_t next_sequence = sequence_ + 1;
+
+	try {
+		for (const auto &this_range : range_list_)
+			transport_sptr_->SendRange(next_sequence, this_range.offset_,
+				this_range.length_,
+				primary_ctl_.GetPtr<char>(this_range.offset_));
+		transport_sptr_->SendCommit(next_sequence);
+	}
+	catch (const std::exception &except) {
+		// So that the ranges are sent again by the next pass...
+		for (const auto &this_range : range_list_)
+			dirty_map_.MarkDirty(this_range.offset_, this_range.length_);
+		throw std::runtime_error("Attempt to replicate " +
+			std::to_string(range_list_.size()) + " changed ranges of MFStore "
+			"file '" + primary_ctl_.GetFileName() + "' with sequence number " +
+			std::to_string(next_sequence) + " failed: " +
+			std::string(except.what()));
+	}
+
+	sequence_ = next_sequence;
+
+	++stats_.commit_count_;
+
+	stats_.range_count_ += range_list_.size();
+
+	for (const auto &this_range : range_list_)
+		stats_.byte_count_ += this_range.length_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreReplicator::MarkChangedGenerations()
+{
+	if (!notify_ptr_)
+		return;
+
+	for (std::size_t slot_index = 0; slot_index < generation_list_.size();
+		++slot_index) {
+		uint32_t generation = notify_ptr_->GetGeneration(slot_index);
+		if (generation != generation_list_[slot_index]) {
+			MarkDirtySection(slot_index);
+			MarkDirtyElements(notify_ptr_->GetSectionIndex(), slot_index);
+			generation_list_[slot_index] = generation;
+		}
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreReplicatorStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/Crc32c.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+
+#ifdef __unix
+# include <sys/wait.h>
+# include <unistd.h>
+#endif // #ifdef __unix
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_PrimaryName("./TEST_MAIN.MFStoreReplicator.primary.bin");
+const std::string TEST_StandbyName("./TEST_MAIN.MFStoreReplicator.standby.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_NotifyIndex  = 1;
+const std::size_t TEST_RecordsIndex = 2;
+const uint64_t    TEST_RecordCount  = 100000;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreNotify::MakeNotifySection(3),
+		section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, 64, TEST_RecordCount, 0, 0,
+		0, 0, 0, "Records"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CompareStores(const MFStoreControl &primary_ctl,
+	const MFStoreControl &standby_ctl, const char *test_name)
+{
+	if (::memcmp(primary_ctl.GetPtr<char>(0), standby_ctl.GetPtr<char>(0),
+		primary_ctl.GetMmapSize()))
+		throw std::logic_error(std::string(test_name) + ": the standby copy "
+			"does not match the primary.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_UpdateRecords(MFStoreControl &primary_ctl,
+	MFStoreReplicator &replicator, uint64_t first_record, uint64_t step_count)
+{
+	char *records_ptr = primary_ctl.GetPtr<char>(
+		primary_ctl.GetSectionMapped(TEST_RecordsIndex).section_offset_);
+
+	for (uint64_t record_index = first_record;
+		record_index < TEST_RecordCount; record_index += step_count) {
+		::snprintf(records_ptr + (record_index * 64), 64, "Record %llu",
+			static_cast<unsigned long long>(record_index));
+		replicator.MarkDirtyElements(TEST_RecordsIndex, record_index);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_LocalReplica()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_PrimaryName);
+	std::filesystem::remove(TEST_StandbyName);
+
+	CreateMFStore(TEST_PrimaryName, file_size, file_size);
+	CreateMFStore(TEST_StandbyName, file_size, file_size);
+
+	MFStoreControl primary_ctl(TEST_PrimaryName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreControl standby_ctl(TEST_StandbyName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreNotify  notify(primary_ctl, TEST_NotifyIndex);
+
+	auto           applier_sptr =
+		std::make_shared<MFStoreReplicaApplier>(standby_ctl, false);
+
+	::memset(primary_ctl.GetPtr<char>(0), 'P', 4096);
+
+	MFStoreReplicator replicator(primary_ctl, applier_sptr,
+		MFStoreReplicator::ReplicateInterval(10), 0, false);
+
+	replicator.MarkAll();
+	replicator.TrackGenerations(notify);
+
+	if (replicator.Replicate() != 1)
+		throw std::logic_error("The initial replication pass did not commit "
+			"sequence number 1.");
+
+	TEST_CompareStores(primary_ctl, standby_ctl, "Initial copy");
+
+	MFStoreReplicatorStats stats_before = replicator.GetStats();
+
+	TEST_UpdateRecords(primary_ctl, replicator, 17, 1000);
+
+	// A change announced only through the notification generation...
+	primary_ctl.GetPtr<char>(0)[100] = 'Q';
+	notify.Advance(0);
+
+	replicator.Replicate();
+
+	TEST_CompareStores(primary_ctl, standby_ctl, "Incremental copy");
+
+	MFStoreReplicatorStats stats_after = replicator.GetStats();
+	uint64_t               byte_count  =
+		stats_after.byte_count_ - stats_before.byte_count_;
+
+	if (applier_sptr->GetAppliedSequence() != 2)
+		throw std::logic_error("The standby did not apply sequence number 2.");
+
+	if (byte_count >= (file_size / 4))
+		throw std::logic_error("The incremental pass copied " +
+			std::to_string(byte_count) + " bytes of a " +
+			std::to_string(file_size) + " byte store.");
+
+	if (replicator.Replicate() != 2)
+		throw std::logic_error("A pass without changes committed a new "
+			"sequence number.");
+
+	MFStoreNotify::RemoveWaiterSegment(TEST_PrimaryName, TEST_NotifyIndex);
+
+	std::cout << "Local replication: OK (" << stats_after << "; incremental "
+		"pass copied " << byte_count << " of " << file_size << " bytes)" <<
+		std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_StagedApply()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_StandbyName);
+
+	CreateMFStore(TEST_StandbyName, file_size, file_size);
+
+	MFStoreControl        standby_ctl(TEST_StandbyName, true, file_size,
+		file_size, MFStoreAllocGran, section_list);
+	MFStoreReplicaApplier applier(standby_ctl, false);
+	const char           *standby_ptr = standby_ctl.GetPtr<char>(0);
+
+	applier.SendRange(1, 0, 4, "AAAA");
+	applier.SendRange(1, 4096, 4, "BBBB");
+
+	if (standby_ptr[0] || standby_ptr[4096])
+		throw std::logic_error("The standby was modified before the commit of "
+			"the pass.");
+
+	applier.SendCommit(1);
+
+	if (::memcmp(standby_ptr, "AAAA", 4) ||
+		::memcmp(standby_ptr + 4096, "BBBB", 4))
+		throw std::logic_error("The committed ranges were not applied to the "
+			"standby.");
+
+	// The ranges of an abandoned pass are discarded...
+	applier.SendRange(2, 0, 4, "CCCC");
+	applier.SendRange(3, 4096, 4, "DDDD");
+	applier.SendCommit(3);
+
+	if (::memcmp(standby_ptr, "AAAA", 4) ||
+		::memcmp(standby_ptr + 4096, "DDDD", 4))
+		throw std::logic_error("The ranges of an uncommitted pass were applied "
+			"to the standby.");
+
+	std::cout << "Staged apply: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+class TEST_FailingTransport : public MFStoreReplicaTransport
+{
+public:
+	void SendRange(uint64_t, MFStoreOff, MFStoreLen, const void *) override
+	{
+		throw std::runtime_error("Simulated transport failure.");
+	}
+	void SendCommit(uint64_t) override
+	{
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_ThreadFailure()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_PrimaryName);
+
+	CreateMFStore(TEST_PrimaryName, file_size, file_size);
+
+	MFStoreControl    primary_ctl(TEST_PrimaryName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreReplicator replicator(primary_ctl,
+		std::make_shared<TEST_FailingTransport>(),
+		MFStoreReplicator::ReplicateInterval(5));
+
+	replicator.MarkAll();
+
+	auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+	while (replicator.IsRunning() &&
+		(std::chrono::steady_clock::now() < end_time))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	if (replicator.IsRunning())
+		throw std::logic_error("The replicator still reports that it is "
+			"running after its thread failed.");
+
+	try {
+		replicator.Replicate();
+	}
+	catch (const std::exception &) {
+		std::cout << "Thread failure: OK" << std::endl;
+		return;
+	}
+
+	throw std::logic_error("The failure of the replication thread was not "
+		"re-thrown.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_OversizedRecord()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_StandbyName);
+
+	CreateMFStore(TEST_StandbyName, file_size, file_size);
+
+	MFStoreControl        standby_ctl(TEST_StandbyName, true, file_size,
+		file_size, MFStoreAllocGran, section_list);
+	MFStoreReplicaApplier applier(standby_ctl, false);
+	MFStoreReplicaRecord  record;
+
+	::memset(&record, '\0', sizeof(record));
+
+	record.magic_       = MFStoreReplicaRecord::RecordMagic;
+	record.record_type_ = MFStoreReplicaRecord::RecordRange;
+	record.sequence_    = 1;
+	record.length_      = ~uint64_t(0);
+	record.header_crc_  =
+		Crc32c(&record, offsetof(MFStoreReplicaRecord, header_crc_));
+
+	int pipe_fds[2];
+
+	if (::pipe(pipe_fds) != 0)
+		throw std::runtime_error("Call to ::pipe() failed.");
+
+	bool rejected = false;
+
+	if (::write(pipe_fds[1], &record, sizeof(record)) ==
+		static_cast<ssize_t>(sizeof(record))) {
+		::close(pipe_fds[1]);
+		try {
+			ReceiveReplicaStream(pipe_fds[0], applier);
+		}
+		catch (const std::exception &) {
+			rejected = true;
+		}
+	}
+	else
+		::close(pipe_fds[1]);
+
+	::close(pipe_fds[0]);
+
+	if (!rejected)
+		throw std::logic_error("A range record longer than the maximum chunk "
+			"length was not rejected.");
+
+	std::cout << "Oversized record: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_StreamReplica()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_PrimaryName);
+	std::filesystem::remove(TEST_StandbyName);
+
+	CreateMFStore(TEST_PrimaryName, file_size, file_size);
+	CreateMFStore(TEST_StandbyName, file_size, file_size);
+
+	int pipe_fds[2];
+
+	if (::pipe(pipe_fds) != 0)
+		throw std::runtime_error("Call to ::pipe() failed.");
+
+	pid_t child_pid = ::fork();
+
+	if (child_pid < 0)
+		throw std::runtime_error("Call to ::fork() failed.");
+	else if (!child_pid) {
+		::close(pipe_fds[1]);
+		int exit_code = EXIT_SUCCESS;
+		try {
+			MFStoreControl        standby_ctl(TEST_StandbyName, true, file_size,
+				file_size, MFStoreAllocGran, section_list);
+			MFStoreReplicaApplier applier(standby_ctl);
+			uint64_t              last_commit =
+				ReceiveReplicaStream(pipe_fds[0], applier);
+			std::cout << "Standby process applied through sequence number " <<
+				last_commit << std::endl;
+		}
+		catch (const std::exception &except) {
+			std::cerr << "Standby process failed: " << except.what() <<
+				std::endl;
+			exit_code = EXIT_FAILURE;
+		}
+		::_exit(exit_code);
+	}
+
+	::close(pipe_fds[0]);
+
+	{
+		MFStoreControl primary_ctl(TEST_PrimaryName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreReplicator replicator(primary_ctl,
+			std::make_shared<MFStoreReplicaStreamTransport>(pipe_fds[1]),
+			MFStoreReplicator::ReplicateInterval(5));
+		replicator.MarkAll();
+		for (uint64_t pass_index = 0; pass_index < 20; ++pass_index) {
+			TEST_UpdateRecords(primary_ctl, replicator, pass_index, 997);
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		replicator.Stop();
+		std::cout << "Stream replication primary: " << replicator.GetStats() <<
+			std::endl;
+	}
+
+	::close(pipe_fds[1]);
+
+	int child_status = 0;
+
+	::waitpid(child_pid, &child_status, 0);
+
+	if ((!WIFEXITED(child_status)) ||
+		(WEXITSTATUS(child_status) != EXIT_SUCCESS))
+		throw std::logic_error("The standby process failed.");
+
+	MFStoreControl primary_ctl(TEST_PrimaryName, false, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreControl standby_ctl(TEST_StandbyName, false, file_size, file_size,
+		MFStoreAllocGran, section_list);
+
+	TEST_CompareStores(primary_ctl, standby_ctl, "Stream copy");
+
+	std::cout << "Stream replication: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __unix
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_LocalReplica();
+		TEST_StagedApply();
+		TEST_ThreadFailure();
+#ifdef __unix
+		TEST_OversizedRecord();
+		TEST_StreamReplica();
+#endif // #ifdef __unix
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	std::filesystem::remove(TEST_PrimaryName);
+	std::filesystem::remove(TEST_StandbyName);
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
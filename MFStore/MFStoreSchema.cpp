@@ -0,0 +1,265 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSchema.cpp
+
+   File Description  :  Implementation of the run-time checks of the
+                        MFStoreSchema class template.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreSchema.hpp>
+
+#include <cstring>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Throws unless the actual section list begins with sections matching
+	those of the expected list in description, element size, element count
+	and offset.
+*/
+void CheckSchemaSectionList(const MFStoreSectionList &expected_list,
+	const MFStoreSection *actual_ptr, std::size_t actual_count,
+	const std::string &list_source)
+{
+	if (actual_count < expected_list.size())
+		throw std::invalid_argument("The " + list_source + " has " +
+			std::to_string(actual_count) + " sections, but the schema has " +
+			std::to_string(expected_list.size()) + ".");
+
+	for (std::size_t section_index = 0; section_index < expected_list.size();
+		++section_index) {
+		const MFStoreSection &expected = expected_list[section_index];
+		const MFStoreSection &actual   = actual_ptr[section_index];
+		if ((actual.element_size_ != expected.element_size_) ||
+			(actual.element_count_ != expected.element_count_) ||
+			(actual.section_offset_ != expected.section_offset_) ||
+			::strncmp(actual.description_, expected.description_,
+			sizeof(actual.description_)))
+			throw std::invalid_argument("The section at index " +
+				std::to_string(section_index) + " of the " + list_source +
+				" ('" + std::string(actual.description_, ::strnlen(
+				actual.description_, sizeof(actual.description_))) + "' with " +
+				std::to_string(actual.element_count_) + " elements of " +
+				std::to_string(actual.element_size_) + " bytes at offset " +
+				std::to_string(actual.section_offset_) + ") does not match the "
+				"schema section ('" + std::string(expected.description_) +
+				"' with " + std::to_string(expected.element_count_) +
+				" elements of " + std::to_string(expected.element_size_) +
+				" bytes at offset " + std::to_string(expected.section_offset_) +
+				").");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <filesystem>
+#include <numeric>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreSchema.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_HeaderBlock
+{
+	char header_data_[4096];
+};
+
+struct TEST_Tick
+{
+	uint64_t time_;
+	double   price_;
+	uint32_t quantity_;
+	uint32_t flags_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MLB_MFSTORE_SCHEMA_SECTION(Header,      TEST_HeaderBlock, 1);
+MLB_MFSTORE_SCHEMA_SECTION(SectionList, MFStoreSection,   4);
+MLB_MFSTORE_SCHEMA_SECTION(Ticks,       TEST_Tick,        100000);
+MLB_MFSTORE_SCHEMA_SECTION(Counters,    uint64_t,         1000);
+
+using TEST_Schema = MFStoreSchema<Header, SectionList, Ticks, Counters>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+namespace Altered {
+
+MLB_MFSTORE_SCHEMA_SECTION(Counters, uint64_t, 1001);
+
+using TEST_Schema = MFStoreSchema<Header, SectionList, Ticks, Counters>;
+
+} // namespace Altered
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+static_assert(TEST_Schema::SectionCount == 4, "Incorrect section count.");
+static_assert(TEST_Schema::IndexOf<Ticks>() == 2, "Incorrect section index.");
+static_assert(TEST_Schema::OffsetOf<Header>() == 0, "Incorrect offset.");
+static_assert(TEST_Schema::OffsetOf<SectionList>() == MFStoreAllocGran,
+	"Incorrect offset.");
+static_assert(TEST_Schema::OffsetOf<Ticks>() == (2 * MFStoreAllocGran),
+	"Incorrect offset.");
+static_assert(TEST_Schema::OffsetOf<Counters>() ==
+	(TEST_Schema::OffsetOf<Ticks>() + (37 * MFStoreAllocGran)),
+	"Incorrect offset.");
+static_assert(TEST_Schema::StoreLength ==
+	(TEST_Schema::OffsetOf<Counters>() + MFStoreAllocGran),
+	"Incorrect store length.");
+static_assert(Altered::TEST_Schema::StoreLength == TEST_Schema::StoreLength,
+	"The altered schema should have the same layout.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Schema_Binding()
+{
+	const MFStoreLen file_size = TEST_Schema::StoreLength;
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, TEST_Schema::MakeSectionList());
+		mfstore_ctl.WriteSectionList(TEST_Schema::IndexOf<SectionList>());
+		TEST_Schema    schema(mfstore_ctl, TEST_Schema::IndexOf<SectionList>());
+		auto           tick_span    = schema.Get<Ticks>();
+		auto           counter_span = schema.Get<Counters>();
+		if ((tick_span.size() != Ticks::ElementCount) ||
+			(counter_span.size() != Counters::ElementCount))
+			throw std::logic_error("The section spans have incorrect sizes.");
+		if (reinterpret_cast<char *>(tick_span.data()) !=
+			mfstore_ctl.GetPtr<char>(mfstore_ctl.GetSectionMapped(
+			TEST_Schema::IndexOf<Ticks>()).section_offset_))
+			throw std::logic_error("The tick span doesn't refer to the tick "
+				"section.");
+		for (std::size_t tick_index = 0; tick_index < tick_span.size();
+			++tick_index)
+			tick_span[tick_index] = TEST_Tick{tick_index, 100.0 +
+				static_cast<double>(tick_index % 100), 100, 0};
+		for (auto &this_counter : counter_span)
+			this_counter = 7;
+	}
+
+	{
+		MFStoreControl    mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, TEST_Schema::MakeSectionList());
+		const TEST_Schema schema(mfstore_ctl,
+			TEST_Schema::IndexOf<SectionList>());
+		auto              tick_span    = schema.Get<Ticks>();
+		auto              counter_span = schema.Get<Counters>();
+		uint64_t          time_sum     = 0;
+		for (const auto &this_tick : tick_span)
+			time_sum += this_tick.time_;
+		if ((time_sum != ((Ticks::ElementCount * (Ticks::ElementCount - 1)) / 2))
+			|| (std::accumulate(counter_span.begin(), counter_span.end(),
+			uint64_t(0)) != (7 * Counters::ElementCount)))
+			throw std::logic_error("The data read through the schema is "
+				"incorrect.");
+		std::cout << "Typed access through the schema: OK" << std::endl;
+	}
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, false, file_size, file_size,
+			MFStoreAllocGran, Altered::TEST_Schema::MakeSectionList());
+		bool           rejected_flag = false;
+		Altered::TEST_Schema unchecked_schema(mfstore_ctl);
+		try {
+			Altered::TEST_Schema schema(mfstore_ctl,
+				Altered::TEST_Schema::IndexOf<SectionList>());
+		}
+		catch (const std::exception &except) {
+			rejected_flag = true;
+			std::cout << "Altered schema rejected: " << except.what() <<
+				std::endl;
+		}
+		if (!rejected_flag)
+			throw std::logic_error("A schema which doesn't match the persisted "
+				"section list was accepted.");
+	}
+
+	{
+		MFStoreSectionList section_list(TEST_Schema::MakeSectionList());
+		section_list.pop_back();
+		MFStoreSection::FixupSectionList(section_list);
+		MFStoreControl     mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		bool               rejected_flag = false;
+		try {
+			TEST_Schema schema(mfstore_ctl);
+		}
+		catch (const std::exception &) {
+			rejected_flag = true;
+		}
+		if (!rejected_flag)
+			throw std::logic_error("A schema with more sections than the "
+				"section list was accepted.");
+		std::cout << "Mismatched section lists rejected: OK" << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Schema_Binding();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
@@ -0,0 +1,517 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSlab.cpp
+
+   File Description  :  Implementation of the MFStoreSlab class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreSlab.hpp>
+
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The free list head holds a slot index in its low 32 bits and an ABA tag
+	in its high 32 bits, so a slab may have no more slots than the mask.
+*/
+const uint64_t SlabIndexMask = 0x00000000FFFFFFFFULL;
+const uint64_t SlabTagUnit   = 0x0000000100000000ULL;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckSlotCount(uint64_t slot_count)
+{
+	if (slot_count > SlabIndexMask)
+		throw std::invalid_argument("The slab slot count (" +
+			std::to_string(slot_count) + ") exceeds the maximum of " +
+			std::to_string(SlabIndexMask) + ".");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSlab::MFStoreSlab(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, bool format_flag)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,section_offset_(0)
+	,section_ptr_(nullptr)
+	,header_ptr_(nullptr)
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if ((section.element_size_ < sizeof(uint64_t)) ||
+			(section.element_size_ % sizeof(uint64_t)))
+			throw std::invalid_argument("The section element size (" +
+				std::to_string(section.element_size_) + ") is not a non-zero "
+				"multiple of " + std::to_string(sizeof(uint64_t)) + ".");
+		if (section.element_count_ <= CalcHeaderSlots(section.element_size_))
+			throw std::invalid_argument("The section element count (" +
+				std::to_string(section.element_count_) + ") leaves no room for "
+				"slots after the slab header.");
+		CheckSlotCount(section.element_count_);
+		if (section.section_offset_ % alignof(MFStoreSlabHeader))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreSlabHeader)) + "-byte "
+				"boundary.");
+		section_offset_ = section.section_offset_;
+		section_ptr_    = mfstore_ctl.GetPtr<char>(section_offset_);
+		header_ptr_     = reinterpret_cast<MFStoreSlabHeader *>(section_ptr_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			header_ptr_->magic_       = 0;
+			header_ptr_->slot_size_   = section.element_size_;
+			header_ptr_->slot_count_  = section.element_count_;
+			header_ptr_->first_slot_  = CalcHeaderSlots(section.element_size_);
+			header_ptr_->free_head_.store(0, std::memory_order_relaxed);
+			header_ptr_->next_unused_.store(header_ptr_->first_slot_,
+				std::memory_order_relaxed);
+			header_ptr_->alloc_count_.store(0, std::memory_order_relaxed);
+			header_ptr_->reserved_    = 0;
+			std::atomic_thread_fence(std::memory_order_release);
+			header_ptr_->magic_       = MFStoreSlabHeader::HeaderMagic;
+		}
+		else if (header_ptr_->magic_ != MFStoreSlabHeader::HeaderMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"a slab.");
+		else if ((header_ptr_->slot_size_ != section.element_size_) ||
+			(header_ptr_->slot_count_ != section.element_count_) ||
+			(header_ptr_->first_slot_ !=
+			CalcHeaderSlots(section.element_size_)))
+			throw std::invalid_argument("The slab header (slot size " +
+				std::to_string(header_ptr_->slot_size_) + ", slot count " +
+				std::to_string(header_ptr_->slot_count_) + ") doesn't match "
+				"the section.");
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as a slab: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSlabHandle MFStoreSlab::TryAllocate()
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	uint64_t free_head = header_ptr_->free_head_.load(std::memory_order_acquire);
+
+	while (free_head & SlabIndexMask) {
+		uint64_t slot_index = free_head & SlabIndexMask;
+		/*
+			The slot may have been allocated (and overwritten) by another thread
+			since the head was read, in which case the link is garbage but the
+			tag will have changed and so the exchange fails.
+		*/
+		uint64_t next_index = GetLink(slot_index).load(std::memory_order_relaxed);
+		uint64_t new_head   = ((free_head & ~SlabIndexMask) + SlabTagUnit) |
+			(next_index & SlabIndexMask);
+		if (header_ptr_->free_head_.compare_exchange_weak(free_head, new_head,
+			std::memory_order_acquire, std::memory_order_acquire)) {
+			header_ptr_->alloc_count_.fetch_add(1, std::memory_order_relaxed);
+			return(slot_index);
+		}
+	}
+
+	uint64_t next_unused =
+		header_ptr_->next_unused_.load(std::memory_order_relaxed);
+
+	while (next_unused < header_ptr_->slot_count_) {
+		if (header_ptr_->next_unused_.compare_exchange_weak(next_unused,
+			next_unused + 1, std::memory_order_relaxed)) {
+			header_ptr_->alloc_count_.fetch_add(1, std::memory_order_relaxed);
+			return(next_unused);
+		}
+	}
+
+	return(MFStoreSlabNullHandle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSlabHandle MFStoreSlab::Allocate()
+{
+	MFStoreSlabHandle slot_handle = TryAllocate();
+
+	if (slot_handle == MFStoreSlabNullHandle)
+		throw std::runtime_error("Unable to allocate a slot from the slab in "
+			"MFStore file '" + mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + ": all " +
+			std::to_string(GetCapacity()) + " slots are in use.");
+
+	return(slot_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreSlab::Free(MFStoreSlabHandle slot_handle)
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	CheckHandle(slot_handle);
+
+	std::atomic<uint64_t> &slot_link = GetLink(slot_handle);
+	uint64_t               free_head =
+		header_ptr_->free_head_.load(std::memory_order_relaxed);
+	uint64_t               new_head;
+
+	do {
+		slot_link.store(free_head & SlabIndexMask, std::memory_order_relaxed);
+		new_head = ((free_head & ~SlabIndexMask) + SlabTagUnit) | slot_handle;
+	} while (!header_ptr_->free_head_.compare_exchange_weak(free_head, new_head,
+		std::memory_order_release, std::memory_order_relaxed));
+
+	header_ptr_->alloc_count_.fetch_sub(1, std::memory_order_relaxed);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreSlab::GetSlotSize() const
+{
+	return(header_ptr_->slot_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreSlab::GetCapacity() const
+{
+	return(header_ptr_->slot_count_ - header_ptr_->first_slot_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreSlab::GetAllocatedCount() const
+{
+	return(header_ptr_->alloc_count_.load(std::memory_order_relaxed));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreOff MFStoreSlab::GetOffset(MFStoreSlabHandle slot_handle) const
+{
+	CheckHandle(slot_handle);
+
+	return(section_offset_ + (slot_handle * header_ptr_->slot_size_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSlabHandle MFStoreSlab::GetHandle(const void *slot_ptr) const
+{
+	const char *tmp_ptr = static_cast<const char *>(slot_ptr);
+
+	if ((tmp_ptr < section_ptr_) || (tmp_ptr >= (section_ptr_ +
+		(header_ptr_->slot_count_ * header_ptr_->slot_size_))) ||
+		((tmp_ptr - section_ptr_) % header_ptr_->slot_size_))
+		throw std::invalid_argument("The pointer does not address a slot of "
+			"the slab in MFStore file '" + mfstore_ctl_ptr_->GetFileName() +
+			"' at offset " + std::to_string(section_offset_) + ".");
+
+	MFStoreSlabHandle slot_handle = static_cast<MFStoreSlabHandle>(
+		(tmp_ptr - section_ptr_) / header_ptr_->slot_size_);
+
+	CheckHandle(slot_handle);
+
+	return(slot_handle);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreSlab::MakeSlabSection(uint64_t slot_size,
+	uint64_t slot_count, const std::string &description)
+{
+	uint64_t header_slots = CalcHeaderSlots(slot_size);
+
+	if (slot_count > (SlabIndexMask - header_slots))
+		throw std::invalid_argument("The slab slot count (" +
+			std::to_string(slot_count) + ") plus the " +
+			std::to_string(header_slots) + " slots of the slab header exceeds "
+			"the maximum of " + std::to_string(SlabIndexMask) + ".");
+
+	return(MFStoreSection(0, slot_size, slot_count + header_slots, 0, 0, 0, 0,
+		0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreSlab::CheckHandle(MFStoreSlabHandle slot_handle) const
+{
+	if ((slot_handle < header_ptr_->first_slot_) ||
+		(slot_handle >=
+		header_ptr_->next_unused_.load(std::memory_order_relaxed)))
+		throw std::invalid_argument("The slab slot handle (" +
+			std::to_string(slot_handle) + ") is not that of a slot allocated "
+			"from the slab in MFStore file '" + mfstore_ctl_ptr_->GetFileName() +
+			"' at offset " + std::to_string(section_offset_) + ".");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void *MFStoreSlab::GetSlotPtr(MFStoreSlabHandle slot_handle,
+	std::size_t datum_size) const
+{
+	CheckHandle(slot_handle);
+
+	if (datum_size > header_ptr_->slot_size_)
+		throw std::invalid_argument("The size of the requested type (" +
+			std::to_string(datum_size) + ") exceeds the slab slot size (" +
+			std::to_string(header_ptr_->slot_size_) + ").");
+
+	return(section_ptr_ + (slot_handle * header_ptr_->slot_size_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::atomic<uint64_t> &MFStoreSlab::GetLink(uint64_t slot_index) const
+{
+	return(*reinterpret_cast<std::atomic<uint64_t> *>(section_ptr_ +
+		(slot_index * header_ptr_->slot_size_)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreSlab::CalcHeaderSlots(uint64_t slot_size)
+{
+	return((sizeof(MFStoreSlabHeader) + (slot_size - 1)) / slot_size);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+#include <MFStore/MFStoreArena.hpp>
+
+#include <filesystem>
+#include <thread>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreSlab.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_SlabIndex    = 1;
+const std::size_t TEST_ArenaIndex   = 2;
+const uint64_t    TEST_SlotCount    = 100000;
+const uint64_t    TEST_ArenaLength  = 16ULL * 1024ULL * 1024ULL;
+const unsigned    TEST_ThreadCount  = 4;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// A persistent singly-linked list node referring to its name by offset.
+struct TEST_Node
+{
+	MFStoreSlabHandle  next_handle_;
+	MFStoreArenaHandle name_handle_;
+	uint64_t           node_value_;
+	uint64_t           owner_thread_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreSlab::MakeSlabSection(
+		sizeof(TEST_Node), TEST_SlotCount, "Nodes"), section_list);
+	MFStoreSection::AppendSection(MFStoreArena::MakeArenaSection(
+		TEST_ArenaLength, "Names"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Churn(MFStoreSlab &slab, unsigned thread_index)
+{
+	std::vector<MFStoreSlabHandle> handle_list;
+
+	for (unsigned round_index = 0; round_index < 50; ++round_index) {
+		for (unsigned count_1 = 0; count_1 < 400; ++count_1) {
+			MFStoreSlabHandle slot_handle = slab.Allocate();
+			TEST_Node *node_ptr = slab.GetPtr<TEST_Node>(slot_handle);
+			node_ptr->node_value_   = slot_handle;
+			node_ptr->owner_thread_ = thread_index;
+			handle_list.push_back(slot_handle);
+		}
+		for (const auto &this_handle : handle_list) {
+			const TEST_Node *node_ptr = slab.GetPtr<TEST_Node>(this_handle);
+			if ((node_ptr->node_value_ != this_handle) ||
+				(node_ptr->owner_thread_ != thread_index))
+				throw std::logic_error("Slab slot " +
+					std::to_string(this_handle) + " was allocated to more than "
+					"one thread.");
+			slab.Free(this_handle);
+		}
+		handle_list.clear();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_SlotCountLimit()
+{
+	try {
+		MFStoreSlab::MakeSlabSection(sizeof(TEST_Node), 0x100000000ULL);
+	}
+	catch (const std::invalid_argument &) {
+		std::cout << "Slot count limit: OK" << std::endl;
+		return;
+	}
+
+	throw std::logic_error("A slab section with more slots than the free "
+		"list can index was not rejected.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_SlabAndArena()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+	MFStoreSlabHandle  list_head    = MFStoreSlabNullHandle;
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreSlab    slab(mfstore_ctl, TEST_SlabIndex, true);
+		MFStoreArena   arena(mfstore_ctl, TEST_ArenaIndex, true);
+		std::vector<std::thread>        thread_list;
+		std::vector<std::exception_ptr> except_list(TEST_ThreadCount);
+		for (unsigned thread_index = 0; thread_index < TEST_ThreadCount;
+			++thread_index)
+			thread_list.emplace_back([&, thread_index]() {
+				try {
+					TEST_Churn(slab, thread_index);
+				}
+				catch (...) {
+					except_list[thread_index] = std::current_exception();
+				}
+			});
+		for (auto &this_thread : thread_list)
+			this_thread.join();
+		for (const auto &this_except : except_list) {
+			if (this_except)
+				std::rethrow_exception(this_except);
+		}
+		if (slab.GetAllocatedCount())
+			throw std::logic_error("Slots remain allocated after the churn.");
+		std::cout << "Slab concurrent churn: OK" << std::endl;
+		for (uint64_t node_index = 0; node_index < 1000; ++node_index) {
+			MFStoreSlabHandle  slot_handle = slab.Allocate();
+			TEST_Node         *node_ptr    = slab.GetPtr<TEST_Node>(slot_handle);
+			node_ptr->next_handle_ = list_head;
+			node_ptr->name_handle_ = arena.AddString("Node number " +
+				std::to_string(node_index));
+			node_ptr->node_value_  = node_index;
+			list_head              = slot_handle;
+		}
+		mfstore_ctl.GetPtr<MFStoreSlabHandle>(0)[0] = list_head;
+	}
+
+	{
+		MFStoreControl      mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		const MFStoreSlab   slab(mfstore_ctl, TEST_SlabIndex);
+		const MFStoreArena  arena(mfstore_ctl, TEST_ArenaIndex);
+		MFStoreSlabHandle   slot_handle =
+			mfstore_ctl.GetPtr<MFStoreSlabHandle>(0)[0];
+		uint64_t            node_count  = 0;
+		while (slot_handle != MFStoreSlabNullHandle) {
+			const TEST_Node *node_ptr = slab.GetPtr<TEST_Node>(slot_handle);
+			if (arena.GetString(node_ptr->name_handle_) != ("Node number " +
+				std::to_string(node_ptr->node_value_)))
+				throw std::logic_error("The name of node " +
+					std::to_string(node_ptr->node_value_) + " is incorrect.");
+			slot_handle = node_ptr->next_handle_;
+			++node_count;
+		}
+		if ((node_count != 1000) || (slab.GetAllocatedCount() != 1000))
+			throw std::logic_error("The persistent node list has " +
+				std::to_string(node_count) + " nodes, but 1000 were expected.");
+		std::cout << "Persistent node list of " << node_count << " nodes, "
+			"arena " << arena.GetUsedLength() << " of " <<
+			arena.GetCapacity() << " bytes used: OK" << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_SlotCountLimit();
+		TEST_SlabAndArena();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
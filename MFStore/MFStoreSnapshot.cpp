@@ -0,0 +1,543 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSnapshot.cpp
+
+   File Description  :  Implementation of point-in-time snapshots of MFStore
+                        files.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreSnapshot.hpp>
+#include <MFStore/CreateMFStore.hpp>
+
+#include <Utility/ThrowErrno.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#ifdef __linux__
+# include <fcntl.h>
+# include <linux/fs.h>
+# include <sys/ioctl.h>
+# include <unistd.h>
+#endif // #ifdef __linux__
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::chrono::milliseconds SnapshotUpdateWait(10);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns false (having removed the destination file) if the file system
+	doesn't support reflinks between the two files.
+*/
+bool ReflinkFile(const MFStoreControl &src_ctl,
+	const std::string &dst_file_name)
+{
+#ifdef __linux__
+	int dst_handle = ::open(dst_file_name.c_str(), O_CREAT | O_EXCL | O_WRONLY,
+		S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+	if (dst_handle < 0)
+		MLB::Utility::ThrowErrno("Call to ::open() for the snapshot file "
+			"failed");
+
+	if (::ioctl(dst_handle, FICLONE, src_ctl.GetFileHandle()) == 0) {
+		int sync_return = ::fsync(dst_handle);
+		int error_code  = errno;
+		::close(dst_handle);
+		if (sync_return)
+			MLB::Utility::ThrowErrno(error_code, "Call to ::fsync() for the "
+				"snapshot file failed");
+		return(true);
+	}
+
+	int error_code = errno;
+
+	::close(dst_handle);
+	::unlink(dst_file_name.c_str());
+
+	if ((error_code == EOPNOTSUPP) || (error_code == ENOTTY) ||
+		(error_code == EXDEV) || (error_code == EINVAL) ||
+		(error_code == ENOSYS))
+		return(false);
+
+	MLB::Utility::ThrowErrno(error_code, "Call to ::ioctl(FICLONE) failed");
+#else
+	static_cast<void>(src_ctl);
+	static_cast<void>(dst_file_name);
+#endif // #ifdef __linux__
+
+	return(false);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Stores the generation of each section with a slot in the MFStoreNotify.
+	Returns false if bracketed_flag is true and a section is in the midst of
+	an update, having first waited briefly for that update to finish.
+*/
+bool GetGenerationList(const MFStoreNotify &notify, std::size_t section_count,
+	bool bracketed_flag, std::vector<uint32_t> &generation_list)
+{
+	generation_list.resize(std::min(notify.GetSlotCount(), section_count));
+
+	for (std::size_t section_index = 0;
+		section_index < generation_list.size(); ++section_index) {
+		uint32_t generation = notify.GetGeneration(section_index);
+		if (bracketed_flag && (generation & 1)) {
+			notify.WaitForChange(section_index, generation, SnapshotUpdateWait);
+			return(false);
+		}
+		generation_list[section_index] = generation;
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Reflinks the file. If notify_ptr is not null, the clone is discarded and
+	attempted again if any section with a slot in that MFStoreNotify changed
+	while it was being made.
+
+	Returns false (having removed the destination file) if the file system
+	doesn't support reflinks between the two files, or if sections were
+	still changing after max_attempts clones, in which case inconsistent_flag
+	is set.
+*/
+bool ReflinkSnapshot(const MFStoreControl &src_ctl,
+	const std::string &dst_file_name, const MFStoreNotify *notify_ptr,
+	bool bracketed_flag, unsigned int max_attempts,
+	MFStoreSnapshotStats &stats, bool &inconsistent_flag)
+{
+	inconsistent_flag = false;
+
+	if (!notify_ptr)
+		return(ReflinkFile(src_ctl, dst_file_name));
+
+	std::size_t           section_count = src_ctl.GetSectionList().size();
+	std::vector<uint32_t> begin_list;
+	std::vector<uint32_t> end_list;
+
+	for (unsigned int attempt_count = 0; attempt_count < max_attempts;
+		++attempt_count) {
+		if (attempt_count)
+			++stats.retry_count_;
+		if (!GetGenerationList(*notify_ptr, section_count, bracketed_flag,
+			begin_list))
+			continue;
+		if (!ReflinkFile(src_ctl, dst_file_name))
+			return(false);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		GetGenerationList(*notify_ptr, section_count, false, end_list);
+		if (begin_list == end_list)
+			return(true);
+		std::filesystem::remove(dst_file_name);
+	}
+
+	inconsistent_flag = true;
+
+	return(false);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns true if the copy of the section is known to be consistent.
+*/
+bool CopySection(const MFStoreControl &src_ctl, MFStoreControl &dst_ctl,
+	std::size_t section_index, MFStoreOff begin_offset, MFStoreLen length,
+	const MFStoreNotify *notify_ptr, bool bracketed_flag,
+	unsigned int max_attempts, MFStoreSnapshotStats &stats)
+{
+	const char *src_ptr = src_ctl.GetPtr<char>(begin_offset);
+	char       *dst_ptr = dst_ctl.GetPtr<char>(begin_offset);
+
+	if ((!notify_ptr) || (section_index >= notify_ptr->GetSlotCount())) {
+		::memcpy(dst_ptr, src_ptr, static_cast<std::size_t>(length));
+		stats.byte_count_ += length;
+		return(true);
+	}
+
+	for (unsigned int attempt_count = 0; attempt_count < max_attempts;
+		++attempt_count) {
+		if (attempt_count)
+			++stats.retry_count_;
+		uint32_t begin_generation = notify_ptr->GetGeneration(section_index);
+		if (bracketed_flag && (begin_generation & 1)) {
+			notify_ptr->WaitForChange(section_index, begin_generation,
+				SnapshotUpdateWait);
+			continue;
+		}
+		::memcpy(dst_ptr, src_ptr, static_cast<std::size_t>(length));
+		stats.byte_count_ += length;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (notify_ptr->GetGeneration(section_index) == begin_generation)
+			return(true);
+	}
+
+	return(false);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void CopyFile(const MFStoreControl &src_ctl, const std::string &dst_file_name,
+	const MFStoreNotify *notify_ptr, bool bracketed_flag,
+	unsigned int max_attempts, MFStoreSnapshotStats &stats)
+{
+	MFStoreControl            dst_ctl(CreateMFStore(dst_file_name,
+		src_ctl.GetFileSize(), src_ctl.GetMmapSize(), src_ctl.GetAllocGran()));
+	const MFStoreSectionList &section_list = src_ctl.GetSectionList();
+	MFStoreOff                copy_limit   =
+		std::min(src_ctl.GetFileSize(), src_ctl.GetMmapSize());
+
+	for (std::size_t section_index = 0; section_index < section_list.size();
+		++section_index) {
+		const MFStoreSection &section = section_list[section_index];
+		MFStoreOff begin_offset = section.section_offset_;
+		MFStoreOff end_offset   = std::min(section.CalcNextOffset(), copy_limit);
+		if (begin_offset >= end_offset)
+			continue;
+		++stats.section_count_;
+		if (!CopySection(src_ctl, dst_ctl, section_index, begin_offset,
+			end_offset - begin_offset, notify_ptr, bracketed_flag,
+			std::max(max_attempts, 1U), stats))
+			++stats.inconsistent_count_;
+	}
+
+	dst_ctl.Flush();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSnapshotStats::MFStoreSnapshotStats()
+	:reflink_flag_(false)
+	,section_count_(0)
+	,retry_count_(0)
+	,inconsistent_count_(0)
+	,byte_count_(0)
+	,elapsed_usecs_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreSnapshotStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Method=" << ((reflink_flag_) ? "Reflink" : "Copy")
+		<< ", Sections=" << section_count_
+		<< ", Retries=" << retry_count_
+		<< ", Inconsistent=" << inconsistent_count_
+		<< ", Bytes=" << byte_count_
+		<< ", Microseconds=" << elapsed_usecs_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSnapshotStats SnapshotMFStore(const MFStoreControl &src_ctl,
+	const std::string &dst_file_name, MFStoreSnapshotMode snapshot_mode,
+	const MFStoreNotify *notify_ptr, bool bracketed_flag,
+	unsigned int max_attempts)
+{
+	MFStoreSnapshotStats stats;
+	auto                 start_time = std::chrono::steady_clock::now();
+	bool                 created_flag = false;
+
+	try {
+		src_ctl.CheckIsActive();
+		if (std::filesystem::exists(dst_file_name))
+			throw std::invalid_argument("The snapshot file already exists.");
+		if (snapshot_mode != MFStoreSnapshotMode::Copy) {
+			bool inconsistent_flag = false;
+			stats.reflink_flag_ = ReflinkSnapshot(src_ctl, dst_file_name,
+				notify_ptr, bracketed_flag, std::max(max_attempts, 1U), stats,
+				inconsistent_flag);
+			if ((!stats.reflink_flag_) &&
+				(snapshot_mode == MFStoreSnapshotMode::Reflink))
+				throw std::runtime_error((inconsistent_flag) ?
+					"Sections of the MFStore changed during each of the reflink "
+					"attempts." :
+					"The file system does not support reflinks between the "
+					"files.");
+		}
+		created_flag = true;
+		if (!stats.reflink_flag_)
+			CopyFile(src_ctl, dst_file_name, notify_ptr, bracketed_flag,
+				max_attempts, stats);
+		std::filesystem::permissions(dst_file_name,
+			std::filesystem::perms::owner_read |
+			std::filesystem::perms::group_read |
+			std::filesystem::perms::others_read);
+	}
+	catch (const std::exception &except) {
+		if (created_flag) {
+			std::error_code error_code;
+			std::filesystem::remove(dst_file_name, error_code);
+		}
+		throw std::runtime_error("Unable to snapshot MFStore file '" +
+			src_ctl.GetFileName() + "' to file '" + dst_file_name + "': " +
+			std::string(except.what()));
+	}
+
+	stats.elapsed_usecs_ = static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count());
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreControl AttachMFStoreSnapshot(const MFStoreControl &src_ctl,
+	const std::string &snapshot_file_name)
+{
+	return(MFStoreControl(snapshot_file_name, false, src_ctl.GetFileSize(),
+		src_ctl.GetMmapSize(), src_ctl.GetAllocGran(),
+		src_ctl.GetSectionList()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreSnapshotStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <atomic>
+#include <thread>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreSnapshot.bin");
+const std::string TEST_CopyFileName("./TEST_MAIN.MFStoreSnapshot.Copy.bin");
+const std::string TEST_AutoFileName("./TEST_MAIN.MFStoreSnapshot.Auto.bin");
+const std::string TEST_LiveAutoFileName(
+	"./TEST_MAIN.MFStoreSnapshot.LiveAuto.bin");
+const std::string TEST_ReflinkFileName(
+	"./TEST_MAIN.MFStoreSnapshot.Reflink.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_NotifyIndex  = 1;
+const std::size_t TEST_LiveIndex    = 2;
+const std::size_t TEST_StaticIndex  = 3;
+const uint64_t    TEST_ValueCount   = 128 * 1024;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreNotify::MakeNotifySection(4),
+		section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint64_t),
+		TEST_ValueCount, 0, 0, 0, 0, 0, "Live"), section_list);
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(uint64_t),
+		TEST_ValueCount, 0, 0, 0, 0, 0, "Static"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CheckSnapshot(const MFStoreControl &src_ctl,
+	const std::string &snapshot_file_name)
+{
+	if ((std::filesystem::status(snapshot_file_name).permissions() &
+		std::filesystem::perms::owner_write) != std::filesystem::perms::none)
+		throw std::logic_error("The snapshot file '" + snapshot_file_name +
+			"' is not read-only.");
+
+	MFStoreControl  snap_ctl   =
+		AttachMFStoreSnapshot(src_ctl, snapshot_file_name);
+	const uint64_t *live_ptr   = snap_ctl.GetPtr<uint64_t>(
+		snap_ctl.GetSectionMapped(TEST_LiveIndex).section_offset_);
+	const uint64_t *static_ptr = snap_ctl.GetPtr<uint64_t>(
+		snap_ctl.GetSectionMapped(TEST_StaticIndex).section_offset_);
+
+	for (uint64_t value_index = 0; value_index < TEST_ValueCount;
+		++value_index) {
+		if (live_ptr[value_index] != live_ptr[0])
+			throw std::logic_error("The snapshot '" + snapshot_file_name +
+				"' holds a partially-updated copy of the live section: value " +
+				std::to_string(value_index) + " is " +
+				std::to_string(live_ptr[value_index]) + ", but value 0 is " +
+				std::to_string(live_ptr[0]) + ".");
+		if (static_ptr[value_index] != (value_index * 3))
+			throw std::logic_error("The snapshot '" + snapshot_file_name +
+				"' holds an incorrect copy of the static section.");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Snapshot()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	for (const auto &this_name : {TEST_FileName, TEST_CopyFileName,
+		TEST_AutoFileName, TEST_LiveAutoFileName, TEST_ReflinkFileName})
+		std::filesystem::remove(this_name);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	MFStoreControl    mfstore_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreNotify     notify(mfstore_ctl, TEST_NotifyIndex);
+	uint64_t         *live_ptr    = mfstore_ctl.GetPtr<uint64_t>(
+		mfstore_ctl.GetSectionMapped(TEST_LiveIndex).section_offset_);
+	uint64_t         *static_ptr  = mfstore_ctl.GetPtr<uint64_t>(
+		mfstore_ctl.GetSectionMapped(TEST_StaticIndex).section_offset_);
+	std::atomic<bool> stop_flag(false);
+
+	for (uint64_t value_index = 0; value_index < TEST_ValueCount;
+		++value_index)
+		static_ptr[value_index] = value_index * 3;
+
+	std::thread writer_thread([&]() {
+		for (uint64_t update_count = 1; !stop_flag.load(); ++update_count) {
+			notify.Advance(TEST_LiveIndex, false);
+			for (uint64_t value_index = 0; value_index < TEST_ValueCount;
+				++value_index)
+				reinterpret_cast<volatile uint64_t *>(live_ptr)[value_index] =
+					update_count;
+			notify.Advance(TEST_LiveIndex);
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+		}
+	});
+
+	try {
+		MFStoreSnapshotStats copy_stats = SnapshotMFStore(mfstore_ctl,
+			TEST_CopyFileName, MFStoreSnapshotMode::Copy, &notify, true, 100);
+		std::cout << "Copy snapshot during updates: " << copy_stats <<
+			std::endl;
+		if (copy_stats.inconsistent_count_)
+			throw std::logic_error("The copy snapshot was inconsistent.");
+		TEST_CheckSnapshot(mfstore_ctl, TEST_CopyFileName);
+		MFStoreSnapshotStats live_stats = SnapshotMFStore(mfstore_ctl,
+			TEST_LiveAutoFileName, MFStoreSnapshotMode::Auto, &notify, true,
+			100);
+		std::cout << "Automatic snapshot during updates: " << live_stats <<
+			std::endl;
+		if (live_stats.inconsistent_count_)
+			throw std::logic_error("The automatic snapshot was inconsistent.");
+		TEST_CheckSnapshot(mfstore_ctl, TEST_LiveAutoFileName);
+		stop_flag = true;
+		writer_thread.join();
+		bool reflink_flag = true;
+		try {
+			MFStoreSnapshotStats reflink_stats = SnapshotMFStore(mfstore_ctl,
+				TEST_ReflinkFileName, MFStoreSnapshotMode::Reflink);
+			std::cout << "Reflink snapshot: " << reflink_stats << std::endl;
+		}
+		catch (const std::exception &except) {
+			reflink_flag = false;
+			if (std::filesystem::exists(TEST_ReflinkFileName))
+				throw std::logic_error("A failed reflink snapshot left its "
+					"file behind.");
+			std::cout << "Reflink snapshot is not available here: " <<
+				except.what() << std::endl;
+		}
+		MFStoreSnapshotStats auto_stats = SnapshotMFStore(mfstore_ctl,
+			TEST_AutoFileName);
+		std::cout << "Automatic snapshot: " << auto_stats << std::endl;
+		if (auto_stats.reflink_flag_ != reflink_flag)
+			throw std::logic_error("The automatic snapshot didn't use the "
+				"method expected.");
+		TEST_CheckSnapshot(mfstore_ctl, TEST_AutoFileName);
+		if (reflink_flag)
+			TEST_CheckSnapshot(mfstore_ctl, TEST_ReflinkFileName);
+	}
+	catch (...) {
+		stop_flag = true;
+		if (writer_thread.joinable())
+			writer_thread.join();
+		throw;
+	}
+
+	MFStoreNotify::RemoveWaiterSegment(TEST_FileName, TEST_NotifyIndex);
+
+	for (const auto &this_name : {TEST_FileName, TEST_CopyFileName,
+		TEST_AutoFileName, TEST_LiveAutoFileName, TEST_ReflinkFileName})
+		std::filesystem::remove(this_name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Snapshot();
+		std::cout << "Snapshots: OK" << std::endl;
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
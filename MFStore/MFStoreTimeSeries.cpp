@@ -0,0 +1,703 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreTimeSeries.cpp
+
+   File Description  :  Implementation of the MFStoreTimeSeries class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreTimeSeries.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const uint64_t TimeSeriesElementSize  = sizeof(MFStoreTimeSeriesHeader);
+const uint64_t TimeSeriesTimeLength   = sizeof(uint64_t);
+const uint64_t TimeSeriesMaxInterval  = 1ULL << 20;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TimeSeriesLayout
+{
+	TimeSeriesLayout(uint64_t record_size, uint64_t record_capacity,
+		uint64_t index_interval)
+		:slot_size_((TimeSeriesTimeLength + record_size + 7) & ~7ULL)
+		,index_count_((record_capacity + (index_interval - 1)) / index_interval)
+		,records_offset_(((sizeof(MFStoreTimeSeriesHeader) +
+			(index_count_ * sizeof(uint64_t))) + (TimeSeriesElementSize - 1)) &
+			~(TimeSeriesElementSize - 1))
+		,total_length_(records_offset_ + (record_capacity * slot_size_))
+	{
+	}
+
+	uint64_t slot_size_;
+	uint64_t index_count_;
+	uint64_t records_offset_;
+	uint64_t total_length_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckLayoutArgs(uint64_t record_size, uint64_t index_interval)
+{
+	if (!record_size)
+		throw std::invalid_argument("The time series record size is zero.");
+
+	if ((!index_interval) || (index_interval > TimeSeriesMaxInterval))
+		throw std::invalid_argument("The time series index interval (" +
+			std::to_string(index_interval) + ") is outside of the permissible "
+			"range of 1 to " + std::to_string(TimeSeriesMaxInterval) +
+			", inclusive.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the largest number of records which, with their index, fit
+	within a section of the specified length.
+*/
+uint64_t CalcRecordCapacity(MFStoreLen section_length, uint64_t record_size,
+	uint64_t index_interval)
+{
+	uint64_t overhead_length = sizeof(MFStoreTimeSeriesHeader) +
+		TimeSeriesElementSize;
+
+	if (section_length <= overhead_length)
+		return(0);
+
+	uint64_t slot_size       = TimeSeriesLayout(record_size, 1, 1).slot_size_;
+	uint64_t record_capacity = ((section_length - overhead_length) /
+		((index_interval * slot_size) + sizeof(uint64_t))) * index_interval;
+
+	while (TimeSeriesLayout(record_size, record_capacity + 1,
+		index_interval).total_length_ <= section_length)
+		++record_capacity;
+
+	return(record_capacity);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreTimeSeries::Cursor::Cursor()
+	:series_ptr_(nullptr)
+	,record_index_(0)
+	,available_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreTimeSeries::Cursor::Cursor(const MFStoreTimeSeries *series_ptr,
+	uint64_t record_index)
+	:series_ptr_(series_ptr)
+	,record_index_(record_index)
+	,available_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The count of records appended by the writer is re-read only when the
+	cursor has consumed those it last saw.
+*/
+const char *MFStoreTimeSeries::Cursor::Next(uint64_t &record_time)
+{
+	if (record_index_ >= available_count_) {
+		if (!series_ptr_)
+			return(nullptr);
+		available_count_ = series_ptr_->GetCount();
+		if (record_index_ >= available_count_)
+			return(nullptr);
+	}
+
+	const char *slot_ptr = series_ptr_->GetSlotPtr(record_index_++);
+
+	::memcpy(&record_time, slot_ptr, sizeof(record_time));
+
+	return(slot_ptr + TimeSeriesTimeLength);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::Cursor::GetRecordIndex() const
+{
+	return(record_index_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The index interval is used only when formatting the section; otherwise
+	that with which the section was formatted is used.
+*/
+MFStoreTimeSeries::MFStoreTimeSeries(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, uint64_t record_size, bool format_flag,
+	uint64_t index_interval)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,is_writer_(mfstore_ctl.IsWriter())
+	,section_offset_(0)
+	,section_ptr_(nullptr)
+	,header_ptr_(nullptr)
+	,index_ptr_(nullptr)
+	,records_ptr_(nullptr)
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.section_offset_ % alignof(MFStoreTimeSeriesHeader))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreTimeSeriesHeader)) +
+				"-byte boundary.");
+		section_offset_ = section.section_offset_;
+		section_ptr_    = mfstore_ctl.GetPtr<char>(section_offset_);
+		header_ptr_     =
+			reinterpret_cast<MFStoreTimeSeriesHeader *>(section_ptr_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			CheckLayoutArgs(record_size, index_interval);
+			uint64_t record_capacity = CalcRecordCapacity(
+				section.CalcLengthUsed(), record_size, index_interval);
+			if (!record_capacity)
+				throw std::invalid_argument("The section length (" +
+					std::to_string(section.CalcLengthUsed()) + ") leaves no "
+					"room for records of " + std::to_string(record_size) +
+					" bytes after the time series header and index.");
+			TimeSeriesLayout layout(record_size, record_capacity,
+				index_interval);
+			header_ptr_->magic_           = 0;
+			header_ptr_->record_size_     = record_size;
+			header_ptr_->slot_size_       = layout.slot_size_;
+			header_ptr_->record_capacity_ = record_capacity;
+			header_ptr_->index_interval_  = index_interval;
+			header_ptr_->records_offset_  = layout.records_offset_;
+			header_ptr_->record_count_.store(0, std::memory_order_relaxed);
+			header_ptr_->last_time_.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			header_ptr_->magic_           = MFStoreTimeSeriesHeader::HeaderMagic;
+		}
+		else if (header_ptr_->magic_ != MFStoreTimeSeriesHeader::HeaderMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"a time series.");
+		else if (header_ptr_->record_size_ != record_size)
+			throw std::invalid_argument("The time series record size (" +
+				std::to_string(header_ptr_->record_size_) + ") doesn't match "
+				"the expected record size (" + std::to_string(record_size) +
+				").");
+		else {
+			CheckLayoutArgs(header_ptr_->record_size_,
+				header_ptr_->index_interval_);
+			TimeSeriesLayout layout(header_ptr_->record_size_,
+				header_ptr_->record_capacity_, header_ptr_->index_interval_);
+			if ((layout.slot_size_ != header_ptr_->slot_size_) ||
+				(layout.records_offset_ != header_ptr_->records_offset_) ||
+				(layout.total_length_ > section.CalcLengthUsed()))
+				throw std::invalid_argument("The time series layout recorded in "
+					"its header is inconsistent with its record size (" +
+					std::to_string(header_ptr_->record_size_) + "), capacity (" +
+					std::to_string(header_ptr_->record_capacity_) + ") and "
+					"section length (" + std::to_string(section.CalcLengthUsed()) +
+					").");
+		}
+		index_ptr_   = reinterpret_cast<uint64_t *>(section_ptr_ +
+			sizeof(MFStoreTimeSeriesHeader));
+		records_ptr_ = section_ptr_ + header_ptr_->records_offset_;
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as a time series: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The record and, if it begins an index interval, its index entry are
+	written before the record count is published to readers.
+*/
+void MFStoreTimeSeries::Append(uint64_t record_time, const void *data_ptr)
+{
+	if (!is_writer_)
+		mfstore_ctl_ptr_->CheckIsWriter();
+
+	uint64_t record_count =
+		header_ptr_->record_count_.load(std::memory_order_relaxed);
+
+	if (record_count >= header_ptr_->record_capacity_)
+		throw std::runtime_error("Unable to append to the time series in "
+			"MFStore file '" + mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + ": all " +
+			std::to_string(header_ptr_->record_capacity_) + " of its records "
+			"are in use.");
+
+	uint64_t last_time = header_ptr_->last_time_.load(std::memory_order_relaxed);
+
+	if (record_count && (record_time < last_time))
+		throw std::invalid_argument("Unable to append to the time series in "
+			"MFStore file '" + mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + ": the record time (" +
+			std::to_string(record_time) + ") is less than that of the last "
+			"record (" + std::to_string(last_time) + ").");
+
+	char *slot_ptr = GetSlotPtr(record_count);
+
+	::memcpy(slot_ptr, &record_time, sizeof(record_time));
+	::memcpy(slot_ptr + TimeSeriesTimeLength, data_ptr,
+		static_cast<std::size_t>(header_ptr_->record_size_));
+
+	if (!(record_count % header_ptr_->index_interval_))
+		index_ptr_[record_count / header_ptr_->index_interval_] = record_time;
+
+	header_ptr_->last_time_.store(record_time, std::memory_order_relaxed);
+	header_ptr_->record_count_.store(record_count + 1,
+		std::memory_order_release);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the record count if no record is at or after the specified time.
+*/
+uint64_t MFStoreTimeSeries::FindTime(uint64_t record_time) const
+{
+	uint64_t record_count   = GetCount();
+	uint64_t index_interval = header_ptr_->index_interval_;
+	uint64_t low_index      = 0;
+	uint64_t high_index     = (record_count + (index_interval - 1)) /
+		index_interval;
+
+	// Find the first index entry at or after the time...
+	while (low_index < high_index) {
+		uint64_t middle_index = low_index + ((high_index - low_index) / 2);
+		if (index_ptr_[middle_index] < record_time)
+			low_index = middle_index + 1;
+		else
+			high_index = middle_index;
+	}
+
+	if (!low_index)
+		return(0);
+
+	// ... the record sought is either it or within the interval before it.
+	return(SearchRecords(((low_index - 1) * index_interval) + 1,
+		std::min(low_index * index_interval, record_count), record_time));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreTimeSeries::Cursor MFStoreTimeSeries::Seek(uint64_t record_time) const
+{
+	return(Cursor(this, FindTime(record_time)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreTimeSeries::Cursor MFStoreTimeSeries::GetCursor(
+	uint64_t record_index) const
+{
+	return(Cursor(this, record_index));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetRecordTime(uint64_t record_index) const
+{
+	uint64_t record_time;
+
+	::memcpy(&record_time, GetRecordPtr(record_index) - TimeSeriesTimeLength,
+		sizeof(record_time));
+
+	return(record_time);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *MFStoreTimeSeries::GetRecordPtr(uint64_t record_index) const
+{
+	uint64_t record_count = GetCount();
+
+	if (record_index >= record_count)
+		throw std::invalid_argument("The time series record index (" +
+			std::to_string(record_index) + ") is not less than the number of "
+			"records in the time series in MFStore file '" +
+			mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + " (" +
+			std::to_string(record_count) + ").");
+
+	return(GetSlotPtr(record_index) + TimeSeriesTimeLength);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetCount() const
+{
+	return(header_ptr_->record_count_.load(std::memory_order_acquire));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetCapacity() const
+{
+	return(header_ptr_->record_capacity_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetRecordSize() const
+{
+	return(header_ptr_->record_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetIndexInterval() const
+{
+	return(header_ptr_->index_interval_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetFirstTime() const
+{
+	return((GetCount()) ? GetRecordTime(0) : 0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreTimeSeries::GetLastTime() const
+{
+	uint64_t record_count = GetCount();
+
+	return((record_count) ? GetRecordTime(record_count - 1) : 0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreTimeSeries::MakeTimeSeriesSection(uint64_t record_size,
+	uint64_t record_capacity, uint64_t index_interval,
+	const std::string &description)
+{
+	CheckLayoutArgs(record_size, index_interval);
+
+	TimeSeriesLayout layout(record_size, record_capacity, index_interval);
+
+	return(MFStoreSection(0, TimeSeriesElementSize,
+		(layout.total_length_ + (TimeSeriesElementSize - 1)) /
+		TimeSeriesElementSize, 0, 0, 0, 0, 0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the index of the first record in [begin_index, end_index) at or
+	after the specified time, or end_index if there is none.
+*/
+uint64_t MFStoreTimeSeries::SearchRecords(uint64_t begin_index,
+	uint64_t end_index, uint64_t record_time) const
+{
+	while (begin_index < end_index) {
+		uint64_t middle_index = begin_index + ((end_index - begin_index) / 2);
+		uint64_t middle_time;
+		::memcpy(&middle_time, GetSlotPtr(middle_index), sizeof(middle_time));
+		if (middle_time < record_time)
+			begin_index = middle_index + 1;
+		else
+			end_index = middle_index;
+	}
+
+	return(begin_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreTimeSeries::CheckDatumSize(std::size_t datum_size) const
+{
+	if (datum_size != header_ptr_->record_size_)
+		throw std::invalid_argument("The size of the datum (" +
+			std::to_string(datum_size) + ") doesn't match the record size of "
+			"the time series in MFStore file '" +
+			mfstore_ctl_ptr_->GetFileName() + "' at offset " +
+			std::to_string(section_offset_) + " (" +
+			std::to_string(header_ptr_->record_size_) + ").");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <thread>
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreTimeSeries.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_SeriesIndex   = 1;
+const uint64_t    TEST_RecordCount   = 2000000;
+const uint64_t    TEST_ExtraCount    = 1000;
+const uint64_t    TEST_BaseTime      = 1000000;
+const uint64_t    TEST_SeekCount     = 100000;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Tick
+{
+	uint64_t sequence_;
+	uint64_t price_;
+	uint64_t quantity_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Pairs of ticks share a time.
+uint64_t TEST_GetTime(uint64_t sequence)
+{
+	return(TEST_BaseTime + ((sequence / 2) * 5));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreTimeSeries::MakeTimeSeriesSection(
+		sizeof(TEST_Tick), TEST_RecordCount + TEST_ExtraCount,
+		MFStoreTimeSeries::DefaultIndexInterval, "Ticks"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CheckFind(const MFStoreTimeSeries &series, uint64_t record_time)
+{
+	uint64_t record_count = series.GetCount();
+	uint64_t record_index = series.FindTime(record_time);
+
+	if ((record_index > record_count) ||
+		((record_index < record_count) &&
+		(series.GetRecordTime(record_index) < record_time)) ||
+		(record_index && (series.GetRecordTime(record_index - 1) >= record_time)))
+		throw std::logic_error("The search for time " +
+			std::to_string(record_time) + " in a time series of " +
+			std::to_string(record_count) + " records returned record " +
+			std::to_string(record_index) + ".");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_StreamAll(const MFStoreTimeSeries &series)
+{
+	MFStoreTimeSeries::Cursor cursor = series.GetCursor();
+	uint64_t                  sequence = 0;
+
+	while (sequence < TEST_RecordCount) {
+		uint64_t         record_time;
+		const TEST_Tick *tick_ptr = cursor.NextDatum<TEST_Tick>(record_time);
+		if (!tick_ptr) {
+			std::this_thread::yield();
+			continue;
+		}
+		if ((tick_ptr->sequence_ != sequence) ||
+			(record_time != TEST_GetTime(sequence)))
+			throw std::logic_error("The streaming reader found tick " +
+				std::to_string(tick_ptr->sequence_) + " at time " +
+				std::to_string(record_time) + " where tick " +
+				std::to_string(sequence) + " was expected.");
+		++sequence;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_SeekWhileAppending(const MFStoreTimeSeries &series)
+{
+	std::mt19937_64 rng(42);
+
+	while (series.GetCount() < TEST_RecordCount) {
+		uint64_t last_time = series.GetLastTime();
+		if (last_time < TEST_BaseTime)
+			continue;
+		TEST_CheckFind(series, TEST_BaseTime +
+			(rng() % ((last_time - TEST_BaseTime) + 10)));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_TimeSeries()
+{
+	MFStoreSectionList section_list = TEST_MakeSectionList();
+	MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreControl    mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreTimeSeries series(mfstore_ctl, TEST_SeriesIndex,
+			sizeof(TEST_Tick), true);
+		std::exception_ptr stream_except;
+		std::exception_ptr seek_except;
+		std::thread        stream_thread([&]() {
+			try {
+				TEST_StreamAll(series);
+			}
+			catch (...) {
+				stream_except = std::current_exception();
+			}
+		});
+		std::thread        seek_thread([&]() {
+			try {
+				TEST_SeekWhileAppending(series);
+			}
+			catch (...) {
+				seek_except = std::current_exception();
+			}
+		});
+		for (uint64_t sequence = 0; sequence < TEST_RecordCount; ++sequence)
+			series.AppendDatum(TEST_GetTime(sequence),
+				TEST_Tick{sequence, 100 + (sequence % 17), sequence % 1000});
+		stream_thread.join();
+		seek_thread.join();
+		if (stream_except)
+			std::rethrow_exception(stream_except);
+		if (seek_except)
+			std::rethrow_exception(seek_except);
+		std::cout << "Appended " << series.GetCount() << " of " <<
+			series.GetCapacity() << " records while streaming and seeking "
+			"concurrently: OK" << std::endl;
+	}
+
+	{
+		MFStoreControl    mfstore_ctl(TEST_FileName, true, file_size, file_size,
+			MFStoreAllocGran, section_list);
+		MFStoreTimeSeries series(mfstore_ctl, TEST_SeriesIndex,
+			sizeof(TEST_Tick));
+		bool              rejected_flag = false;
+		try {
+			series.AppendDatum(TEST_BaseTime,
+				TEST_Tick{TEST_RecordCount, 0, 0});
+		}
+		catch (const std::exception &) {
+			rejected_flag = true;
+		}
+		if (!rejected_flag)
+			throw std::logic_error("A record earlier than the last record was "
+				"appended.");
+		for (uint64_t sequence = TEST_RecordCount;
+			sequence < (TEST_RecordCount + TEST_ExtraCount); ++sequence)
+			series.AppendDatum(TEST_GetTime(sequence),
+				TEST_Tick{sequence, 0, 0});
+		std::cout << "Appending after re-opening the writer: OK" << std::endl;
+	}
+
+	{
+		MFStoreControl          mfstore_ctl(TEST_FileName, false, file_size,
+			file_size, MFStoreAllocGran, section_list);
+		const MFStoreTimeSeries series(mfstore_ctl, TEST_SeriesIndex,
+			sizeof(TEST_Tick));
+		uint64_t                last_time = series.GetLastTime();
+		if (series.FindTime(0) || (series.FindTime(last_time + 1) !=
+			series.GetCount()))
+			throw std::logic_error("Searches before the first time or after "
+				"the last time failed.");
+		std::mt19937_64         rng(7);
+		std::vector<uint64_t>   time_list;
+		for (uint64_t count_1 = 0; count_1 < TEST_SeekCount; ++count_1)
+			time_list.push_back(TEST_BaseTime +
+				(rng() % (last_time - TEST_BaseTime)));
+		auto     start_time = std::chrono::steady_clock::now();
+		uint64_t index_sum  = 0;
+		for (const auto &this_time : time_list)
+			index_sum += series.FindTime(this_time);
+		auto     end_time   = std::chrono::steady_clock::now();
+		for (const auto &this_time : time_list)
+			TEST_CheckFind(series, this_time);
+		MFStoreTimeSeries::Cursor cursor = series.Seek(TEST_GetTime(1234567));
+		uint64_t                  record_time;
+		const TEST_Tick          *tick_ptr =
+			cursor.NextDatum<TEST_Tick>(record_time);
+		if ((!tick_ptr) || (tick_ptr->sequence_ != 1234566))
+			throw std::logic_error("Seeking to the time of tick 1234567 did not "
+				"position the cursor on the first tick at that time.");
+		std::cout << "Seek to time: " << std::chrono::duration<double,
+			std::nano>(end_time - start_time).count() /
+			static_cast<double>(TEST_SeekCount) << " nanoseconds per search "
+			"(index sum " << index_sum << "): OK" << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_TimeSeries();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
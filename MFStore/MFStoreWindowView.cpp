@@ -0,0 +1,394 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreWindowView.cpp
+
+   File Description  :  Implementation of the MFStoreWindowView class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreWindowView.hpp>
+
+#include <MFStore/CheckValues.hpp>
+
+#include <Utility/ArgCheck.hpp>
+#include <Utility/PageSize.hpp>
+
+#include <filesystem>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWindow::MFStoreWindow(const FileMapping &file_mapping, bool is_writer,
+	uint64_t window_index, MFStoreOff window_offset, MFStoreLen window_length,
+	const MFStoreMapPolicy &map_policy)
+	:window_index_(window_index)
+	,window_offset_(window_offset)
+	,window_length_(window_length)
+	,region_(file_mapping, (is_writer) ? boost::interprocess::read_write :
+		boost::interprocess::read_only, static_cast<boost::interprocess::offset_t>(
+		window_offset), static_cast<std::size_t>(window_length))
+{
+	MFStoreMapPolicy::Apply(region_.get_address(), window_length_, map_policy,
+		is_writer);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWindowViewStats::MFStoreWindowViewStats()
+	:hit_count_(0)
+	,map_count_(0)
+	,evict_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreWindowViewStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Hits=" << hit_count_
+		<< ", Maps=" << map_count_
+		<< ", Evictions=" << evict_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen ResolveFileSize(const std::string &file_name, MFStoreLen file_size)
+{
+	MLB::Utility::ThrowIfEmpty(file_name, "The MFStore file name");
+
+	MFStoreLen actual_size = std::filesystem::file_size(file_name);
+
+	if (!file_size)
+		file_size = actual_size;
+	else if (file_size > actual_size)
+		throw std::invalid_argument("The specified file size (" +
+			std::to_string(file_size) + ") is greater than the actual size of "
+			"the file (" + std::to_string(actual_size) + ").");
+
+	return(CheckFileSize(file_size, MFStoreAllocGran));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWindowView::MFStoreWindowView(const std::string &file_name,
+	bool is_writer, MFStoreLen window_size, std::size_t max_windows,
+	MFStoreLen window_overlap, MFStoreLen file_size,
+	const MFStoreMapPolicy &map_policy)
+try
+	:file_mapping_()
+	,file_name_(file_name)
+	,is_writer_(is_writer)
+	,file_size_(ResolveFileSize(file_name, file_size))
+	,window_size_(CheckSizeHelper(window_size, MFStoreAllocGran, "window"))
+	,window_overlap_(MLB::Utility::GranularRoundUp<MFStoreLen>(window_overlap,
+		MLB::Utility::GetPageSize()))
+	,max_windows_(max_windows)
+	,map_policy_(map_policy)
+	,lru_mutex_()
+	,lru_list_()
+	,lru_map_()
+	,stats_()
+{
+	using namespace boost::interprocess;
+
+	if (!max_windows_)
+		throw std::invalid_argument("The maximum number of windows is 0.");
+
+	if (window_overlap_ > window_size_)
+		throw std::invalid_argument("The window overlap (" +
+			std::to_string(window_overlap_) + ") is greater than the window "
+			"size (" + std::to_string(window_size_) + ").");
+
+	FileMapping(file_name_.c_str(),
+		(is_writer_) ? read_write : read_only).swap(file_mapping_);
+}
+catch (const std::exception &except) {
+	throw std::runtime_error("Failed to create a window view on MFStore file '" +
+		file_name + "' with a window size of " + std::to_string(window_size) +
+		" bytes: " + std::string(except.what()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &MFStoreWindowView::GetFileName() const
+{
+	return(file_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreWindowView::IsWriter() const
+{
+	return(is_writer_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreWindowView::GetFileSize() const
+{
+	return(file_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreWindowView::GetWindowSize() const
+{
+	return(window_size_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreLen MFStoreWindowView::GetWindowOverlap() const
+{
+	return(window_overlap_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreWindowView::GetMaxWindows() const
+{
+	return(max_windows_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t MFStoreWindowView::GetWindowCount() const
+{
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	return(lru_list_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWindowSPtr MFStoreWindowView::GetWindow(MFStoreOff datum_offset,
+	MFStoreLen datum_length)
+{
+	CheckExtent(file_size_, datum_offset, datum_length);
+
+	uint64_t   window_index  = datum_offset / window_size_;
+	MFStoreOff window_offset = window_index * window_size_;
+
+	if (((datum_offset - window_offset) + datum_length) >
+		(window_size_ + window_overlap_))
+		throw std::invalid_argument("The datum of " +
+			std::to_string(datum_length) + " bytes at offset " +
+			std::to_string(datum_offset) + " is not wholly within a single "
+			"window: the window overlap of " + std::to_string(window_overlap_) +
+			" bytes is insufficient.");
+
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	auto map_iter = lru_map_.find(window_index);
+
+	if (map_iter != lru_map_.end()) {
+		lru_list_.splice(lru_list_.begin(), lru_list_, map_iter->second);
+		++stats_.hit_count_;
+		return(lru_list_.front());
+	}
+
+	MFStoreWindowSPtr window_sptr(std::make_shared<MFStoreWindow>(
+		file_mapping_, is_writer_, window_index, window_offset,
+		std::min(window_size_ + window_overlap_, file_size_ - window_offset),
+		map_policy_));
+
+	lru_list_.push_front(window_sptr);
+	lru_map_[window_index] = lru_list_.begin();
+	++stats_.map_count_;
+
+	if (lru_list_.size() > max_windows_) {
+		lru_map_.erase(lru_list_.back()->window_index_);
+		lru_list_.pop_back();
+		++stats_.evict_count_;
+	}
+
+	return(window_sptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreWindowView::ReleaseWindows()
+{
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	stats_.evict_count_ += lru_list_.size();
+
+	lru_map_.clear();
+	lru_list_.clear();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWindowViewStats MFStoreWindowView::GetStats() const
+{
+	std::lock_guard<std::mutex> lru_lock(lru_mutex_);
+
+	return(stats_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreWindowView::CheckSectionForIterator(const MFStoreSection &section,
+	std::size_t datum_size) const
+{
+	if (datum_size > section.element_size_)
+		throw std::invalid_argument("The iterator datum size (" +
+			std::to_string(datum_size) + ") is greater than the element size "
+			"of section '" + std::string(section.description_) + "' (" +
+			std::to_string(section.element_size_) + ").");
+
+	if (section.element_size_ > window_overlap_)
+		throw std::invalid_argument("The element size of section '" +
+			std::string(section.description_) + "' (" +
+			std::to_string(section.element_size_) + ") is greater than the "
+			"window overlap (" + std::to_string(window_overlap_) + ").");
+
+	CheckExtent(file_size_, section.section_offset_,
+		section.element_size_ * section.element_count_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreWindowViewStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+using namespace MLB::Utility;
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreWindowView.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Record
+{
+	uint64_t record_index_;
+	uint64_t record_check_;
+	uint32_t record_value_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MFStoreWindowView()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, sizeof(TEST_Record),
+		100000, 0, 0, 0, 0, 0, "Records"), section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	const MFStoreSection &section   = section_list[0];
+	MFStoreLen            file_size = section.CalcLengthGran(MFStoreAllocGran);
+
+	std::filesystem::remove(TEST_FileName);
+
+	CreateMFStore(TEST_FileName, file_size, file_size);
+
+	{
+		MFStoreWindowView view(TEST_FileName, true, MFStoreAllocGran, 2,
+			sizeof(TEST_Record));
+		uint64_t          record_index = 0;
+		for (auto iter_b(view.SectionBegin<TEST_Record>(section)),
+			iter_e(view.SectionEnd<TEST_Record>(section)); iter_b != iter_e;
+			++iter_b, ++record_index) {
+			iter_b->record_index_ = record_index;
+			iter_b->record_check_ = ~record_index;
+			iter_b->record_value_ = static_cast<uint32_t>(record_index * 7);
+		}
+		std::cout << "Writer: " << record_index << " records written (" <<
+			view.GetStats() << ")" << std::endl;
+	}
+
+	{
+		MFStoreWindowView view(TEST_FileName, false, MFStoreAllocGran, 3,
+			sizeof(TEST_Record));
+		uint64_t          record_index = 0;
+		for (auto iter_b(view.SectionBegin<const TEST_Record>(section)),
+			iter_e(view.SectionEnd<const TEST_Record>(section)); iter_b != iter_e;
+			++iter_b, ++record_index) {
+			if ((iter_b->record_index_ != record_index) ||
+				(iter_b->record_check_ != ~record_index) ||
+				(iter_b->record_value_ != static_cast<uint32_t>(record_index * 7)))
+				throw std::logic_error("Record mismatch at element index " +
+					std::to_string(record_index) + ".");
+		}
+		if (view.GetWindowCount() > view.GetMaxWindows())
+			throw std::logic_error("The window view retained more than the "
+				"maximum number of windows.");
+		std::cout << "Reader: " << record_index << " records verified (" <<
+			view.GetStats() << ")" << std::endl;
+	}
+
+	std::filesystem::remove(TEST_FileName);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MFStoreWindowView();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -0,0 +1,751 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreWriterLease.cpp
+
+   File Description  :  Implementation of the MFStoreWriterLease class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreWriterLease.hpp>
+
+#include <Utility/HostName.hpp>
+#include <Utility/ProcessId.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const unsigned int LeaseEpochBits   = 24;
+const uint64_t     LeaseEpochMask   = (1ULL << LeaseEpochBits) - 1;
+const uint64_t     LeaseMaxTimeout  = 1000ULL * 60ULL * 60ULL;
+// The holder's claim lapses this fraction of the lease timeout early...
+const int          LeaseMarginDiv   = 8;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t GetLeaseEpoch(uint64_t lease_word)
+{
+	return(lease_word & LeaseEpochMask);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t GetLeaseHeartbeat(uint64_t lease_word)
+{
+	return(lease_word >> LeaseEpochBits);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t MakeLeaseWord(uint64_t lease_time, uint64_t epoch)
+{
+	return((lease_time << LeaseEpochBits) | (epoch & LeaseEpochMask));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// Epoch zero is reserved for a lease which has never been held.
+inline uint64_t GetNextEpoch(uint64_t epoch)
+{
+	uint64_t next_epoch = (epoch + 1) & LeaseEpochMask;
+
+	return((next_epoch) ? next_epoch : 1);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+inline uint64_t GetSystemTimeMs()
+{
+	return(static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+const uint64_t MFStoreWriterLease::DefaultLeaseTimeoutMs;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWriterLeaseState::MFStoreWriterLeaseState()
+	:epoch_(0)
+	,heartbeat_ms_(0)
+	,owner_pid_(0)
+	,owner_host_()
+	,live_flag_(false)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &MFStoreWriterLeaseState::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Epoch=" << epoch_
+		<< ", Heartbeat=" << heartbeat_ms_
+		<< ", OwnerPid=" << owner_pid_
+		<< ", OwnerHost=" << owner_host_
+		<< ", Live=" << ((live_flag_) ? "Yes" : "No");
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The lease timeout is used only when formatting the section; otherwise
+	that with which the section was formatted is used.
+*/
+MFStoreWriterLease::MFStoreWriterLease(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, bool format_flag,
+	const LeaseTimeout &lease_timeout)
+	:mfstore_ctl_ptr_(&mfstore_ctl)
+	,record_ptr_(nullptr)
+	,held_epoch_(0)
+	,renewed_time_(0)
+	,thread_mutex_()
+	,thread_cv_()
+	,stop_flag_(false)
+	,heartbeat_thread_()
+{
+	try {
+		const MFStoreSection &section =
+			mfstore_ctl.GetSectionMapped(section_index);
+		if (section.CalcLengthUsed() < sizeof(MFStoreWriterLeaseRecord))
+			throw std::invalid_argument("The section length (" +
+				std::to_string(section.CalcLengthUsed()) + ") is less than the "
+				"size of the lease record (" +
+				std::to_string(sizeof(MFStoreWriterLeaseRecord)) + ").");
+		if (section.section_offset_ % alignof(MFStoreWriterLeaseRecord))
+			throw std::invalid_argument("The section offset (" +
+				std::to_string(section.section_offset_) + ") is not aligned on "
+				"a " + std::to_string(alignof(MFStoreWriterLeaseRecord)) +
+				"-byte boundary.");
+		record_ptr_ = mfstore_ctl.GetPtr<MFStoreWriterLeaseRecord>(
+			section.section_offset_);
+		if (format_flag) {
+			mfstore_ctl.CheckIsWriter();
+			if ((lease_timeout.count() < 1) ||
+				(static_cast<uint64_t>(lease_timeout.count()) > LeaseMaxTimeout))
+				throw std::invalid_argument("The lease timeout (" +
+					std::to_string(lease_timeout.count()) + " milliseconds) is "
+					"outside of the permissible range of 1 to " +
+					std::to_string(LeaseMaxTimeout) + ", inclusive.");
+			record_ptr_->magic_            = 0;
+			record_ptr_->base_time_ms_     = GetSystemTimeMs();
+			record_ptr_->lease_timeout_ms_ =
+				static_cast<uint64_t>(lease_timeout.count());
+			record_ptr_->lease_word_.store(0, std::memory_order_relaxed);
+			record_ptr_->owner_epoch_.store(0, std::memory_order_relaxed);
+			record_ptr_->owner_pid_        = 0;
+			::memset(record_ptr_->reserved_, '\0',
+				sizeof(record_ptr_->reserved_));
+			::memset(record_ptr_->owner_host_, '\0',
+				sizeof(record_ptr_->owner_host_));
+			std::atomic_thread_fence(std::memory_order_release);
+			record_ptr_->magic_            = MFStoreWriterLeaseRecord::RecordMagic;
+		}
+		else if (record_ptr_->magic_ != MFStoreWriterLeaseRecord::RecordMagic)
+			throw std::invalid_argument("The section has not been formatted as "
+				"a writer lease.");
+	}
+	catch (const std::exception &except) {
+		throw std::invalid_argument("Unable to use the section at index " +
+			std::to_string(section_index) + " of MFStore file '" +
+			mfstore_ctl.GetFileName() + "' as a writer lease: " +
+			std::string(except.what()));
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWriterLease::~MFStoreWriterLease()
+{
+	try {
+		StopHeartbeat();
+		Release();
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Succeeds if the lease is already held by this instance, or if it was
+	released or has expired.
+*/
+bool MFStoreWriterLease::TryAcquire()
+{
+	mfstore_ctl_ptr_->CheckIsWriter();
+
+	if (Heartbeat())
+		return(true);
+
+	uint64_t          lease_word = record_ptr_->lease_word_.load(
+		std::memory_order_acquire);
+	Clock::time_point renew_time = Clock::now();
+	uint64_t          lease_time = GetLeaseTime();
+
+	if (!IsExpired(lease_word, lease_time))
+		return(false);
+
+	uint64_t new_epoch = GetNextEpoch(GetLeaseEpoch(lease_word));
+
+	if (!record_ptr_->lease_word_.compare_exchange_strong(lease_word,
+		MakeLeaseWord(lease_time, new_epoch), std::memory_order_acq_rel,
+		std::memory_order_relaxed))
+		return(false);
+
+	std::string host_name(MLB::Utility::GetHostName());
+
+	record_ptr_->owner_pid_ = MLB::Utility::CurrentProcessId();
+	::memset(record_ptr_->owner_host_, '\0', sizeof(record_ptr_->owner_host_));
+	::memcpy(record_ptr_->owner_host_, host_name.c_str(),
+		std::min(host_name.size(), sizeof(record_ptr_->owner_host_) - 1));
+	record_ptr_->owner_epoch_.store(new_epoch, std::memory_order_release);
+
+	renewed_time_.store(renew_time.time_since_epoch().count(),
+		std::memory_order_release);
+	held_epoch_.store(new_epoch, std::memory_order_release);
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Polls at one twentieth of the lease timeout, so that a standby takes
+	over within about 1.05 lease timeouts of the holder's last heartbeat.
+*/
+bool MFStoreWriterLease::Acquire(const LeaseTimeout &wait_timeout)
+{
+	using Clock = std::chrono::steady_clock;
+
+	bool              infinite      = (wait_timeout == LeaseTimeout::max());
+	Clock::time_point end_time      = (infinite) ? Clock::time_point::max() :
+		(Clock::now() + wait_timeout);
+	LeaseTimeout      poll_interval = std::max(LeaseTimeout(1),
+		GetLeaseTimeout() / 20);
+
+	for ( ; ; ) {
+		if (TryAcquire())
+			return(true);
+		if ((!infinite) && (Clock::now() >= end_time))
+			return(false);
+		std::this_thread::sleep_for(poll_interval);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreWriterLease::Heartbeat()
+{
+	uint64_t held_epoch = held_epoch_.load(std::memory_order_acquire);
+
+	if (!held_epoch)
+		return(false);
+
+	uint64_t          lease_word = record_ptr_->lease_word_.load(
+		std::memory_order_acquire);
+	Clock::time_point renew_time = Clock::now();
+
+	while (GetLeaseEpoch(lease_word) == held_epoch) {
+		if (record_ptr_->lease_word_.compare_exchange_weak(lease_word,
+			MakeLeaseWord(GetLeaseTime(), held_epoch), std::memory_order_acq_rel,
+			std::memory_order_acquire)) {
+			renewed_time_.store(renew_time.time_since_epoch().count(),
+				std::memory_order_release);
+			return(true);
+		}
+	}
+
+	held_epoch_.compare_exchange_strong(held_epoch, 0);
+
+	return(false);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Marks the lease as released so that a standby may take it over at once.
+*/
+void MFStoreWriterLease::Release()
+{
+	uint64_t held_epoch = held_epoch_.exchange(0, std::memory_order_acq_rel);
+
+	if (!held_epoch)
+		return;
+
+	uint64_t lease_word = record_ptr_->lease_word_.load(
+		std::memory_order_acquire);
+
+	while (GetLeaseEpoch(lease_word) == held_epoch) {
+		if (record_ptr_->lease_word_.compare_exchange_weak(lease_word,
+			MakeLeaseWord(0, held_epoch), std::memory_order_acq_rel,
+			std::memory_order_acquire))
+			break;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The lost callback is invoked from the heartbeat thread, which then exits,
+	if a heartbeat finds that the lease has been lost.
+*/
+void MFStoreWriterLease::StartHeartbeat(const LeaseTimeout &heartbeat_interval,
+	const LostCallback &lost_callback)
+{
+	if (heartbeat_thread_.joinable())
+		return;
+
+	LeaseTimeout actual_interval = (heartbeat_interval.count() > 0) ?
+		heartbeat_interval : std::max(LeaseTimeout(1), GetLeaseTimeout() / 4);
+
+	if (actual_interval >= GetHeldTimeout())
+		throw std::invalid_argument("The heartbeat interval (" +
+			std::to_string(actual_interval.count()) + " milliseconds) must be "
+			"less than the time for which a heartbeat renews the lease (" +
+			std::to_string(GetHeldTimeout().count()) + " milliseconds).");
+
+	{
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		stop_flag_ = false;
+	}
+
+	heartbeat_thread_ = std::thread(&MFStoreWriterLease::HeartbeatThread, this,
+		actual_interval, lost_callback);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreWriterLease::StopHeartbeat()
+{
+	if (!heartbeat_thread_.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> thread_lock(thread_mutex_);
+		stop_flag_ = true;
+		thread_cv_.notify_one();
+	}
+
+	heartbeat_thread_.join();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns false once the epoch in the lease word is no longer that held,
+	and also, without waiting for a standby to take over, once the lease
+	timeout less a safety margin has passed since the last successful
+	heartbeat. The holder's claim thus lapses before a standby may take the
+	lease, even if this process has stalled or its heartbeat thread has died.
+*/
+bool MFStoreWriterLease::IsHeld() const
+{
+	uint64_t held_epoch = held_epoch_.load(std::memory_order_acquire);
+
+	if ((!held_epoch) || (GetLeaseEpoch(record_ptr_->lease_word_.load(
+		std::memory_order_acquire)) != held_epoch))
+		return(false);
+
+	Clock::time_point renew_time(Clock::duration(
+		renewed_time_.load(std::memory_order_acquire)));
+
+	return((Clock::now() - renew_time) < GetHeldTimeout());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreWriterLease::GetHeldEpoch() const
+{
+	return(held_epoch_.load(std::memory_order_acquire));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t MFStoreWriterLease::GetEpoch() const
+{
+	return(GetLeaseEpoch(record_ptr_->lease_word_.load(
+		std::memory_order_acquire)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreWriterLease::IsWriterLive() const
+{
+	return(!IsExpired(record_ptr_->lease_word_.load(std::memory_order_acquire),
+		GetLeaseTime()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWriterLeaseState MFStoreWriterLease::GetState() const
+{
+	MFStoreWriterLeaseState state;
+	uint64_t                lease_word = record_ptr_->lease_word_.load(
+		std::memory_order_acquire);
+	uint64_t                heartbeat  = GetLeaseHeartbeat(lease_word);
+
+	state.epoch_        = GetLeaseEpoch(lease_word);
+	state.heartbeat_ms_ = (heartbeat) ?
+		(record_ptr_->base_time_ms_ + (heartbeat - 1)) : 0;
+	state.live_flag_    = !IsExpired(lease_word, GetLeaseTime());
+
+	if (record_ptr_->owner_epoch_.load(std::memory_order_acquire) ==
+		state.epoch_) {
+		state.owner_pid_  = record_ptr_->owner_pid_;
+		state.owner_host_.assign(record_ptr_->owner_host_,
+			::strnlen(record_ptr_->owner_host_,
+			sizeof(record_ptr_->owner_host_)));
+	}
+
+	return(state);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWriterLease::LeaseTimeout MFStoreWriterLease::GetLeaseTimeout() const
+{
+	return(LeaseTimeout(record_ptr_->lease_timeout_ms_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreWriterLease::LeaseTimeout MFStoreWriterLease::GetHeldTimeout() const
+{
+	return(GetLeaseTimeout() - (GetLeaseTimeout() / LeaseMarginDiv));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSection MFStoreWriterLease::MakeLeaseSection(
+	const std::string &description)
+{
+	return(MFStoreSection(0, sizeof(MFStoreWriterLeaseRecord), 1, 0, 0, 0, 0,
+		0, description));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the time relative to the lease base time plus one, so that a
+	heartbeat of zero can mean that the lease was released.
+*/
+uint64_t MFStoreWriterLease::GetLeaseTime() const
+{
+	uint64_t now_ms = GetSystemTimeMs();
+
+	return(((now_ms > record_ptr_->base_time_ms_) ?
+		(now_ms - record_ptr_->base_time_ms_) : 0) + 1);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool MFStoreWriterLease::IsExpired(uint64_t lease_word,
+	uint64_t lease_time) const
+{
+	uint64_t heartbeat = GetLeaseHeartbeat(lease_word);
+
+	return((!heartbeat) || ((lease_time > heartbeat) &&
+		((lease_time - heartbeat) > record_ptr_->lease_timeout_ms_)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void MFStoreWriterLease::HeartbeatThread(LeaseTimeout heartbeat_interval,
+	LostCallback lost_callback)
+{
+	std::unique_lock<std::mutex> thread_lock(thread_mutex_);
+
+	while (!stop_flag_) {
+		thread_cv_.wait_for(thread_lock, heartbeat_interval,
+			[this]() { return(stop_flag_); });
+		if (stop_flag_)
+			break;
+		uint64_t held_epoch = GetHeldEpoch();
+		if ((!held_epoch) || Heartbeat())
+			continue;
+		thread_lock.unlock();
+		if (lost_callback)
+			lost_callback(held_epoch);
+		break;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreWriterLeaseState &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <MFStore/CreateMFStore.hpp>
+
+#include <filesystem>
+
+#ifdef __unix
+# include <sys/wait.h>
+# include <unistd.h>
+#endif // #ifdef __unix
+
+using namespace MLB::MFStore;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string TEST_FileName("./TEST_MAIN.MFStoreWriterLease.bin");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t                      TEST_LeaseIndex = 1;
+const MFStoreWriterLease::LeaseTimeout TEST_LeaseTimeout(200);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+MFStoreSectionList TEST_MakeSectionList()
+{
+	MFStoreSectionList section_list;
+
+	MFStoreSection::AppendSection(MFStoreSection(0, 4096, 1, 0, 0, 0, 0, 0,
+		"Header"), section_list);
+	MFStoreSection::AppendSection(MFStoreWriterLease::MakeLeaseSection(),
+		section_list);
+	MFStoreSection::FixupSectionList(section_list);
+
+	return(section_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Check(bool condition, const std::string &error_text)
+{
+	if (!condition)
+		throw std::logic_error(error_text);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_InProcess(const MFStoreSectionList &section_list,
+	MFStoreLen file_size)
+{
+	MFStoreControl     writer_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreControl     standby_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreControl     reader_ctl(TEST_FileName, false, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreWriterLease writer(writer_ctl, TEST_LeaseIndex, true,
+		TEST_LeaseTimeout);
+	MFStoreWriterLease standby(standby_ctl, TEST_LeaseIndex);
+	MFStoreWriterLease reader(reader_ctl, TEST_LeaseIndex);
+
+	TEST_Check(!reader.IsWriterLive(), "A new lease is held.");
+	TEST_Check(writer.TryAcquire(), "The writer couldn't acquire a new lease.");
+	TEST_Check(writer.GetHeldEpoch() == 1, "The first epoch isn't 1.");
+	TEST_Check(writer.IsHeld(), "The writer doesn't hold a new lease.");
+
+	// Without heartbeats the writer's claim lapses before the lease expires...
+	std::this_thread::sleep_for(TEST_LeaseTimeout -
+		(TEST_LeaseTimeout / 10));
+	TEST_Check(!writer.IsHeld(), "The writer still believes it holds an "
+		"unrenewed lease.");
+	TEST_Check(writer.Heartbeat() && writer.IsHeld(), "The writer couldn't "
+		"renew an unrenewed lease which no standby took over.");
+
+	std::atomic<uint64_t> lost_epoch(0);
+
+	writer.StartHeartbeat(MFStoreWriterLease::LeaseTimeout(0),
+		[&](uint64_t epoch) { lost_epoch = epoch; });
+
+	TEST_Check(!standby.Acquire(TEST_LeaseTimeout * 2), "The standby acquired "
+		"a lease which was being renewed.");
+	TEST_Check(reader.IsWriterLive() && (reader.GetEpoch() == 1),
+		"The reader doesn't see the live writer.");
+
+	MFStoreWriterLeaseState state = reader.GetState();
+
+	TEST_Check(state.owner_pid_ == MLB::Utility::CurrentProcessId(),
+		"The owner process identifier is incorrect.");
+	std::cout << "Lease held by the writer: " << state << std::endl;
+
+	// A stalled writer: no more heartbeats, but no release either...
+	writer.StopHeartbeat();
+
+	auto start_time = std::chrono::steady_clock::now();
+
+	TEST_Check(standby.Acquire(TEST_LeaseTimeout * 4), "The standby failed to "
+		"take over an expired lease.");
+
+	auto end_time   = std::chrono::steady_clock::now();
+
+	TEST_Check(standby.GetHeldEpoch() == 2, "The takeover epoch isn't 2.");
+	TEST_Check(!writer.IsHeld() && !writer.Heartbeat(), "The stalled writer "
+		"still believes it holds the lease.");
+	TEST_Check(reader.GetEpoch() == 2, "The reader didn't see the epoch "
+		"change.");
+	std::cout << "Standby took over a stalled lease after " <<
+		std::chrono::duration_cast<std::chrono::milliseconds>(end_time -
+		start_time).count() << " milliseconds with a " <<
+		TEST_LeaseTimeout.count() << " millisecond timeout: OK" << std::endl;
+
+	TEST_Check(!writer.TryAcquire(), "The writer took back a live "
+		"lease.");
+	standby.Release();
+	TEST_Check(!reader.IsWriterLive(), "A released lease is live.");
+	TEST_Check(writer.TryAcquire() && (writer.GetHeldEpoch() == 3),
+		"The writer couldn't acquire a released lease at once.");
+	// Loss detected by the heartbeat thread...
+	lost_epoch = 0;
+	writer.StartHeartbeat(MFStoreWriterLease::LeaseTimeout(20),
+		[&](uint64_t epoch) { lost_epoch = epoch; });
+	standby_ctl.GetPtr<MFStoreWriterLeaseRecord>(standby_ctl.GetSectionMapped(
+		TEST_LeaseIndex).section_offset_)->lease_word_ = writer.GetHeldEpoch();
+	TEST_Check(standby.TryAcquire() && (standby.GetHeldEpoch() == 4),
+		"The standby couldn't acquire a lease forcibly released.");
+	for (unsigned int count_1 = 0; (count_1 < 100) && (!lost_epoch);
+		++count_1)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	TEST_Check(lost_epoch == 3, "The heartbeat thread didn't report the loss "
+		"of the lease.");
+	writer.StopHeartbeat();
+	std::cout << "Heartbeat thread reported the loss of epoch " <<
+		lost_epoch << ": OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Failover(const MFStoreSectionList &section_list,
+	MFStoreLen file_size)
+{
+	MFStoreControl     standby_ctl(TEST_FileName, true, file_size, file_size,
+		MFStoreAllocGran, section_list);
+	MFStoreWriterLease standby(standby_ctl, TEST_LeaseIndex);
+	uint64_t           start_epoch = standby.GetEpoch();
+	pid_t              child_pid   = ::fork();
+
+	if (child_pid < 0)
+		throw std::runtime_error("Call to ::fork() failed.");
+
+	if (!child_pid) {
+		int exit_code = 1;
+		try {
+			MFStoreControl     writer_ctl(TEST_FileName, true, file_size,
+				file_size, MFStoreAllocGran, section_list);
+			MFStoreWriterLease writer(writer_ctl, TEST_LeaseIndex);
+			if (writer.Acquire(TEST_LeaseTimeout * 10)) {
+				writer.StartHeartbeat();
+				std::this_thread::sleep_for(TEST_LeaseTimeout * 3);
+				exit_code = (writer.IsHeld()) ? 0 : 2;
+			}
+			// Crash without releasing the lease...
+			::_exit(exit_code);
+		}
+		catch (const std::exception &) {
+		}
+		::_exit(exit_code);
+	}
+
+	while (standby.GetEpoch() == start_epoch)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	TEST_Check(!standby.TryAcquire(), "The standby acquired the lease of a "
+		"live writer.");
+
+	int child_status = 0;
+
+	::waitpid(child_pid, &child_status, 0);
+
+	TEST_Check(WIFEXITED(child_status) && (WEXITSTATUS(child_status) == 0),
+		"The writer process failed.");
+
+	MFStoreWriterLeaseState state = standby.GetState();
+
+	TEST_Check((state.owner_pid_ == static_cast<uint64_t>(child_pid)) &&
+		state.heartbeat_ms_, "The lease isn't held by the writer process.");
+	TEST_Check(standby.Acquire(TEST_LeaseTimeout * 10), "The standby failed to "
+		"take over from the crashed writer.");
+
+	uint64_t failover_ms = standby.GetState().heartbeat_ms_ -
+		state.heartbeat_ms_;
+
+	std::cout << "Standby took over from crashed writer process " <<
+		child_pid << " " << failover_ms << " milliseconds after its last "
+		"heartbeat: " << ((failover_ms < 1000) ? "OK" : "SLOW") << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef __unix
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		MFStoreSectionList section_list = TEST_MakeSectionList();
+		MFStoreLen         file_size    = section_list.back().CalcNextOffset();
+		std::filesystem::remove(TEST_FileName);
+		CreateMFStore(TEST_FileName, file_size, file_size);
+		TEST_InProcess(section_list, file_size);
+#ifdef __unix
+		TEST_Failover(section_list, file_size);
+#endif // #ifdef __unix
+		std::filesystem::remove(TEST_FileName);
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
@@ -190,6 +190,24 @@ void NatsConnection::Publish(const char *subject_name, const void *data_ptr,
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+void NatsConnection::Publish(const NatsSubject &subject, const void *data_ptr,
+	std::size_t data_length)
+{
+	if (data_length >
+		 static_cast<std::size_t>(std::numeric_limits<int>::max()))
+		throw std::invalid_argument("Length of the data to be published is "
+			"greater than the maximum permissible by the data type NATS uses to "
+			"specify the length of published data (" +
+			std::to_string(std::numeric_limits<int>::max()) + ").");
+
+	ThrowIfWildcard(subject, "The subject on which data is to be published");
+
+	NatsWrapper_THROW_IF_NOT_OK(::natsConnection_Publish,
+		(GetPtr(), subject.GetPtr(), data_ptr, static_cast<int>(data_length)))
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 void NatsConnection::PublishString(const char *subject_name, const char *str)
 {
@@ -259,6 +277,28 @@ void NatsConnection::PublishRequest(const std::string &send_subject,
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+void NatsConnection::PublishRequest(const NatsSubject &send_subject,
+	const NatsSubject &reply_subject, const void *data_ptr,
+	std::size_t data_length)
+{
+	if (data_length >
+		 static_cast<std::size_t>(std::numeric_limits<int>::max()))
+		throw std::invalid_argument("Length of the data to be published is "
+			"greater than the maximum permissible by the data type NATS uses to "
+			"specify the length of published data (" +
+			std::to_string(std::numeric_limits<int>::max()) + ").");
+
+	ThrowIfWildcard(send_subject,
+		"The send subject on which data is to be published");
+	ThrowIfWildcard(reply_subject, "The reply subject");
+
+	NatsWrapper_THROW_IF_NOT_OK(::natsConnection_PublishRequest,
+		(GetPtr(), send_subject.GetPtr(), reply_subject.GetPtr(), data_ptr,
+		static_cast<int>(data_length)))
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 void NatsConnection::PublishRequestString(const char *send_subject,
 	const char *reply_subject, const char *str)
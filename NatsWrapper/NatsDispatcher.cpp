@@ -0,0 +1,567 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsDispatcher.cpp
+
+   File Description  :  Implementation of the NatsDispatcher class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsDispatcher.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <algorithm>
+#include <string_view>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcherStats::NatsDispatcherStats()
+	:dispatch_count_(0)
+	,process_count_(0)
+	,steal_count_(0)
+	,error_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &NatsDispatcherStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Dispatched=" << dispatch_count_
+		<< ", Processed=" << process_count_
+		<< ", Steals=" << steal_count_
+		<< ", Errors=" << error_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcher::Strand::Strand()
+	:strand_mutex_()
+	,msg_queue_()
+	,scheduled_flag_(false)
+	,worker_index_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcher::Worker::Worker()
+	:run_mutex_()
+	,run_queue_()
+	,worker_thread_()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcher::NatsDispatcher(const NatsDispatchHandlerFunc &handler_func,
+	unsigned int thread_count, const NatsDispatchKeyFunc &key_func,
+	std::size_t strand_count)
+	:handler_func_(handler_func)
+	,key_func_(key_func)
+	,strand_list_()
+	,worker_list_()
+	,runnable_count_(0)
+	,pending_count_(0)
+	,idle_count_(0)
+	,stop_flag_(false)
+	,idle_mutex_()
+	,idle_cv_()
+	,dispatch_count_(0)
+	,process_count_(0)
+	,steal_count_(0)
+	,error_count_(0)
+{
+	if (!handler_func_)
+		throw std::invalid_argument("The dispatcher handler function is "
+			"empty.");
+
+	if (!strand_count)
+		throw std::invalid_argument("The dispatcher strand count is 0.");
+
+	if (!thread_count)
+		thread_count = std::max(1U, std::thread::hardware_concurrency());
+
+	for (std::size_t worker_index = 0; worker_index < thread_count;
+		++worker_index)
+		worker_list_.emplace_back(new Worker);
+
+	for (std::size_t strand_index = 0; strand_index < strand_count;
+		++strand_index) {
+		strand_list_.emplace_back(new Strand);
+		strand_list_.back()->worker_index_ = strand_index % thread_count;
+	}
+
+	try {
+		for (std::size_t worker_index = 0; worker_index < thread_count;
+			++worker_index)
+			worker_list_[worker_index]->worker_thread_ =
+				std::thread(&NatsDispatcher::WorkerThread, this, worker_index);
+	}
+	catch (const std::exception &) {
+		Stop();
+		throw;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcher::~NatsDispatcher()
+{
+	Stop();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsDispatcher::Dispatch(natsMsg *nats_msg_ptr)
+{
+	NatsMsg nats_msg(nats_msg_ptr);
+
+	MLB::Utility::ThrowIfNull(nats_msg_ptr, "The message to be dispatched");
+
+	if (stop_flag_.load(std::memory_order_relaxed))
+		throw std::logic_error("Attempt to dispatch a message to a dispatcher "
+			"which has been stopped.");
+
+	Strand *strand_ptr =
+		strand_list_[GetKey(nats_msg) % strand_list_.size()].get();
+	bool    schedule_flag;
+
+	pending_count_.fetch_add(1, std::memory_order_relaxed);
+	dispatch_count_.fetch_add(1, std::memory_order_relaxed);
+
+	{
+		std::lock_guard<std::mutex> strand_lock(strand_ptr->strand_mutex_);
+		strand_ptr->msg_queue_.push_back(std::move(nats_msg));
+		schedule_flag               = !strand_ptr->scheduled_flag_;
+		strand_ptr->scheduled_flag_ = true;
+	}
+
+	if (schedule_flag)
+		Schedule(strand_ptr, strand_ptr->worker_index_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsSubscription NatsDispatcher::Subscribe(NatsConnection &nats_conn,
+	const std::string &subject_name)
+{
+	return(nats_conn.Subscribe(subject_name, NatsDispatcher::NatsMsgHandler,
+		this));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsDispatcher::Drain(std::chrono::microseconds time_out)
+{
+	auto end_time = std::chrono::steady_clock::now() + time_out;
+
+	while (pending_count_.load(std::memory_order_acquire)) {
+		if (std::chrono::steady_clock::now() >= end_time)
+			return(false);
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsDispatcher::Stop()
+{
+	{
+		std::lock_guard<std::mutex> idle_lock(idle_mutex_);
+		stop_flag_.store(true);
+		idle_cv_.notify_all();
+	}
+
+	for (auto &this_worker : worker_list_) {
+		if (this_worker->worker_thread_.joinable())
+			this_worker->worker_thread_.join();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+unsigned int NatsDispatcher::GetThreadCount() const
+{
+	return(static_cast<unsigned int>(worker_list_.size()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsDispatcher::GetStrandCount() const
+{
+	return(strand_list_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcherStats NatsDispatcher::GetStats() const
+{
+	NatsDispatcherStats stats;
+
+	stats.dispatch_count_ = dispatch_count_.load(std::memory_order_relaxed);
+	stats.process_count_  = process_count_.load(std::memory_order_relaxed);
+	stats.steal_count_    = steal_count_.load(std::memory_order_relaxed);
+	stats.error_count_    = error_count_.load(std::memory_order_relaxed);
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsDispatcher::NatsMsgHandler(natsConnection * /* nats_conn_ptr */,
+	natsSubscription * /* nats_subs_ptr */, natsMsg *nats_msg_ptr,
+	void *closure_ptr)
+{
+	if (!closure_ptr) {
+		::natsMsg_Destroy(nats_msg_ptr);
+		return;
+	}
+
+	NatsDispatcher *dispatcher_ptr = static_cast<NatsDispatcher *>(closure_ptr);
+
+	// Exceptions mustn't propagate into the NATS library.
+	try {
+		dispatcher_ptr->Dispatch(nats_msg_ptr);
+	}
+	catch (const std::exception &) {
+		dispatcher_ptr->error_count_.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsDispatcher::GetKey(const NatsMsg &nats_msg) const
+{
+	return((key_func_) ? key_func_(nats_msg) :
+		std::hash<std::string_view>()(nats_msg.GetSubject()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The runnable count is incremented before the strand is queued so that it
+	is never less than the number of queued strands. Together with the idle
+	count it ensures that a worker doesn't go to sleep while a strand is
+	waiting: either this thread sees the idle worker and wakes it, or the
+	worker sees the runnable count before it sleeps.
+*/
+void NatsDispatcher::Schedule(Strand *strand_ptr, std::size_t worker_index)
+{
+	Worker &worker = *worker_list_[worker_index];
+
+	runnable_count_.fetch_add(1, std::memory_order_seq_cst);
+
+	{
+		std::lock_guard<std::mutex> run_lock(worker.run_mutex_);
+		worker.run_queue_.push_back(strand_ptr);
+	}
+
+	if (idle_count_.load(std::memory_order_seq_cst)) {
+		std::lock_guard<std::mutex> idle_lock(idle_mutex_);
+		idle_cv_.notify_one();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsDispatcher::Strand *NatsDispatcher::TakeStrand(std::size_t worker_index)
+{
+	{
+		Worker                      &worker = *worker_list_[worker_index];
+		std::lock_guard<std::mutex>  run_lock(worker.run_mutex_);
+		if (!worker.run_queue_.empty()) {
+			Strand *strand_ptr = worker.run_queue_.front();
+			worker.run_queue_.pop_front();
+			runnable_count_.fetch_sub(1, std::memory_order_relaxed);
+			return(strand_ptr);
+		}
+	}
+
+	for (std::size_t offset = 1; offset < worker_list_.size(); ++offset) {
+		Worker                      &worker =
+			*worker_list_[(worker_index + offset) % worker_list_.size()];
+		std::lock_guard<std::mutex>  run_lock(worker.run_mutex_);
+		if (!worker.run_queue_.empty()) {
+			Strand *strand_ptr = worker.run_queue_.back();
+			worker.run_queue_.pop_back();
+			runnable_count_.fetch_sub(1, std::memory_order_relaxed);
+			steal_count_.fetch_add(1, std::memory_order_relaxed);
+			return(strand_ptr);
+		}
+	}
+
+	return(nullptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsDispatcher::RunStrand(Strand *strand_ptr, std::size_t worker_index)
+{
+	for (std::size_t msg_count = 0; msg_count < StrandBatchLimit;
+		++msg_count) {
+		NatsMsg nats_msg;
+		{
+			std::lock_guard<std::mutex> strand_lock(strand_ptr->strand_mutex_);
+			if (strand_ptr->msg_queue_.empty()) {
+				strand_ptr->scheduled_flag_ = false;
+				return;
+			}
+			nats_msg = std::move(strand_ptr->msg_queue_.front());
+			strand_ptr->msg_queue_.pop_front();
+		}
+		try {
+			handler_func_(nats_msg);
+		}
+		catch (const std::exception &) {
+			error_count_.fetch_add(1, std::memory_order_relaxed);
+		}
+		process_count_.fetch_add(1, std::memory_order_relaxed);
+		pending_count_.fetch_sub(1, std::memory_order_release);
+	}
+
+	{
+		std::lock_guard<std::mutex> strand_lock(strand_ptr->strand_mutex_);
+		if (strand_ptr->msg_queue_.empty()) {
+			strand_ptr->scheduled_flag_ = false;
+			return;
+		}
+	}
+
+	// Still scheduled, but give other strands queued on this worker a turn.
+	Schedule(strand_ptr, worker_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsDispatcher::WorkerThread(std::size_t worker_index)
+{
+	for ( ; ; ) {
+		Strand *strand_ptr = TakeStrand(worker_index);
+		if (strand_ptr) {
+			RunStrand(strand_ptr, worker_index);
+			continue;
+		}
+		std::unique_lock<std::mutex> idle_lock(idle_mutex_);
+		idle_count_.fetch_add(1, std::memory_order_seq_cst);
+		if (!runnable_count_.load(std::memory_order_seq_cst)) {
+			if (stop_flag_.load()) {
+				idle_count_.fetch_sub(1, std::memory_order_relaxed);
+				return;
+			}
+			idle_cv_.wait(idle_lock);
+		}
+		idle_count_.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsDispatcherStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <cstring>
+#include <iostream>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_SubjectCount = 64;
+const uint64_t    TEST_MsgCount     = 200000;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsMsg *TEST_MakeMsg(const std::string &subject_name, uint64_t msg_index)
+{
+	natsMsg *nats_msg_ptr = nullptr;
+
+	NatsWrapper_THROW_IF_NOT_OK(::natsMsg_Create,
+		(&nats_msg_ptr, subject_name.c_str(), nullptr,
+		reinterpret_cast<const char *>(&msg_index), sizeof(msg_index)))
+
+	return(nats_msg_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t TEST_GetMsgIndex(const NatsMsg &nats_msg)
+{
+	uint64_t msg_index;
+
+	if (nats_msg.GetDataLength() != sizeof(msg_index))
+		throw std::logic_error("The test message has an incorrect length.");
+
+	::memcpy(&msg_index, nats_msg.GetData(), sizeof(msg_index));
+
+	return(msg_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Each message carries its sequence number within its subject, which the
+	handler checks. The first subject's handler is slow, which mustn't delay
+	the others. A handler which was entered concurrently for the same subject
+	is also detected.
+*/
+void TEST_SubjectOrdering()
+{
+	std::vector<std::string>      subject_list;
+	std::vector<uint64_t>         next_list(TEST_SubjectCount, 0);
+	std::vector<std::atomic<int>> active_list(TEST_SubjectCount);
+	std::atomic<bool>             order_error(false);
+
+	for (std::size_t subject_index = 0; subject_index < TEST_SubjectCount;
+		++subject_index)
+		subject_list.push_back("TEST.Subject." + std::to_string(subject_index));
+
+	NatsDispatcher dispatcher([&](NatsMsg &nats_msg) {
+		std::size_t subject_index = static_cast<std::size_t>(
+			std::stoul(nats_msg.GetSubject() + 13));
+		if (active_list[subject_index]++)
+			order_error = true;
+		if (TEST_GetMsgIndex(nats_msg) != next_list[subject_index]++)
+			order_error = true;
+		if ((!subject_index) && (!(next_list[0] % 100)))
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		--active_list[subject_index];
+	}, 4);
+
+	std::vector<uint64_t> sent_list(TEST_SubjectCount, 0);
+	auto                  start_time = std::chrono::steady_clock::now();
+
+	for (uint64_t msg_index = 0; msg_index < TEST_MsgCount; ++msg_index) {
+		std::size_t subject_index = (msg_index * 7) % TEST_SubjectCount;
+		dispatcher.Dispatch(TEST_MakeMsg(subject_list[subject_index],
+			sent_list[subject_index]++));
+	}
+
+	if (!dispatcher.Drain(std::chrono::seconds(60)))
+		throw std::logic_error("Drain() of the dispatcher timed out.");
+
+	auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+
+	NatsDispatcherStats stats(dispatcher.GetStats());
+
+	std::cout << "Subject ordering: " << stats << " in " << elapsed_usecs <<
+		" microseconds" << std::endl;
+
+	if (order_error)
+		throw std::logic_error("Messages of a subject were processed out of "
+			"order or concurrently.");
+
+	if ((next_list != sent_list) || (stats.process_count_ != TEST_MsgCount) ||
+		stats.error_count_)
+		throw std::logic_error("Not all messages were processed.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Orders by a key taken from the message data rather than by subject. A
+	handler which throws is counted as an error.
+*/
+void TEST_KeyOrdering()
+{
+	const std::size_t     key_count = 8;
+	std::vector<uint64_t> last_list(key_count, 0);
+	std::atomic<bool>     order_error(false);
+
+	NatsDispatcher dispatcher([&](NatsMsg &nats_msg) {
+		uint64_t msg_index = TEST_GetMsgIndex(nats_msg);
+		if (!msg_index)
+			throw std::runtime_error("The first message is rejected.");
+		uint64_t &last_index = last_list[msg_index % key_count];
+		if (last_index && (msg_index <= last_index))
+			order_error = true;
+		last_index = msg_index;
+	}, 3, [key_count](const NatsMsg &nats_msg) {
+		return(static_cast<std::size_t>(TEST_GetMsgIndex(nats_msg) % key_count));
+	}, key_count);
+
+	for (uint64_t msg_index = 0; msg_index < 50000; ++msg_index)
+		dispatcher.Dispatch(TEST_MakeMsg("TEST.Key." +
+			std::to_string(msg_index % 13), msg_index));
+
+	dispatcher.Stop();
+
+	NatsDispatcherStats stats(dispatcher.GetStats());
+
+	std::cout << "Key ordering: " << stats << std::endl;
+
+	if (order_error)
+		throw std::logic_error("Messages of a key were processed out of order.");
+
+	if ((stats.process_count_ != 50000) || (stats.error_count_ != 1))
+		throw std::logic_error("The dispatcher statistics are incorrect.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_SubjectOrdering();
+		TEST_KeyOrdering();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
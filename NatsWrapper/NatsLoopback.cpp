@@ -0,0 +1,1126 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsLoopback.cpp
+
+   File Description  :  Implementation of the NatsLoopback and
+                        NatsLoopbackSubscription classes.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsLoopback.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+/// Used internally by the delivery threads to wait without a timeout.
+const int64_t NatsLoopback_WaitForever = -1;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &CheckSubscriptionSubject(const std::string &subject_name)
+{
+	if (!IsValidNatsSubject(subject_name, true))
+		throw std::invalid_argument("The string '" + subject_name + "' is not "
+			"a valid NATS subscription subject.");
+
+	return(subject_name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The message queue is a bounded multi-producer, multi-consumer ring in
+	which the sequence number of each cell indicates whether it may be
+	written or read, as in NatsPublishQueue.
+
+	Instances are owned by the shared pointer given to the delivery thread
+	and held by the deleter of the NatsLoopbackSubscription pointer, so that
+	a callback may release the last copy of its own subscription.
+*/
+struct NatsLoopback::Subscriber
+{
+	struct Cell
+	{
+		std::atomic<uint64_t>  sequence_;
+		natsMsg               *msg_ptr_;
+	};
+
+	Subscriber(NatsLoopback *loopback_ptr, const std::string &subject_name,
+		const std::string &queue_group, natsMsgHandler call_back,
+		void *closure_ptr, std::size_t queue_capacity);
+	~Subscriber();
+
+	bool        Push(natsMsg *nats_msg_ptr);
+	natsMsg    *Pop();
+	natsMsg    *Take(int64_t time_out);
+	void        Wake();
+	void        Close();
+	void        DeliveryThread();
+	std::size_t GetApproximateCount() const;
+
+	NatsLoopback               *loopback_ptr_;
+	std::string                 subject_name_;
+	std::string                 queue_group_;
+	bool                        wildcard_flag_;
+	natsMsgHandler              call_back_;
+	void                       *closure_ptr_;
+	uint64_t                    cell_mask_;
+	std::unique_ptr<Cell[]>     cell_list_;
+	alignas(64)
+	std::atomic<uint64_t>       push_pos_;
+	alignas(64)
+	std::atomic<uint64_t>       pop_pos_;
+	alignas(64)
+	std::atomic<unsigned int>   waiter_count_;
+	std::atomic<bool>           closed_flag_;
+	std::atomic<uint64_t>       drop_count_;
+	std::mutex                  wake_mutex_;
+	std::condition_variable     wake_cv_;
+	std::thread                 delivery_thread_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopback::Subscriber::Subscriber(NatsLoopback *loopback_ptr,
+	const std::string &subject_name, const std::string &queue_group,
+	natsMsgHandler call_back, void *closure_ptr, std::size_t queue_capacity)
+	:loopback_ptr_(loopback_ptr)
+	,subject_name_(subject_name)
+	,queue_group_(queue_group)
+	,wildcard_flag_(subject_name.find_first_of("*>") != std::string::npos)
+	,call_back_(call_back)
+	,closure_ptr_(closure_ptr)
+	,cell_mask_(queue_capacity - 1)
+	,cell_list_(new Cell[queue_capacity])
+	,push_pos_(0)
+	,pop_pos_(0)
+	,waiter_count_(0)
+	,closed_flag_(false)
+	,drop_count_(0)
+	,wake_mutex_()
+	,wake_cv_()
+	,delivery_thread_()
+{
+	for (std::size_t cell_index = 0; cell_index < queue_capacity; ++cell_index)
+		cell_list_[cell_index].sequence_.store(cell_index,
+			std::memory_order_relaxed);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopback::Subscriber::~Subscriber()
+{
+	Close();
+
+	natsMsg *nats_msg_ptr;
+
+	while ((nats_msg_ptr = Pop()) != nullptr)
+		::natsMsg_Destroy(nats_msg_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsLoopback::Subscriber::Push(natsMsg *nats_msg_ptr)
+{
+	uint64_t  push_pos = push_pos_.load(std::memory_order_relaxed);
+	Cell     *cell_ptr;
+
+	for ( ; ; ) {
+		cell_ptr = &cell_list_[push_pos & cell_mask_];
+		int64_t diff = static_cast<int64_t>(cell_ptr->sequence_.load(
+			std::memory_order_acquire)) - static_cast<int64_t>(push_pos);
+		if (!diff) {
+			if (push_pos_.compare_exchange_weak(push_pos, push_pos + 1,
+				std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+			return(false);
+		else
+			push_pos = push_pos_.load(std::memory_order_relaxed);
+	}
+
+	cell_ptr->msg_ptr_ = nats_msg_ptr;
+	cell_ptr->sequence_.store(push_pos + 1, std::memory_order_release);
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsMsg *NatsLoopback::Subscriber::Pop()
+{
+	uint64_t  pop_pos = pop_pos_.load(std::memory_order_relaxed);
+	Cell     *cell_ptr;
+
+	for ( ; ; ) {
+		cell_ptr = &cell_list_[pop_pos & cell_mask_];
+		int64_t diff = static_cast<int64_t>(cell_ptr->sequence_.load(
+			std::memory_order_acquire)) - static_cast<int64_t>(pop_pos + 1);
+		if (!diff) {
+			if (pop_pos_.compare_exchange_weak(pop_pos, pop_pos + 1,
+				std::memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0)
+			return(nullptr);
+		else
+			pop_pos = pop_pos_.load(std::memory_order_relaxed);
+	}
+
+	natsMsg *nats_msg_ptr = cell_ptr->msg_ptr_;
+
+	cell_ptr->sequence_.store(pop_pos + cell_mask_ + 1,
+		std::memory_order_release);
+
+	return(nats_msg_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The fence after the waiter count is incremented pairs with the one in
+	Wake(): either the publisher sees the waiter or the waiter sees the
+	message which the publisher just pushed.
+*/
+natsMsg *NatsLoopback::Subscriber::Take(int64_t time_out)
+{
+	natsMsg *nats_msg_ptr = Pop();
+
+	if (nats_msg_ptr || (!time_out))
+		return(nats_msg_ptr);
+
+	auto end_time = std::chrono::steady_clock::now() +
+		std::chrono::milliseconds(std::max<int64_t>(time_out, 0));
+
+	std::unique_lock<std::mutex> wake_lock(wake_mutex_);
+
+	waiter_count_.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	while (((nats_msg_ptr = Pop()) == nullptr) &&
+		(!closed_flag_.load(std::memory_order_relaxed))) {
+		if (time_out == NatsLoopback_WaitForever)
+			wake_cv_.wait(wake_lock);
+		else if (wake_cv_.wait_until(wake_lock, end_time) ==
+			std::cv_status::timeout) {
+			nats_msg_ptr = Pop();
+			break;
+		}
+	}
+
+	waiter_count_.fetch_sub(1, std::memory_order_relaxed);
+
+	return(nats_msg_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsLoopback::Subscriber::Wake()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (waiter_count_.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+		wake_cv_.notify_one();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsLoopback::Subscriber::Close()
+{
+	if (closed_flag_.exchange(true))
+		return;
+
+	loopback_ptr_->RemoveSubscriber(this);
+
+	{
+		std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+		wake_cv_.notify_all();
+	}
+
+	if (delivery_thread_.joinable()) {
+		// The delivery thread holds a reference, so it may exit on its own.
+		if (delivery_thread_.get_id() == std::this_thread::get_id())
+			delivery_thread_.detach();
+		else
+			delivery_thread_.join();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsLoopback::Subscriber::DeliveryThread()
+{
+	for ( ; ; ) {
+		natsMsg *nats_msg_ptr = Take(NatsLoopback_WaitForever);
+		if (closed_flag_.load(std::memory_order_acquire)) {
+			if (nats_msg_ptr)
+				::natsMsg_Destroy(nats_msg_ptr);
+			break;
+		}
+		if (!nats_msg_ptr)
+			continue;
+		// Exceptions mustn't end the thread.
+		try {
+			call_back_(nullptr, nullptr, nats_msg_ptr, closure_ptr_);
+		}
+		catch (const std::exception &) {
+		}
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Subscriber::GetApproximateCount() const
+{
+	uint64_t push_pos = push_pos_.load(std::memory_order_relaxed);
+	uint64_t pop_pos  = pop_pos_.load(std::memory_order_relaxed);
+
+	return((push_pos > pop_pos) ? static_cast<std::size_t>(push_pos - pop_pos) :
+		0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackStats::NatsLoopbackStats()
+	:publish_count_(0)
+	,deliver_count_(0)
+	,drop_count_(0)
+	,no_interest_count_(0)
+	,subscription_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &NatsLoopbackStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Published=" << publish_count_
+		<< ", Delivered=" << deliver_count_
+		<< ", Dropped=" << drop_count_
+		<< ", NoInterest=" << no_interest_count_
+		<< ", Subscriptions=" << subscription_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopback::NatsLoopback(std::size_t queue_capacity)
+	:queue_capacity_(2)
+	,route_mutex_()
+	,literal_map_()
+	,wildcard_list_()
+	,subscription_count_(0)
+	,next_inbox_(1)
+	,queue_select_(0)
+	,publish_count_(0)
+	,deliver_count_(0)
+	,drop_count_(0)
+	,no_interest_count_(0)
+{
+	while (queue_capacity_ < queue_capacity)
+		queue_capacity_ <<= 1;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopback::~NatsLoopback()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Publish(const char *subject_name,
+	std::size_t subject_name_length, const void *data_ptr,
+	std::size_t data_length)
+{
+	MLB::Utility::ThrowIfNull(subject_name,
+		"The subject name on which to publish");
+
+	if (!subject_name_length)
+		throw std::invalid_argument("The length of the subject name on which "
+			"data to be published is 0.");
+
+	// Messages require a NUL-terminated subject.
+	thread_local std::string subject_buffer;
+
+	subject_buffer.assign(subject_name, subject_name_length);
+
+	return(Route(subject_buffer.c_str(), subject_buffer, nullptr, data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Publish(const std::string_view &subject_name,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(Publish(subject_name.data(), subject_name.size(), data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Publish(const std::string &subject_name,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(Publish(subject_name.c_str(), data_ptr, data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Publish(const char *subject_name,
+	const void *data_ptr, std::size_t data_length)
+{
+	MLB::Utility::ThrowIfNullOrEmpty(subject_name,
+		"The subject name on which to publish");
+
+	return(Route(subject_name, subject_name, nullptr, data_ptr, data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::Publish(const NatsSubject &subject,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(Route(subject.GetPtr(), subject.GetStringView(), nullptr, data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::PublishRequest(const char *send_subject,
+	const char *reply_subject, const void *data_ptr, std::size_t data_length)
+{
+	MLB::Utility::ThrowIfNullOrEmpty(send_subject,
+		"The subject name on which to publish the request");
+	MLB::Utility::ThrowIfNullOrEmpty(reply_subject,
+		"The subject name on which to receive the reply");
+
+	return(Route(send_subject, send_subject, reply_subject, data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::PublishRequest(const std::string &send_subject,
+	const std::string &reply_subject, const void *data_ptr,
+	std::size_t data_length)
+{
+	return(PublishRequest(send_subject.c_str(), reply_subject.c_str(),
+		data_ptr, data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg NatsLoopback::Request(const char *subject_name, const void *data_ptr,
+	std::size_t data_length, int64_t time_out)
+{
+	std::string              reply_subject("_INBOX.loopback." +
+		std::to_string(next_inbox_.fetch_add(1, std::memory_order_relaxed)));
+	NatsLoopbackSubscription reply_subs(SubscribeSync(reply_subject));
+
+	if (!PublishRequest(subject_name, reply_subject.c_str(), data_ptr,
+		data_length))
+		throw NatsExceptionStatus(NATS_NO_RESPONDERS, "NatsLoopback::Request");
+
+	NatsMsg reply_msg(reply_subs.NextMsg(time_out));
+
+	if (reply_msg.IsEmpty())
+		throw NatsExceptionStatus(NATS_TIMEOUT, "NatsLoopback::Request");
+
+	return(reply_msg);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg NatsLoopback::Request(const std::string &subject_name,
+	const void *data_ptr, std::size_t data_length, int64_t time_out)
+{
+	return(Request(subject_name.c_str(), data_ptr, data_length, time_out));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription NatsLoopback::Subscribe(
+	const std::string &subject_name, natsMsgHandler call_back, void *closure)
+{
+	if (!call_back)
+		throw std::invalid_argument("The subscription callback is NULL.");
+
+	return(AddSubscriber(subject_name, std::string(), call_back, closure));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription NatsLoopback::QueueSubscribe(
+	const std::string &subject_name, const std::string &queue_group,
+	natsMsgHandler call_back, void *closure)
+{
+	if (!call_back)
+		throw std::invalid_argument("The subscription callback is NULL.");
+	MLB::Utility::ThrowIfEmpty(queue_group, "The subscription queue group");
+
+	return(AddSubscriber(subject_name, queue_group, call_back, closure));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription NatsLoopback::SubscribeSync(
+	const std::string &subject_name)
+{
+	return(AddSubscriber(subject_name, std::string(), nullptr, nullptr));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription NatsLoopback::QueueSubscribeSync(
+	const std::string &subject_name, const std::string &queue_group)
+{
+	MLB::Utility::ThrowIfEmpty(queue_group, "The subscription queue group");
+
+	return(AddSubscriber(subject_name, queue_group, nullptr, nullptr));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishFunc NatsLoopback::GetPublishFunc()
+{
+	return([this](const char *subject_name, const void *data_ptr,
+		int data_length) {
+		if ((!subject_name) || (!*subject_name) || (data_length < 0))
+			return(NATS_INVALID_ARG);
+		Route(subject_name, subject_name, nullptr, data_ptr,
+			static_cast<std::size_t>(data_length));
+		return(NATS_OK);
+	});
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopback::GetQueueCapacity() const
+{
+	return(queue_capacity_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackStats NatsLoopback::GetStats() const
+{
+	NatsLoopbackStats stats;
+
+	stats.publish_count_     = publish_count_.load(std::memory_order_relaxed);
+	stats.deliver_count_     = deliver_count_.load(std::memory_order_relaxed);
+	stats.drop_count_        = drop_count_.load(std::memory_order_relaxed);
+	stats.no_interest_count_ =
+		no_interest_count_.load(std::memory_order_relaxed);
+
+	std::shared_lock<std::shared_mutex> route_lock(route_mutex_);
+
+	stats.subscription_count_ = subscription_count_;
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription NatsLoopback::AddSubscriber(
+	const std::string &subject_name, const std::string &queue_group,
+	natsMsgHandler call_back, void *closure)
+{
+	std::shared_ptr<Subscriber> subscriber_sptr(new Subscriber(this,
+		CheckSubscriptionSubject(subject_name), queue_group, call_back,
+		closure, queue_capacity_));
+
+	if (call_back)
+		subscriber_sptr->delivery_thread_ = std::thread([subscriber_sptr]() {
+			subscriber_sptr->DeliveryThread();
+		});
+
+	NatsLoopbackSubscription loopback_subs(std::shared_ptr<Subscriber>(
+		subscriber_sptr.get(), [subscriber_sptr](Subscriber *subscriber_ptr) {
+			subscriber_ptr->Close();
+		}));
+
+	std::unique_lock<std::shared_mutex> route_lock(route_mutex_);
+
+	if (subscriber_sptr->wildcard_flag_)
+		wildcard_list_.push_back(subscriber_sptr.get());
+	else
+		literal_map_[subject_name].push_back(subscriber_sptr.get());
+
+	++subscription_count_;
+
+	return(loopback_subs);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsLoopback::RemoveSubscriber(Subscriber *subscriber_ptr)
+{
+	std::unique_lock<std::shared_mutex> route_lock(route_mutex_);
+	SubscriberList                     *subscriber_list_ptr = &wildcard_list_;
+	auto                                iter_f = literal_map_.end();
+
+	if (!subscriber_ptr->wildcard_flag_) {
+		if ((iter_f = literal_map_.find(subscriber_ptr->subject_name_)) ==
+			literal_map_.end())
+			return;
+		subscriber_list_ptr = &iter_f->second;
+	}
+
+	auto iter_s = std::find(subscriber_list_ptr->begin(),
+		subscriber_list_ptr->end(), subscriber_ptr);
+
+	if (iter_s == subscriber_list_ptr->end())
+		return;
+
+	subscriber_list_ptr->erase(iter_s);
+
+	if ((iter_f != literal_map_.end()) && subscriber_list_ptr->empty())
+		literal_map_.erase(iter_f);
+
+	--subscription_count_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Subscribers are removed under the exclusive lock, so those found here
+	remain valid until the shared lock is released. Of the subscribers in a
+	queue group, the one to receive the message is selected in rotation.
+*/
+std::size_t NatsLoopback::Route(const char *subject_name,
+	const std::string_view &subject_view, const char *reply_subject,
+	const void *data_ptr, std::size_t data_length)
+{
+	thread_local SubscriberList match_list;
+
+	publish_count_.fetch_add(1, std::memory_order_relaxed);
+
+	match_list.clear();
+
+	std::shared_lock<std::shared_mutex> route_lock(route_mutex_);
+
+	auto iter_f = literal_map_.find(subject_view);
+
+	if (iter_f != literal_map_.end())
+		match_list.insert(match_list.end(), iter_f->second.begin(),
+			iter_f->second.end());
+
+	for (Subscriber *subscriber_ptr : wildcard_list_) {
+		if (IsNatsSubjectMatch(subscriber_ptr->subject_name_, subject_view))
+			match_list.push_back(subscriber_ptr);
+	}
+
+	if (match_list.empty()) {
+		no_interest_count_.fetch_add(1, std::memory_order_relaxed);
+		return(0);
+	}
+
+	std::size_t deliver_count = 0;
+
+	for (std::size_t match_index = 0; match_index < match_list.size();
+		++match_index) {
+		Subscriber        *subscriber_ptr = match_list[match_index];
+		const std::string &queue_group    = subscriber_ptr->queue_group_;
+		if (queue_group.empty()) {
+			deliver_count += Deliver(subscriber_ptr, subject_name,
+				reply_subject, data_ptr, data_length) ? 1 : 0;
+			continue;
+		}
+		// Each queue group is handled at its first member.
+		auto iter_b = match_list.begin();
+		auto iter_m = iter_b + static_cast<std::ptrdiff_t>(match_index);
+		if (std::any_of(iter_b, iter_m, [&queue_group](Subscriber *other_ptr) {
+			return(other_ptr->queue_group_ == queue_group); }))
+			continue;
+		auto member_count = std::count_if(iter_m, match_list.end(),
+			[&queue_group](Subscriber *other_ptr) {
+			return(other_ptr->queue_group_ == queue_group); });
+		auto member_index = static_cast<std::ptrdiff_t>(queue_select_.fetch_add(
+			1, std::memory_order_relaxed) %
+			static_cast<uint64_t>(member_count));
+		for ( ; ; ++iter_m) {
+			if (((*iter_m)->queue_group_ == queue_group) && (!member_index--))
+				break;
+		}
+		deliver_count += Deliver(*iter_m, subject_name, reply_subject,
+			data_ptr, data_length) ? 1 : 0;
+	}
+
+	return(deliver_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsLoopback::Deliver(Subscriber *subscriber_ptr,
+	const char *subject_name, const char *reply_subject, const void *data_ptr,
+	std::size_t data_length)
+{
+	natsMsg *nats_msg_ptr = nullptr;
+
+	if ((::natsMsg_Create(&nats_msg_ptr, subject_name, reply_subject,
+		static_cast<const char *>(data_ptr), static_cast<int>(data_length)) !=
+		NATS_OK) || (!subscriber_ptr->Push(nats_msg_ptr))) {
+		if (nats_msg_ptr)
+			::natsMsg_Destroy(nats_msg_ptr);
+		subscriber_ptr->drop_count_.fetch_add(1, std::memory_order_relaxed);
+		drop_count_.fetch_add(1, std::memory_order_relaxed);
+		return(false);
+	}
+
+	deliver_count_.fetch_add(1, std::memory_order_relaxed);
+
+	subscriber_ptr->Wake();
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription::NatsLoopbackSubscription()
+	:subscriber_sptr_()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription::NatsLoopbackSubscription(
+	const std::shared_ptr<NatsLoopback::Subscriber> &subscriber_sptr)
+	:subscriber_sptr_(subscriber_sptr)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopbackSubscription::~NatsLoopbackSubscription()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg NatsLoopbackSubscription::NextMsg(int64_t time_out)
+{
+	NatsLoopback::Subscriber &subscriber = GetSubscriberChecked();
+
+	if (subscriber.call_back_)
+		throw NatsExceptionStatus(NATS_ILLEGAL_STATE,
+			"NatsLoopbackSubscription::NextMsg");
+
+	if (subscriber.closed_flag_.load(std::memory_order_relaxed))
+		throw NatsExceptionStatus(NATS_INVALID_SUBSCRIPTION,
+			"NatsLoopbackSubscription::NextMsg");
+
+	return(NatsMsg(subscriber.Take(std::max<int64_t>(time_out, 0))));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsStatus NatsLoopbackSubscription::NextMsgs(NatsMsg *msg_array,
+	std::size_t max_count, int64_t time_out, std::size_t &msg_count)
+{
+	msg_count = 0;
+
+	if (!subscriber_sptr_)
+		return(NATS_INVALID_SUBSCRIPTION);
+	else if (subscriber_sptr_->call_back_)
+		return(NATS_ILLEGAL_STATE);
+	else if (!max_count)
+		return(NATS_OK);
+	else if (!msg_array)
+		return(NATS_INVALID_ARG);
+
+	natsMsg *nats_msg_ptr =
+		subscriber_sptr_->Take(std::max<int64_t>(time_out, 0));
+
+	if (!nats_msg_ptr)
+		return((subscriber_sptr_->closed_flag_.load(std::memory_order_relaxed)) ?
+			NATS_INVALID_SUBSCRIPTION : NATS_TIMEOUT);
+
+	do {
+		msg_array[msg_count++].Reset(nats_msg_ptr);
+	} while ((msg_count < max_count) &&
+		((nats_msg_ptr = subscriber_sptr_->Pop()) != nullptr));
+
+	return(NATS_OK);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsStatus NatsLoopbackSubscription::NextMsgs(std::vector<NatsMsg> &msg_list,
+	std::size_t max_count, int64_t time_out)
+{
+	std::size_t old_size  = msg_list.size();
+	std::size_t msg_count = 0;
+
+	msg_list.resize(old_size + max_count);
+
+	natsStatus nats_status = NextMsgs(msg_list.data() + old_size, max_count,
+		time_out, msg_count);
+
+	msg_list.resize(old_size + msg_count);
+
+	return(nats_status);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsLoopbackSubscription::Unsubscribe()
+{
+	if (subscriber_sptr_)
+		subscriber_sptr_->Close();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &NatsLoopbackSubscription::GetSubject() const
+{
+	return(GetSubscriberChecked().subject_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &NatsLoopbackSubscription::GetQueueGroup() const
+{
+	return(GetSubscriberChecked().queue_group_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsLoopbackSubscription::GetPendingCount() const
+{
+	return(GetSubscriberChecked().GetApproximateCount());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t NatsLoopbackSubscription::GetDropCount() const
+{
+	return(GetSubscriberChecked().drop_count_.load(std::memory_order_relaxed));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsLoopbackSubscription::IsEmpty() const
+{
+	return(!subscriber_sptr_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsLoopback::Subscriber &NatsLoopbackSubscription::GetSubscriberChecked()
+	const
+{
+	if (!subscriber_sptr_)
+		throw std::runtime_error("Attempt to make use of a loopback "
+			"subscription, but it is empty.");
+
+	return(*subscriber_sptr_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsLoopbackStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <NatsWrapper/NatsDispatcher.hpp>
+
+#include <cstring>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t TEST_Drain(NatsLoopbackSubscription &loopback_subs)
+{
+	std::vector<NatsMsg> msg_list;
+
+	while (loopback_subs.NextMsgs(msg_list, 256, 0) == NATS_OK)
+		;
+
+	return(msg_list.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Wildcards()
+{
+	NatsLoopback             loopback;
+	NatsLoopbackSubscription literal_subs(loopback.SubscribeSync("MD.NYSE.IBM"));
+	NatsLoopbackSubscription star_subs(loopback.SubscribeSync("MD.*.IBM"));
+	NatsLoopbackSubscription tail_subs(loopback.SubscribeSync("MD.>"));
+	NatsLoopbackSubscription other_subs(loopback.SubscribeSync("FX.>"));
+
+	if ((loopback.Publish("MD.NYSE.IBM", "1", 1) != 3) ||
+		(loopback.Publish("MD.NYSE", "2", 1) != 1) ||
+		(loopback.Publish("EQ.NYSE.IBM", "3", 1) != 0))
+		throw std::logic_error("Messages were routed to the wrong number of "
+			"subscriptions.");
+
+	NatsMsg nats_msg(literal_subs.NextMsg(100));
+
+	if (nats_msg.IsEmpty() || (nats_msg.GetSubjectView() != "MD.NYSE.IBM") ||
+		(nats_msg.GetDataView() != "1"))
+		throw std::logic_error("A routed message has incorrect contents.");
+
+	if ((TEST_Drain(literal_subs) != 0) || (TEST_Drain(star_subs) != 1) ||
+		(TEST_Drain(tail_subs) != 2) || (TEST_Drain(other_subs) != 0))
+		throw std::logic_error("Subscriptions received the wrong number of "
+			"messages.");
+
+	tail_subs.Unsubscribe();
+
+	if (loopback.Publish("MD.NYSE.IBM", "4", 1) != 2)
+		throw std::logic_error("An unsubscribed subscription received a "
+			"message.");
+
+	std::cout << "Wildcards: " << loopback.GetStats() << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_QueueGroups()
+{
+	const std::size_t                     publish_count = 3000;
+	NatsLoopback                          loopback;
+	std::vector<NatsLoopbackSubscription> member_list;
+	NatsLoopbackSubscription              plain_subs(
+		loopback.SubscribeSync("ORDERS.>"));
+
+	for (std::size_t member_index = 0; member_index < 3; ++member_index)
+		member_list.push_back(loopback.QueueSubscribeSync("ORDERS.*",
+			"workers"));
+
+	for (std::size_t msg_index = 0; msg_index < publish_count; ++msg_index) {
+		if (loopback.Publish("ORDERS.NEW", &msg_index, sizeof(msg_index)) != 2)
+			throw std::logic_error("A queue group message was not delivered to "
+				"exactly one member.");
+	}
+
+	std::size_t member_total = 0;
+
+	for (auto &member_subs : member_list) {
+		std::size_t member_count = TEST_Drain(member_subs);
+		if (!member_count)
+			throw std::logic_error("A queue group member received nothing.");
+		member_total += member_count;
+	}
+
+	if ((member_total != publish_count) ||
+		(TEST_Drain(plain_subs) != publish_count))
+		throw std::logic_error("Queue group delivery counts are incorrect.");
+
+	std::cout << "Queue groups: " << loopback.GetStats() << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_EchoHandler(natsConnection * /* nats_conn_ptr */,
+	natsSubscription * /* nats_subs_ptr */, natsMsg *nats_msg_ptr,
+	void *closure_ptr)
+{
+	NatsMsg nats_msg(nats_msg_ptr);
+
+	if (nats_msg.GetReply())
+		static_cast<NatsLoopback *>(closure_ptr)->Publish(nats_msg.GetReply(),
+			nats_msg.GetData(), static_cast<std::size_t>(
+			nats_msg.GetDataLength()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_RequestReply()
+{
+	const std::size_t        request_count = 1000;
+	NatsLoopback             loopback;
+	NatsLoopbackSubscription echo_subs(loopback.QueueSubscribe("SVC.Echo",
+		"echo", TEST_EchoHandler, &loopback));
+	auto                     start_time = std::chrono::steady_clock::now();
+
+	for (std::size_t msg_index = 0; msg_index < request_count; ++msg_index) {
+		NatsMsg reply_msg(loopback.Request("SVC.Echo", &msg_index,
+			sizeof(msg_index), 1000));
+		std::size_t reply_index;
+		::memcpy(&reply_index, reply_msg.GetData(), sizeof(reply_index));
+		if (reply_index != msg_index)
+			throw std::logic_error("A reply doesn't match its request.");
+	}
+
+	auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+
+	bool rejected_flag = false;
+
+	try {
+		loopback.Request("SVC.None", "", 0, 1000);
+	}
+	catch (const NatsExceptionStatus &except) {
+		rejected_flag = except.GetNatsStatus() == NATS_NO_RESPONDERS;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("A request without a responder didn't fail "
+			"with NATS_NO_RESPONDERS.");
+
+	std::cout << "Request/reply: " << request_count << " round trips in " <<
+		elapsed_usecs << " microseconds" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_CountHandler(natsConnection * /* nats_conn_ptr */,
+	natsSubscription * /* nats_subs_ptr */, natsMsg *nats_msg_ptr,
+	void *closure_ptr)
+{
+	::natsMsg_Destroy(nats_msg_ptr);
+
+	static_cast<std::atomic<uint64_t> *>(closure_ptr)->fetch_add(1,
+		std::memory_order_relaxed);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Throughput()
+{
+	const std::size_t        publish_count = 1000000;
+	NatsLoopback             loopback;
+	std::atomic<uint64_t>    receive_count(0);
+	NatsLoopbackSubscription count_subs(loopback.Subscribe("BENCH.Tick",
+		TEST_CountHandler, &receive_count));
+	NatsSubject              subject("BENCH.Tick");
+	char                     payload[64] = { };
+	auto                     start_time = std::chrono::steady_clock::now();
+
+	for (std::size_t msg_index = 0; msg_index < publish_count; ++msg_index)
+		loopback.Publish(subject, payload, sizeof(payload));
+
+	while ((receive_count.load() + count_subs.GetDropCount()) < publish_count)
+		std::this_thread::yield();
+
+	auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+
+	std::cout << "Throughput: " << loopback.GetStats() << " in " <<
+		elapsed_usecs << " microseconds" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Interoperation()
+{
+	const std::size_t        publish_count = 10000;
+	NatsLoopback             loopback;
+	NatsLoopbackSubscription sync_subs(loopback.SubscribeSync("PQ.>"));
+	std::atomic<uint64_t>    process_count(0);
+	NatsDispatcher           dispatcher([&process_count](NatsMsg &) {
+		process_count.fetch_add(1, std::memory_order_relaxed); }, 2);
+	NatsLoopbackSubscription dispatch_subs(loopback.Subscribe("PQ.*",
+		NatsDispatcher::NatsMsgHandler, &dispatcher));
+
+	{
+		NatsPublishQueue publish_queue(loopback.GetPublishFunc());
+		for (std::size_t msg_index = 0; msg_index < publish_count; ++msg_index)
+			publish_queue.Enqueue((msg_index % 2) ? "PQ.Odd" : "PQ.Even",
+				&msg_index, sizeof(msg_index));
+		if (!publish_queue.Flush(std::chrono::seconds(10)))
+			throw std::logic_error("The publish queue didn't flush.");
+	}
+
+	if (TEST_Drain(sync_subs) != publish_count)
+		throw std::logic_error("Messages from the publish queue were lost.");
+
+	auto end_time = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+	while ((process_count.load() < publish_count) &&
+		(std::chrono::steady_clock::now() < end_time))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	if ((!dispatcher.Drain(std::chrono::seconds(10))) ||
+		(process_count.load() != publish_count))
+		throw std::logic_error("Messages weren't all dispatched.");
+
+	std::cout << "Publish queue and dispatcher: " << loopback.GetStats() <<
+		std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Wildcards();
+		TEST_QueueGroups();
+		TEST_RequestReply();
+		TEST_Throughput();
+		TEST_Interoperation();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
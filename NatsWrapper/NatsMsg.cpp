@@ -32,31 +32,42 @@ namespace MLB {
 namespace NatsWrapper {
 
 // ////////////////////////////////////////////////////////////////////////////
-// PRIVATE: Accessible to NatsSubscription::NextMessage()
-NatsMsg::NatsMsg(natsMsg *nats_msg)
-	:nats_msg_sptr_()
+NatsMsg::NatsMsg(natsMsg *nats_msg) noexcept
+	:nats_msg_ptr_(nats_msg)
 {
-	if (nats_msg)
-		nats_msg_sptr_.reset(nats_msg, ::natsMsg_Destroy);
 }
 // ////////////////////////////////////////////////////////////////////////////
 
 // ////////////////////////////////////////////////////////////////////////////
 NatsMsg::NatsMsg(NatsSubscription &nats_subs, int64_t time_out)
-	:nats_msg_sptr_()
+	:nats_msg_ptr_(nullptr)
 {
-	natsMsg *nats_msg = NULL;
-
 	NatsWrapper_THROW_IF_NOT_OK(::natsSubscription_NextMsg,
-		(&nats_msg, nats_subs.GetPtr(), time_out))
+		(&nats_msg_ptr_, nats_subs.GetPtr(), time_out))
+}
+// ////////////////////////////////////////////////////////////////////////////
 
-	nats_msg_sptr_.reset(nats_msg, ::natsMsg_Destroy);
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg::NatsMsg(NatsMsg &&other) noexcept
+	:nats_msg_ptr_(other.Release())
+{
 }
 // ////////////////////////////////////////////////////////////////////////////
 
 // ////////////////////////////////////////////////////////////////////////////
 NatsMsg::~NatsMsg()
 {
+	Reset();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg & NatsMsg::operator = (NatsMsg &&other) noexcept
+{
+	if (this != &other)
+		Reset(other.Release());
+
+	return(*this);
 }
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -88,26 +99,80 @@ int NatsMsg::GetDataLength() const
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsMsg::GetSubjectView() const
+{
+	return(std::string_view(GetSubject()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsMsg::GetReplyView() const
+{
+	const char *reply_ptr = GetReply();
+
+	return((reply_ptr) ? std::string_view(reply_ptr) : std::string_view());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsMsg::GetDataView() const
+{
+	const natsMsg *nats_msg_ptr = GetPtrChecked();
+
+	return(std::string_view(natsMsg_GetData(nats_msg_ptr),
+		static_cast<std::size_t>(natsMsg_GetDataLength(nats_msg_ptr))));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 bool NatsMsg::IsNoResponders() const
 {
 	GetPtrChecked();
 
-	return(::natsMsg_IsNoResponders(nats_msg_sptr_.get()));
+	return(::natsMsg_IsNoResponders(nats_msg_ptr_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsMsg::IsEmpty() const
+{
+	return(nats_msg_ptr_ == nullptr);
 }
 // ////////////////////////////////////////////////////////////////////////////
 
 // ////////////////////////////////////////////////////////////////////////////
 natsMsg *NatsMsg::GetPtr()
 {
-	return(nats_msg_sptr_.get());
+	return(nats_msg_ptr_);
 }
 // ////////////////////////////////////////////////////////////////////////////
 
 // ////////////////////////////////////////////////////////////////////////////
 const natsMsg *NatsMsg::GetPtr() const
 {
-	return(nats_msg_sptr_.get());
+	return(nats_msg_ptr_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsMsg *NatsMsg::Release() noexcept
+{
+	natsMsg *nats_msg_ptr = nats_msg_ptr_;
+
+	nats_msg_ptr_ = nullptr;
+
+	return(nats_msg_ptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsMsg::Reset(natsMsg *nats_msg) noexcept
+{
+	if (nats_msg_ptr_ && (nats_msg_ptr_ != nats_msg))
+		::natsMsg_Destroy(nats_msg_ptr_);
+
+	nats_msg_ptr_ = nats_msg;
 }
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -129,14 +194,14 @@ const natsMsg *GetPtrChecked_Helper(const natsMsg *nats_msg_ptr)
 // ////////////////////////////////////////////////////////////////////////////
 natsMsg *NatsMsg::GetPtrChecked()
 {
-	return(const_cast<natsMsg *>(GetPtrChecked_Helper(nats_msg_sptr_.get())));
+	return(const_cast<natsMsg *>(GetPtrChecked_Helper(nats_msg_ptr_)));
 }
 // ////////////////////////////////////////////////////////////////////////////
 
 // ////////////////////////////////////////////////////////////////////////////
 const natsMsg *NatsMsg::GetPtrChecked() const
 {
-	return(GetPtrChecked_Helper(nats_msg_sptr_.get()));
+	return(GetPtrChecked_Helper(nats_msg_ptr_));
 }
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,463 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsMsgPool.cpp
+
+   File Description  :  Implementation of the NatsMsgPool and NatsPooledMsg
+                        classes.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsMsgPool.hpp>
+
+#include <cstring>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsgPoolStats::NatsMsgPoolStats()
+	:copy_count_(0)
+	,allocate_count_(0)
+	,shrink_count_(0)
+	,free_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &NatsMsgPoolStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Copies=" << copy_count_
+		<< ", Allocations=" << allocate_count_
+		<< ", Shrinks=" << shrink_count_
+		<< ", Free=" << free_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsgPool::NatsMsgPool(std::size_t initial_count,
+	std::size_t max_retained_length)
+	:max_retained_length_(max_retained_length)
+	,pool_mutex_()
+	,buffer_list_()
+	,free_list_ptr_(nullptr)
+	,free_count_(0)
+	,copy_count_(0)
+	,shrink_count_(0)
+{
+	buffer_list_.reserve(initial_count);
+
+	for (std::size_t buffer_index = 0; buffer_index < initial_count;
+		++buffer_index) {
+		buffer_list_.emplace_back(new Buffer{std::vector<char>(), 0, 0, 0,
+			free_list_ptr_});
+		free_list_ptr_ = buffer_list_.back().get();
+		++free_count_;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsgPool::~NatsMsgPool()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg NatsMsgPool::Copy(const NatsMsg &nats_msg)
+{
+	return(Copy(nats_msg.GetSubjectView(), nats_msg.GetReplyView(),
+		nats_msg.GetDataView()));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg NatsMsgPool::Copy(const std::string_view &subject_name,
+	const std::string_view &reply_name, const std::string_view &data)
+{
+	Buffer *buffer_ptr = AcquireBuffer();
+
+	try {
+		buffer_ptr->buffer_data_.resize(subject_name.size() + reply_name.size() +
+			data.size());
+	}
+	catch (const std::exception &) {
+		ReleaseBuffer(buffer_ptr);
+		throw;
+	}
+
+	char *dst_ptr = buffer_ptr->buffer_data_.data();
+
+	if (!subject_name.empty())
+		::memcpy(dst_ptr, subject_name.data(), subject_name.size());
+	if (!reply_name.empty())
+		::memcpy(dst_ptr + subject_name.size(), reply_name.data(),
+			reply_name.size());
+	if (!data.empty())
+		::memcpy(dst_ptr + subject_name.size() + reply_name.size(), data.data(),
+			data.size());
+
+	buffer_ptr->subject_length_ = subject_name.size();
+	buffer_ptr->reply_length_   = reply_name.size();
+	buffer_ptr->data_length_    = data.size();
+
+	return(NatsPooledMsg(this, buffer_ptr));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsgPoolStats NatsMsgPool::GetStats() const
+{
+	std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+	NatsMsgPoolStats            stats;
+
+	stats.copy_count_     = copy_count_;
+	stats.allocate_count_ = buffer_list_.size();
+	stats.shrink_count_   = shrink_count_;
+	stats.free_count_     = free_count_;
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsgPool::Buffer *NatsMsgPool::AcquireBuffer()
+{
+	std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+
+	++copy_count_;
+
+	if (free_list_ptr_) {
+		Buffer *buffer_ptr = free_list_ptr_;
+		free_list_ptr_ = buffer_ptr->next_free_ptr_;
+		--free_count_;
+		return(buffer_ptr);
+	}
+
+	buffer_list_.emplace_back(new Buffer{std::vector<char>(), 0, 0, 0,
+		nullptr});
+
+	return(buffer_list_.back().get());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsMsgPool::ReleaseBuffer(Buffer *buffer_ptr)
+{
+	bool shrink_flag =
+		buffer_ptr->buffer_data_.capacity() > max_retained_length_;
+
+	if (shrink_flag)
+		std::vector<char>().swap(buffer_ptr->buffer_data_);
+
+	std::lock_guard<std::mutex> pool_lock(pool_mutex_);
+
+	if (shrink_flag)
+		++shrink_count_;
+
+	buffer_ptr->next_free_ptr_ = free_list_ptr_;
+	free_list_ptr_             = buffer_ptr;
+	++free_count_;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg::NatsPooledMsg() noexcept
+	:pool_ptr_(nullptr)
+	,buffer_ptr_(nullptr)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg::NatsPooledMsg(NatsPooledMsg &&other) noexcept
+	:pool_ptr_(other.pool_ptr_)
+	,buffer_ptr_(other.buffer_ptr_)
+{
+	other.pool_ptr_   = nullptr;
+	other.buffer_ptr_ = nullptr;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg::NatsPooledMsg(NatsMsgPool *pool_ptr,
+	NatsMsgPool::Buffer *buffer_ptr) noexcept
+	:pool_ptr_(pool_ptr)
+	,buffer_ptr_(buffer_ptr)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg::~NatsPooledMsg()
+{
+	Reset();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPooledMsg & NatsPooledMsg::operator = (NatsPooledMsg &&other) noexcept
+{
+	if (this != &other) {
+		Reset();
+		pool_ptr_         = other.pool_ptr_;
+		buffer_ptr_       = other.buffer_ptr_;
+		other.pool_ptr_   = nullptr;
+		other.buffer_ptr_ = nullptr;
+	}
+
+	return(*this);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsPooledMsg::GetSubject() const
+{
+	const NatsMsgPool::Buffer &buffer = GetBufferChecked();
+
+	return(std::string_view(buffer.buffer_data_.data(),
+		buffer.subject_length_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsPooledMsg::GetReply() const
+{
+	const NatsMsgPool::Buffer &buffer = GetBufferChecked();
+
+	return(std::string_view(buffer.buffer_data_.data() +
+		buffer.subject_length_, buffer.reply_length_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsPooledMsg::GetData() const
+{
+	const NatsMsgPool::Buffer &buffer = GetBufferChecked();
+
+	return(std::string_view(buffer.buffer_data_.data() +
+		buffer.subject_length_ + buffer.reply_length_, buffer.data_length_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPooledMsg::IsEmpty() const
+{
+	return(buffer_ptr_ == nullptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPooledMsg::Reset() noexcept
+{
+	if (buffer_ptr_) {
+		pool_ptr_->ReleaseBuffer(buffer_ptr_);
+		pool_ptr_   = nullptr;
+		buffer_ptr_ = nullptr;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const NatsMsgPool::Buffer &NatsPooledMsg::GetBufferChecked() const
+{
+	if (!buffer_ptr_)
+		throw std::runtime_error("Attempt to make use of the contents of a "
+			"pooled message, but it is empty.");
+
+	return(*buffer_ptr_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsMsgPoolStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg TEST_MakeMsg(const char *subject_name, const char *reply_name,
+	const std::string &data)
+{
+	natsMsg *nats_msg_ptr = nullptr;
+
+	NatsWrapper_THROW_IF_NOT_OK(::natsMsg_Create,
+		(&nats_msg_ptr, subject_name, reply_name, data.data(),
+		static_cast<int>(data.size())))
+
+	return(NatsMsg(nats_msg_ptr));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_MoveOnlyMsg()
+{
+	NatsMsg msg_1(TEST_MakeMsg("TEST.Msg", "TEST.Reply", "payload"));
+
+	if ((msg_1.GetSubjectView() != "TEST.Msg") ||
+		(msg_1.GetReplyView() != "TEST.Reply") ||
+		(msg_1.GetDataView() != "payload"))
+		throw std::logic_error("The message views are incorrect.");
+
+	NatsMsg msg_2(std::move(msg_1));
+
+	if ((!msg_1.IsEmpty()) || msg_2.IsEmpty() ||
+		(msg_2.GetDataView() != "payload"))
+		throw std::logic_error("Moving a message didn't transfer ownership.");
+
+	NatsMsg msg_3(TEST_MakeMsg("TEST.Other", nullptr, ""));
+
+	if ((!msg_3.GetReplyView().empty()) || (!msg_3.GetDataView().empty()))
+		throw std::logic_error("The views of a message without a reply or "
+			"data are not empty.");
+
+	msg_3 = std::move(msg_2);
+
+	if ((!msg_2.IsEmpty()) || (msg_3.GetSubjectView() != "TEST.Msg"))
+		throw std::logic_error("Move assignment didn't transfer ownership.");
+
+	natsMsg *nats_msg_ptr = msg_3.Release();
+
+	if ((!msg_3.IsEmpty()) || (!nats_msg_ptr))
+		throw std::logic_error("Release() didn't relinquish ownership.");
+
+	msg_3.Reset(nats_msg_ptr);
+
+	bool rejected_flag = false;
+
+	try {
+		msg_1.GetSubject();
+	}
+	catch (const std::exception &) {
+		rejected_flag = true;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("Access to an empty message was permitted.");
+
+	std::cout << "Move-only message: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Pool()
+{
+	const std::size_t         outstanding_count = 100;
+	const std::size_t         cycle_count       = 1000000;
+	NatsMsgPool               msg_pool(outstanding_count, 256);
+	std::deque<NatsPooledMsg> msg_queue;
+	auto                      start_time = std::chrono::steady_clock::now();
+
+	for (std::size_t msg_index = 0; msg_index < cycle_count; ++msg_index) {
+		msg_queue.push_back(msg_pool.Copy("TEST.Pool", "",
+			std::string_view(reinterpret_cast<const char *>(&msg_index),
+			sizeof(msg_index))));
+		if (msg_queue.size() == outstanding_count) {
+			std::size_t first_index;
+			::memcpy(&first_index, msg_queue.front().GetData().data(),
+				sizeof(first_index));
+			if ((first_index != (msg_index + 1 - outstanding_count)) ||
+				(msg_queue.front().GetSubject() != "TEST.Pool") ||
+				(!msg_queue.front().GetReply().empty()))
+				throw std::logic_error("A pooled message has incorrect "
+					"contents.");
+			msg_queue.pop_front();
+		}
+	}
+
+	auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+
+	msg_queue.clear();
+
+	NatsMsgPoolStats stats(msg_pool.GetStats());
+
+	std::cout << "Pooled messages: " << stats << " in " << elapsed_usecs <<
+		" microseconds" << std::endl;
+
+	if ((stats.copy_count_ != cycle_count) ||
+		(stats.allocate_count_ != outstanding_count) ||
+		(stats.free_count_ != outstanding_count))
+		throw std::logic_error("The pool allocated more buffers than were "
+			"outstanding at once.");
+
+	{
+		NatsPooledMsg large_msg(msg_pool.Copy(TEST_MakeMsg("TEST.Large", nullptr,
+			std::string(1000, 'X'))));
+		NatsPooledMsg moved_msg(std::move(large_msg));
+		if ((!large_msg.IsEmpty()) || (moved_msg.GetData().size() != 1000))
+			throw std::logic_error("Moving a pooled message failed.");
+	}
+
+	if (msg_pool.GetStats().shrink_count_ != 1)
+		throw std::logic_error("A large buffer was retained by the pool.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_MoveOnlyMsg();
+		TEST_Pool();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
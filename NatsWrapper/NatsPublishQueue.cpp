@@ -0,0 +1,901 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsPublishQueue.cpp
+
+   File Description  :  Implementation of the NatsPublishQueue class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsPublishQueue.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <cstring>
+#include <limits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t NatsPublishQueue_SlotAlignment = 64;
+const unsigned    NatsPublishQueue_SpinCount     = 64;
+const auto        NatsPublishQueue_BackoffTime   = std::chrono::microseconds(50);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void Backoff(unsigned &wait_count)
+{
+	if (wait_count < NatsPublishQueue_SpinCount) {
+		++wait_count;
+		std::this_thread::yield();
+	}
+	else
+		std::this_thread::sleep_for(NatsPublishQueue_BackoffTime);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishFunc MakeConnectionPublishFunc(NatsConnection &nats_conn)
+{
+	natsConnection *nats_conn_ptr = nats_conn.GetPtr();
+
+	MLB::Utility::ThrowIfNull(nats_conn_ptr,
+		"The NATS connection used by the publish queue");
+
+	return([nats_conn_ptr](const char *subject_name, const void *data_ptr,
+		int data_length) {
+		return(::natsConnection_Publish(nats_conn_ptr, subject_name, data_ptr,
+			data_length));
+	});
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t RoundUpToPowerOfTwo(std::size_t src_value)
+{
+	std::size_t dst_value = 1;
+
+	while (dst_value < src_value)
+		dst_value <<= 1;
+
+	return(dst_value);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueueParams::NatsPublishQueueParams()
+	:queue_capacity_(DefaultQueueCapacity)
+	,max_subject_length_(DefaultMaxSubjectLength)
+	,max_payload_length_(DefaultMaxPayloadLength)
+	,policy_(NatsPublishQueuePolicy::Block)
+	,latency_budget_(0)
+	,max_batch_count_(DefaultMaxBatchCount)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueueStats::NatsPublishQueueStats()
+	:enqueue_count_(0)
+	,publish_count_(0)
+	,drop_count_(0)
+	,block_count_(0)
+	,batch_count_(0)
+	,error_count_(0)
+	,last_error_(NATS_OK)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &NatsPublishQueueStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Enqueued=" << enqueue_count_
+		<< ", Published=" << publish_count_
+		<< ", Dropped=" << drop_count_
+		<< ", Blocked=" << block_count_
+		<< ", Batches=" << batch_count_
+		<< ", Errors=" << error_count_
+		<< ", LastError=" << static_cast<int>(last_error_);
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueue::NatsPublishQueue(NatsConnection &nats_conn,
+	const NatsPublishQueueParams &params)
+	:NatsPublishQueue(MakeConnectionPublishFunc(nats_conn), params)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueue::NatsPublishQueue(const NatsPublishFunc &publish_func,
+	const NatsPublishQueueParams &params)
+	:publish_func_(publish_func)
+	,params_(params)
+	,slot_stride_(0)
+	,slot_mask_(0)
+	,slot_storage_()
+	,slot_base_ptr_(nullptr)
+	,enqueue_pos_(0)
+	,dequeue_pos_(0)
+	,release_count_(0)
+	,stop_flag_(false)
+	,sleeping_flag_(false)
+	,wake_mutex_()
+	,wake_cv_()
+	,enqueue_count_(0)
+	,publish_count_(0)
+	,drop_count_(0)
+	,block_count_(0)
+	,batch_count_(0)
+	,error_count_(0)
+	,last_error_(NATS_OK)
+	,publish_thread_()
+{
+	if (!publish_func_)
+		throw std::invalid_argument("The publish queue function is empty.");
+
+	if (params_.queue_capacity_ < 2)
+		throw std::invalid_argument("The publish queue capacity must be at "
+			"least 2.");
+
+	if (params_.queue_capacity_ >
+		(static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()) + 1))
+		throw std::invalid_argument("The publish queue capacity (" +
+			std::to_string(params_.queue_capacity_) + ") is too large.");
+
+	if (!params_.max_subject_length_)
+		throw std::invalid_argument("The maximum subject length of the publish "
+			"queue is 0.");
+
+	if ((params_.max_subject_length_ >
+		static_cast<std::size_t>(std::numeric_limits<uint32_t>::max())) ||
+		(params_.max_payload_length_ >
+		static_cast<std::size_t>(std::numeric_limits<int>::max())))
+		throw std::invalid_argument("The maximum subject or payload length of "
+			"the publish queue is too large.");
+
+	if (!params_.max_batch_count_)
+		throw std::invalid_argument("The maximum batch count of the publish "
+			"queue is 0.");
+
+	params_.queue_capacity_ = RoundUpToPowerOfTwo(params_.queue_capacity_);
+	slot_mask_              = params_.queue_capacity_ - 1;
+	slot_stride_            = ((sizeof(SlotHeader) +
+		params_.max_subject_length_ + 1 + params_.max_payload_length_ +
+		(NatsPublishQueue_SlotAlignment - 1)) /
+		NatsPublishQueue_SlotAlignment) * NatsPublishQueue_SlotAlignment;
+
+	if (slot_stride_ > ((std::numeric_limits<std::size_t>::max() -
+		NatsPublishQueue_SlotAlignment) / params_.queue_capacity_))
+		throw std::invalid_argument("The memory required by the publish queue "
+			"is too large.");
+
+	slot_storage_.resize((params_.queue_capacity_ * slot_stride_) +
+		NatsPublishQueue_SlotAlignment);
+
+	slot_base_ptr_ = slot_storage_.data() + ((NatsPublishQueue_SlotAlignment -
+		(reinterpret_cast<std::uintptr_t>(slot_storage_.data()) %
+		NatsPublishQueue_SlotAlignment)) % NatsPublishQueue_SlotAlignment);
+
+	for (uint64_t slot_pos = 0; slot_pos < params_.queue_capacity_;
+		++slot_pos) {
+		SlotHeader *slot_ptr = new (slot_base_ptr_ + (slot_pos * slot_stride_))
+			SlotHeader;
+		slot_ptr->sequence_.store(slot_pos, std::memory_order_relaxed);
+		slot_ptr->interned_ptr_   = nullptr;
+		slot_ptr->subject_length_ = 0;
+		slot_ptr->data_length_    = 0;
+	}
+
+	publish_thread_ = std::thread(&NatsPublishQueue::PublishThread, this);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueue::~NatsPublishQueue()
+{
+	Stop();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Enqueue(const char *subject_name,
+	std::size_t subject_name_length, const void *data_ptr,
+	std::size_t data_length)
+{
+	if ((!subject_name) || (!subject_name_length))
+		throw std::invalid_argument("The subject name on which data is to be "
+			"published is NULL or empty.");
+
+	if (subject_name_length > params_.max_subject_length_)
+		throw std::invalid_argument("The length of the subject name on which "
+			"data is to be published (" + std::to_string(subject_name_length) +
+			") exceeds the maximum subject length of the publish queue (" +
+			std::to_string(params_.max_subject_length_) + ").");
+
+	return(EnqueueInternal(subject_name, subject_name_length, nullptr,
+		data_ptr, data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Enqueue(const NatsSubject &subject,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(EnqueueInternal(nullptr, 0,
+		ThrowIfWildcard(subject, "The subject on which data is to be "
+		"published").GetPtr(), data_ptr, data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Exactly one of the subject to be copied into the slot (subject_name) and
+	the subject to be referred to by the slot (interned_ptr) is specified.
+*/
+bool NatsPublishQueue::EnqueueInternal(const char *subject_name,
+	std::size_t subject_name_length, const char *interned_ptr,
+	const void *data_ptr, std::size_t data_length)
+{
+	if (data_length && (!data_ptr))
+		MLB::Utility::ThrowIfNull(data_ptr,
+			"The pointer to data to be published");
+
+	if (data_length > params_.max_payload_length_)
+		throw std::invalid_argument("The length of the data to be published (" +
+			std::to_string(data_length) + ") exceeds the maximum payload length "
+			"of the publish queue (" + std::to_string(params_.max_payload_length_)
+			+ ").");
+
+	if (stop_flag_.load(std::memory_order_relaxed))
+		throw std::logic_error("Attempt to enqueue a message on a publish queue "
+			"which has been stopped.");
+
+	uint64_t    slot_pos;
+	SlotHeader *slot_ptr;
+	bool        blocked_flag = false;
+	unsigned    wait_count   = 0;
+
+	while ((slot_ptr = TryClaimForEnqueue(slot_pos)) == nullptr) {
+		if (params_.policy_ == NatsPublishQueuePolicy::DropNewest) {
+			drop_count_.fetch_add(1, std::memory_order_relaxed);
+			return(false);
+		}
+		else if (params_.policy_ == NatsPublishQueuePolicy::DropOldest) {
+			uint64_t    old_pos;
+			SlotHeader *old_ptr = TryClaimForDequeue(old_pos);
+			if (old_ptr) {
+				ReleaseForDequeue(old_ptr, old_pos);
+				drop_count_.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		else {
+			if (!blocked_flag) {
+				blocked_flag = true;
+				block_count_.fetch_add(1, std::memory_order_relaxed);
+			}
+			if (stop_flag_.load(std::memory_order_relaxed))
+				throw std::logic_error("The publish queue was stopped while "
+					"waiting to enqueue a message.");
+			Backoff(wait_count);
+		}
+	}
+
+	char *subject_ptr = reinterpret_cast<char *>(slot_ptr + 1);
+
+	if (subject_name) {
+		::memcpy(subject_ptr, subject_name, subject_name_length);
+		subject_ptr[subject_name_length] = '\0';
+	}
+
+	if (data_length)
+		::memcpy(subject_ptr + subject_name_length + 1, data_ptr, data_length);
+
+	slot_ptr->interned_ptr_   = interned_ptr;
+	slot_ptr->subject_length_ = static_cast<uint32_t>(subject_name_length);
+	slot_ptr->data_length_    = static_cast<uint32_t>(data_length);
+
+	ReleaseForEnqueue(slot_ptr, slot_pos);
+
+	enqueue_count_.fetch_add(1, std::memory_order_relaxed);
+
+	WakePublisher();
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Enqueue(const std::string_view &subject_name,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(Enqueue(subject_name.data(), subject_name.size(), data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Enqueue(const std::string &subject_name,
+	const void *data_ptr, std::size_t data_length)
+{
+	return(Enqueue(subject_name.data(), subject_name.size(), data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Enqueue(const char *subject_name, const void *data_ptr,
+	std::size_t data_length)
+{
+	MLB::Utility::ThrowIfNull(subject_name,
+		"The subject name on which to publish");
+
+	return(Enqueue(subject_name, ::strlen(subject_name), data_ptr,
+		data_length));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::Flush(std::chrono::microseconds time_out)
+{
+	uint64_t target_count = enqueue_pos_.load(std::memory_order_acquire);
+	auto     end_time     = std::chrono::steady_clock::now() + time_out;
+	unsigned wait_count   = 0;
+
+	while (release_count_.load(std::memory_order_acquire) < target_count) {
+		if (std::chrono::steady_clock::now() >= end_time)
+			return(false);
+		Backoff(wait_count);
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPublishQueue::Stop()
+{
+	{
+		std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+		stop_flag_.store(true, std::memory_order_release);
+		wake_cv_.notify_one();
+	}
+
+	if (publish_thread_.joinable())
+		publish_thread_.join();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const NatsPublishQueueParams &NatsPublishQueue::GetParams() const
+{
+	return(params_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsPublishQueue::GetCapacity() const
+{
+	return(params_.queue_capacity_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsPublishQueue::GetApproximateCount() const
+{
+	uint64_t dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+	uint64_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+	return((enqueue_pos > dequeue_pos) ?
+		static_cast<std::size_t>(enqueue_pos - dequeue_pos) : 0);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueueStats NatsPublishQueue::GetStats() const
+{
+	NatsPublishQueueStats stats;
+
+	stats.enqueue_count_ = enqueue_count_.load(std::memory_order_relaxed);
+	stats.publish_count_ = publish_count_.load(std::memory_order_relaxed);
+	stats.drop_count_    = drop_count_.load(std::memory_order_relaxed);
+	stats.block_count_   = block_count_.load(std::memory_order_relaxed);
+	stats.batch_count_   = batch_count_.load(std::memory_order_relaxed);
+	stats.error_count_   = error_count_.load(std::memory_order_relaxed);
+	stats.last_error_    =
+		static_cast<natsStatus>(last_error_.load(std::memory_order_relaxed));
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueue::SlotHeader *NatsPublishQueue::GetSlot(uint64_t slot_pos) const
+{
+	return(reinterpret_cast<SlotHeader *>(slot_base_ptr_ +
+		((slot_pos & slot_mask_) * slot_stride_)));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The queue is a bounded multi-producer, multi-consumer ring in which the
+	sequence number of each slot indicates whether the slot is free for the
+	enqueue at that position or holds the message for the dequeue at that
+	position. Consumers are the publishing thread and, under the DropOldest
+	policy, producers which find the queue full.
+*/
+NatsPublishQueue::SlotHeader *NatsPublishQueue::TryClaimForEnqueue(
+	uint64_t &slot_pos)
+{
+	slot_pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+	for ( ; ; ) {
+		SlotHeader *slot_ptr = GetSlot(slot_pos);
+		uint64_t    sequence = slot_ptr->sequence_.load(std::memory_order_acquire);
+		int64_t     diff     = static_cast<int64_t>(sequence - slot_pos);
+		if (!diff) {
+			if (enqueue_pos_.compare_exchange_weak(slot_pos, slot_pos + 1,
+				std::memory_order_relaxed))
+				return(slot_ptr);
+		}
+		else if (diff < 0)
+			return(nullptr);
+		else
+			slot_pos = enqueue_pos_.load(std::memory_order_relaxed);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsPublishQueue::SlotHeader *NatsPublishQueue::TryClaimForDequeue(
+	uint64_t &slot_pos)
+{
+	slot_pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+	for ( ; ; ) {
+		SlotHeader *slot_ptr = GetSlot(slot_pos);
+		uint64_t    sequence = slot_ptr->sequence_.load(std::memory_order_acquire);
+		int64_t     diff     = static_cast<int64_t>(sequence - (slot_pos + 1));
+		if (!diff) {
+			if (dequeue_pos_.compare_exchange_weak(slot_pos, slot_pos + 1,
+				std::memory_order_relaxed))
+				return(slot_ptr);
+		}
+		else if (diff < 0)
+			return(nullptr);
+		else
+			slot_pos = dequeue_pos_.load(std::memory_order_relaxed);
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPublishQueue::ReleaseForEnqueue(SlotHeader *slot_ptr,
+	uint64_t slot_pos)
+{
+	slot_ptr->sequence_.store(slot_pos + 1, std::memory_order_release);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPublishQueue::ReleaseForDequeue(SlotHeader *slot_ptr,
+	uint64_t slot_pos)
+{
+	slot_ptr->sequence_.store(slot_pos + params_.queue_capacity_,
+		std::memory_order_release);
+
+	release_count_.fetch_add(1, std::memory_order_release);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::IsEmpty() const
+{
+	uint64_t slot_pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+	return(GetSlot(slot_pos)->sequence_.load(std::memory_order_acquire) !=
+		(slot_pos + 1));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The fence here pairs with the one in WaitForMessages(): either the
+	producer sees that the publishing thread is about to sleep, or the
+	publishing thread sees the message which the producer just released.
+*/
+void NatsPublishQueue::WakePublisher()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (sleeping_flag_.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> wake_lock(wake_mutex_);
+		wake_cv_.notify_one();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsPublishQueue::WaitForMessages()
+{
+	unsigned wait_count = 0;
+
+	for ( ; ; ) {
+		if (!IsEmpty())
+			return(true);
+		if (stop_flag_.load(std::memory_order_acquire))
+			return(!IsEmpty());
+		if (wait_count < NatsPublishQueue_SpinCount) {
+			++wait_count;
+			std::this_thread::yield();
+			continue;
+		}
+		std::unique_lock<std::mutex> wake_lock(wake_mutex_);
+		sleeping_flag_.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (IsEmpty() && (!stop_flag_.load(std::memory_order_relaxed)))
+			wake_cv_.wait(wake_lock);
+		sleeping_flag_.store(false, std::memory_order_relaxed);
+		wait_count = 0;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPublishQueue::PublishBatch()
+{
+	if ((params_.latency_budget_.count() > 0) &&
+		(GetApproximateCount() < params_.max_batch_count_)) {
+		auto end_time = std::chrono::steady_clock::now() +
+			params_.latency_budget_;
+		while ((GetApproximateCount() < params_.max_batch_count_) &&
+			(!stop_flag_.load(std::memory_order_relaxed)) &&
+			(std::chrono::steady_clock::now() < end_time))
+			std::this_thread::yield();
+	}
+
+	std::size_t batch_count = 0;
+
+	while (batch_count < params_.max_batch_count_) {
+		uint64_t    slot_pos;
+		SlotHeader *slot_ptr = TryClaimForDequeue(slot_pos);
+		if (!slot_ptr)
+			break;
+		const char *subject_ptr = reinterpret_cast<const char *>(slot_ptr + 1);
+		natsStatus  nats_code;
+		try {
+			nats_code = publish_func_((slot_ptr->interned_ptr_) ?
+				slot_ptr->interned_ptr_ : subject_ptr,
+				subject_ptr + slot_ptr->subject_length_ + 1,
+				static_cast<int>(slot_ptr->data_length_));
+		}
+		catch (const std::exception &) {
+			nats_code = NATS_ERR;
+		}
+		ReleaseForDequeue(slot_ptr, slot_pos);
+		if (nats_code == NATS_OK)
+			publish_count_.fetch_add(1, std::memory_order_relaxed);
+		else {
+			error_count_.fetch_add(1, std::memory_order_relaxed);
+			last_error_.store(nats_code, std::memory_order_relaxed);
+		}
+		++batch_count;
+	}
+
+	if (batch_count)
+		batch_count_.fetch_add(1, std::memory_order_relaxed);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsPublishQueue::PublishThread()
+{
+	while (WaitForMessages())
+		PublishBatch();
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsPublishQueueStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <iostream>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::size_t TEST_ProducerCount    = 4;
+const uint64_t    TEST_ProducerMsgCount = 250000;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Publishes through a function which checks that the messages of each
+	producer arrive in order and complete. Half of the producers enqueue
+	with interned subjects.
+*/
+void TEST_OrderedBlocking()
+{
+	std::vector<uint64_t> next_list(TEST_ProducerCount, 0);
+	bool                  order_error = false;
+	NatsPublishQueueParams params;
+
+	params.queue_capacity_ = 1024;
+	params.policy_         = NatsPublishQueuePolicy::Block;
+
+	NatsPublishQueue publish_queue(
+		[&next_list, &order_error](const char *subject_name,
+		const void *data_ptr, int data_length) {
+		std::size_t producer_index =
+			static_cast<std::size_t>(subject_name[::strlen(subject_name) - 1] -
+			'0');
+		uint64_t    msg_index;
+		if ((data_length != sizeof(msg_index)) ||
+			(producer_index >= next_list.size()))
+			order_error = true;
+		else {
+			::memcpy(&msg_index, data_ptr, sizeof(msg_index));
+			if (msg_index != next_list[producer_index]++)
+				order_error = true;
+		}
+		return(NATS_OK);
+	}, params);
+
+	NatsSubjectPool          subject_pool;
+	std::vector<std::thread> producer_list;
+	auto                     start_time = std::chrono::steady_clock::now();
+
+	for (std::size_t producer_index = 0; producer_index < TEST_ProducerCount;
+		++producer_index)
+		producer_list.emplace_back([&publish_queue, &subject_pool,
+			producer_index]() {
+			std::string        subject_name("TEST.Producer." +
+				std::to_string(producer_index));
+			const NatsSubject &subject = subject_pool.Intern(subject_name);
+			for (uint64_t msg_index = 0; msg_index < TEST_ProducerMsgCount;
+				++msg_index) {
+				if (producer_index % 2)
+					publish_queue.Enqueue(subject, &msg_index, sizeof(msg_index));
+				else
+					publish_queue.Enqueue(subject_name, &msg_index,
+						sizeof(msg_index));
+			}
+		});
+
+	for (auto &this_thread : producer_list)
+		this_thread.join();
+
+	if (!publish_queue.Flush(std::chrono::seconds(30)))
+		throw std::logic_error("Flush() of the publish queue timed out.");
+
+	auto elapsed_usecs = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+
+	NatsPublishQueueStats stats(publish_queue.GetStats());
+
+	std::cout << "Ordered blocking: " << stats << " in " << elapsed_usecs <<
+		" microseconds" << std::endl;
+
+	if (order_error)
+		throw std::logic_error("Messages of a producer were published out of "
+			"order.");
+
+	for (const auto &this_next : next_list) {
+		if (this_next != TEST_ProducerMsgCount)
+			throw std::logic_error("Not all messages of a producer were "
+				"published.");
+	}
+
+	if ((stats.enqueue_count_ != (TEST_ProducerCount * TEST_ProducerMsgCount))
+		|| (stats.publish_count_ != stats.enqueue_count_) ||
+		stats.drop_count_ || stats.error_count_)
+		throw std::logic_error("The publish queue statistics are incorrect.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The publish function holds the first message until all messages have been
+	enqueued, so that the queue fills and the policy applies.
+*/
+void TEST_DropPolicy(NatsPublishQueuePolicy policy)
+{
+	const uint64_t        msg_count = 1000;
+	std::atomic<bool>     gate_flag(false);
+	std::vector<uint64_t> published_list;
+	NatsPublishQueueParams params;
+
+	params.queue_capacity_ = 64;
+	params.policy_         = policy;
+
+	NatsPublishQueue publish_queue(
+		[&gate_flag, &published_list](const char *, const void *data_ptr,
+		int) {
+		while (!gate_flag.load())
+			std::this_thread::yield();
+		uint64_t msg_index;
+		::memcpy(&msg_index, data_ptr, sizeof(msg_index));
+		published_list.push_back(msg_index);
+		return((msg_index == 999) ? NATS_TIMEOUT : NATS_OK);
+	}, params);
+
+	uint64_t accepted_count = 0;
+
+	for (uint64_t msg_index = 0; msg_index < msg_count; ++msg_index)
+		accepted_count +=
+			(publish_queue.Enqueue("TEST.Drop", &msg_index, sizeof(msg_index))) ?
+			1 : 0;
+
+	gate_flag.store(true);
+
+	if (!publish_queue.Flush(std::chrono::seconds(10)))
+		throw std::logic_error("Flush() of the publish queue timed out.");
+
+	NatsPublishQueueStats stats(publish_queue.GetStats());
+
+	std::cout << ((policy == NatsPublishQueuePolicy::DropNewest) ?
+		"DropNewest" : "DropOldest") << ": " << stats << std::endl;
+
+	if (((stats.publish_count_ + stats.error_count_ + stats.drop_count_) !=
+		msg_count) || (published_list.size() > publish_queue.GetCapacity()) ||
+		(stats.drop_count_ < (msg_count - publish_queue.GetCapacity())))
+		throw std::logic_error("The publish queue counts are inconsistent.");
+
+	for (std::size_t msg_index = 1; msg_index < published_list.size();
+		++msg_index) {
+		if (published_list[msg_index] <= published_list[msg_index - 1])
+			throw std::logic_error("Messages were published out of order.");
+	}
+
+	if (policy == NatsPublishQueuePolicy::DropNewest) {
+		if (accepted_count != published_list.size())
+			throw std::logic_error("Enqueue() reported an incorrect number of "
+				"accepted messages.");
+	}
+	else if ((accepted_count != msg_count) ||
+		(published_list.back() != (msg_count - 1)) ||
+		(stats.error_count_ != 1) || (stats.last_error_ != NATS_TIMEOUT))
+		throw std::logic_error("DropOldest didn't retain the newest messages.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Coalescing()
+{
+	std::atomic<uint64_t>  publish_count(0);
+	NatsPublishQueueParams params;
+
+	params.latency_budget_  = std::chrono::milliseconds(20);
+	params.max_batch_count_ = 100;
+
+	NatsPublishQueue publish_queue(
+		[&publish_count](const char *, const void *, int) {
+		++publish_count;
+		return(NATS_OK);
+	}, params);
+
+	for (int msg_index = 0; msg_index < 1000; ++msg_index)
+		publish_queue.Enqueue("TEST.Coalesce", &msg_index, sizeof(msg_index));
+
+	publish_queue.Stop();
+
+	NatsPublishQueueStats stats(publish_queue.GetStats());
+
+	std::cout << "Coalescing: " << stats << std::endl;
+
+	if ((publish_count != 1000) || (stats.batch_count_ < 10))
+		throw std::logic_error("The coalesced batches are incorrect.");
+
+	bool rejected_flag = false;
+
+	try {
+		publish_queue.Enqueue("TEST.Coalesce", "X", 1);
+	}
+	catch (const std::exception &) {
+		rejected_flag = true;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("Enqueue() on a stopped queue was accepted.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_RejectOversized()
+{
+	NatsPublishQueueParams params;
+
+	params.max_payload_length_ = 16;
+
+	NatsPublishQueue  publish_queue([](const char *, const void *, int) {
+		return(NATS_OK); }, params);
+	std::vector<char> payload(17, 'X');
+	bool              rejected_flag = false;
+
+	try {
+		publish_queue.Enqueue("TEST.Big", payload.data(), payload.size());
+	}
+	catch (const std::exception &except) {
+		rejected_flag = true;
+		std::cout << "Oversized payload rejected: " << except.what() <<
+			std::endl;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("An oversized payload was accepted.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_OrderedBlocking();
+		TEST_DropPolicy(NatsPublishQueuePolicy::DropNewest);
+		TEST_DropPolicy(NatsPublishQueuePolicy::DropOldest);
+		TEST_Coalescing();
+		TEST_RejectOversized();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
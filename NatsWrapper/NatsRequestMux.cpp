@@ -0,0 +1,620 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsRequestMux.cpp
+
+   File Description  :  Implementation of the NatsRequestMux class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsRequestMux.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <charconv>
+#include <string_view>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestMuxStats::NatsRequestMuxStats()
+	:request_count_(0)
+	,reply_count_(0)
+	,timeout_count_(0)
+	,unmatched_count_(0)
+	,pending_count_(0)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream &NatsRequestMuxStats::ToStream(std::ostream &o_str) const
+{
+	o_str
+		<< "Requests=" << request_count_
+		<< ", Replies=" << reply_count_
+		<< ", Timeouts=" << timeout_count_
+		<< ", Unmatched=" << unmatched_count_
+		<< ", Pending=" << pending_count_;
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestMux::NatsRequestMux(NatsConnection &nats_conn,
+	std::chrono::milliseconds default_time_out)
+	:nats_conn_(nats_conn)
+	,default_time_out_((default_time_out.count() > 0) ? default_time_out :
+		DefaultTimeOut)
+	,nats_inbox_()
+	,inbox_prefix_(nats_inbox_.GetInboxAsString() + ".")
+	,request_mutex_()
+	,timer_cv_()
+	,pending_map_()
+	,timer_heap_()
+	,next_token_(1)
+	,stop_flag_(false)
+	,request_count_(0)
+	,reply_count_(0)
+	,timeout_count_(0)
+	,unmatched_count_(0)
+	,timer_thread_()
+	,nats_subs_(nats_conn.Subscribe(inbox_prefix_ + "*",
+		NatsRequestMux::NatsMsgHandler, this))
+{
+	timer_thread_ = std::thread(&NatsRequestMux::TimerThread, this);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestMux::~NatsRequestMux()
+{
+	/*
+		Once the drain completes the delivery thread can no longer invoke the
+		handler with this instance. If it can't be started (for example, if
+		the connection was closed) no further messages will be delivered.
+	*/
+	if (nats_subs_.Drain() != NATS_OK)
+		nats_subs_.Unsubscribe();
+
+	std::unordered_map<uint64_t, NatsRequestDoneFunc> pending_map;
+
+	{
+		std::lock_guard<std::mutex> request_lock(request_mutex_);
+		stop_flag_ = true;
+		pending_map.swap(pending_map_);
+	}
+
+	timer_cv_.notify_one();
+
+	if (timer_thread_.joinable())
+		timer_thread_.join();
+
+	for (auto &pending : pending_map) {
+		NatsMsg nats_msg;
+		try {
+			pending.second(NATS_CONNECTION_CLOSED, nats_msg);
+		}
+		catch (const std::exception &) {
+		}
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsRequestMux::AsyncRequest(const char *subject_name,
+	const void *data_ptr, std::size_t data_length,
+	const NatsRequestDoneFunc &done_func, std::chrono::milliseconds time_out)
+{
+	MLB::Utility::ThrowIfNull(subject_name, "The request subject name");
+
+	if (!done_func)
+		throw std::invalid_argument("The request completion function is "
+			"empty.");
+
+	if (time_out.count() <= 0)
+		time_out = default_time_out_;
+
+	Clock::time_point deadline = Clock::now() + time_out;
+	uint64_t          token;
+	bool              notify_flag;
+
+	{
+		std::lock_guard<std::mutex> request_lock(request_mutex_);
+		if (stop_flag_)
+			throw std::logic_error("Attempt to issue a request on a request "
+				"multiplexer which is being destroyed.");
+		token = next_token_++;
+		pending_map_.emplace(token, done_func);
+		notify_flag = timer_heap_.empty() || (deadline < timer_heap_.top().first);
+		timer_heap_.emplace(deadline, token);
+		++request_count_;
+	}
+
+	// Only a deadline earlier than the one awaited need wake the timer.
+	if (notify_flag)
+		timer_cv_.notify_one();
+
+	char        token_buffer[24];
+	std::string reply_subject;
+
+	reply_subject.reserve(inbox_prefix_.size() + sizeof(token_buffer));
+	reply_subject.assign(inbox_prefix_);
+	reply_subject.append(token_buffer,
+		std::to_chars(token_buffer, token_buffer + sizeof(token_buffer),
+		token).ptr);
+
+	try {
+		nats_conn_.PublishRequest(subject_name, reply_subject.c_str(),
+			data_ptr, data_length);
+	}
+	catch (const std::exception &) {
+		bool owned_flag;
+		{
+			std::lock_guard<std::mutex> request_lock(request_mutex_);
+			owned_flag = pending_map_.erase(token) > 0;
+		}
+		// Otherwise the request has already been completed.
+		if (owned_flag)
+			throw;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsRequestMux::AsyncRequest(const std::string &subject_name,
+	const void *data_ptr, std::size_t data_length,
+	const NatsRequestDoneFunc &done_func, std::chrono::milliseconds time_out)
+{
+	AsyncRequest(subject_name.c_str(), data_ptr, data_length, done_func,
+		time_out);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::future<NatsMsg> NatsRequestMux::Request(const char *subject_name,
+	const void *data_ptr, std::size_t data_length,
+	std::chrono::milliseconds time_out)
+{
+	auto                 promise_sptr(std::make_shared<std::promise<NatsMsg>>());
+	std::future<NatsMsg> reply_future(promise_sptr->get_future());
+
+	AsyncRequest(subject_name, data_ptr, data_length,
+		[promise_sptr](natsStatus nats_status, NatsMsg &nats_msg) {
+			if (nats_status == NATS_OK)
+				promise_sptr->set_value(std::move(nats_msg));
+			else
+				promise_sptr->set_exception(std::make_exception_ptr(
+					NatsExceptionStatus(nats_status, "NatsRequestMux::Request")));
+		}, time_out);
+
+	return(reply_future);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::future<NatsMsg> NatsRequestMux::Request(const std::string &subject_name,
+	const void *data_ptr, std::size_t data_length,
+	std::chrono::milliseconds time_out)
+{
+	return(Request(subject_name.c_str(), data_ptr, data_length, time_out));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef NatsWrapper_HAS_COROUTINES
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestAwaitable NatsRequestMux::AwaitRequest(const char *subject_name,
+	const void *data_ptr, std::size_t data_length,
+	std::chrono::milliseconds time_out)
+{
+	return(NatsRequestAwaitable(*this, subject_name, data_ptr, data_length,
+		time_out));
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &NatsRequestMux::GetInboxPrefix() const
+{
+	return(inbox_prefix_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsRequestMux::GetPendingCount() const
+{
+	std::lock_guard<std::mutex> request_lock(request_mutex_);
+
+	return(pending_map_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestMuxStats NatsRequestMux::GetStats() const
+{
+	std::lock_guard<std::mutex> request_lock(request_mutex_);
+	NatsRequestMuxStats         stats;
+
+	stats.request_count_   = request_count_;
+	stats.reply_count_     = reply_count_;
+	stats.timeout_count_   = timeout_count_;
+	stats.unmatched_count_ = unmatched_count_;
+	stats.pending_count_   = pending_map_.size();
+
+	return(stats);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsRequestMux::NatsMsgHandler(natsConnection * /* nats_conn_ptr */,
+	natsSubscription * /* nats_subs_ptr */, natsMsg *nats_msg_ptr,
+	void *closure_ptr)
+{
+	NatsMsg nats_msg(nats_msg_ptr);
+
+	if ((!closure_ptr) || (!nats_msg_ptr))
+		return;
+
+	// Exceptions mustn't propagate into the NATS library.
+	try {
+		static_cast<NatsRequestMux *>(closure_ptr)->HandleReply(nats_msg);
+	}
+	catch (const std::exception &) {
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void NatsRequestMux::HandleReply(NatsMsg &nats_msg)
+{
+	std::string_view subject_name(nats_msg.GetSubjectView());
+	uint64_t         token = 0;
+	bool             token_flag = false;
+
+	if ((subject_name.size() > inbox_prefix_.size()) &&
+		(subject_name.compare(0, inbox_prefix_.size(), inbox_prefix_) == 0)) {
+		const char *end_ptr = subject_name.data() + subject_name.size();
+		auto        result  = std::from_chars(subject_name.data() +
+			inbox_prefix_.size(), end_ptr, token);
+		token_flag = (result.ec == std::errc()) && (result.ptr == end_ptr);
+	}
+
+	NatsRequestDoneFunc done_func;
+
+	{
+		std::lock_guard<std::mutex> request_lock(request_mutex_);
+		auto iter_f = token_flag ? pending_map_.find(token) :
+			pending_map_.end();
+		// Late replies to requests which have timed out are also unmatched.
+		if (iter_f == pending_map_.end()) {
+			++unmatched_count_;
+			return;
+		}
+		done_func = std::move(iter_f->second);
+		pending_map_.erase(iter_f);
+		++reply_count_;
+	}
+
+	if (nats_msg.IsNoResponders()) {
+		nats_msg.Reset();
+		done_func(NATS_NO_RESPONDERS, nats_msg);
+	}
+	else
+		done_func(NATS_OK, nats_msg);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	Deadlines remain in the heap after their requests complete and are
+	discarded when they expire, which avoids a search of the heap for each
+	reply.
+*/
+void NatsRequestMux::TimerThread()
+{
+	std::vector<NatsRequestDoneFunc> expired_list;
+	std::unique_lock<std::mutex>     request_lock(request_mutex_);
+
+	while (!stop_flag_) {
+		if (timer_heap_.empty()) {
+			timer_cv_.wait(request_lock);
+			continue;
+		}
+		Clock::time_point now_time = Clock::now();
+		if (now_time < timer_heap_.top().first) {
+			timer_cv_.wait_until(request_lock, timer_heap_.top().first);
+			continue;
+		}
+		while ((!timer_heap_.empty()) &&
+			(timer_heap_.top().first <= now_time)) {
+			auto iter_f = pending_map_.find(timer_heap_.top().second);
+			if (iter_f != pending_map_.end()) {
+				expired_list.push_back(std::move(iter_f->second));
+				pending_map_.erase(iter_f);
+				++timeout_count_;
+			}
+			timer_heap_.pop();
+		}
+		if (expired_list.empty())
+			continue;
+		request_lock.unlock();
+		for (auto &done_func : expired_list) {
+			NatsMsg nats_msg;
+			try {
+				done_func(NATS_TIMEOUT, nats_msg);
+			}
+			catch (const std::exception &) {
+			}
+		}
+		expired_list.clear();
+		request_lock.lock();
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef NatsWrapper_HAS_COROUTINES
+// ////////////////////////////////////////////////////////////////////////////
+NatsRequestAwaitable::NatsRequestAwaitable(NatsRequestMux &request_mux,
+	const char *subject_name, const void *data_ptr, std::size_t data_length,
+	std::chrono::milliseconds time_out)
+	:request_mux_ptr_(&request_mux)
+	,subject_name_(subject_name)
+	,data_ptr_(data_ptr)
+	,data_length_(data_length)
+	,time_out_(time_out)
+	,nats_status_(NATS_OK)
+	,nats_msg_()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsRequestAwaitable::await_ready() const noexcept
+{
+	return(false);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/*
+	The reply may resume the coroutine on another thread before
+	AsyncRequest() returns, so this object mustn't be used after the call.
+*/
+void NatsRequestAwaitable::await_suspend(std::coroutine_handle<> coro_handle)
+{
+	request_mux_ptr_->AsyncRequest(subject_name_, data_ptr_, data_length_,
+		[this, coro_handle](natsStatus nats_status, NatsMsg &nats_msg) {
+			nats_status_ = nats_status;
+			nats_msg_    = std::move(nats_msg);
+			coro_handle.resume();
+		}, time_out_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsMsg NatsRequestAwaitable::await_resume()
+{
+	if (nats_status_ != NATS_OK)
+		throw NatsExceptionStatus(nats_status_, "NatsRequestMux::AwaitRequest");
+
+	return(std::move(nats_msg_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsRequestMuxStats &datum)
+{
+	return(datum.ToStream(o_str));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <NatsWrapper/NatsContext.hpp>
+
+#include <cstring>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *TEST_EchoSubject   = "TEST.RequestMux.Echo";
+const char *TEST_SilentSubject = "TEST.RequestMux.Silent";
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_EchoHandler(natsConnection *nats_conn_ptr,
+	natsSubscription * /* nats_subs_ptr */, natsMsg *nats_msg_ptr,
+	void * /* closure_ptr */)
+{
+	NatsMsg nats_msg(nats_msg_ptr);
+
+	if (nats_msg.GetReply())
+		::natsConnection_Publish(nats_conn_ptr, nats_msg.GetReply(),
+			nats_msg.GetData(), nats_msg.GetDataLength());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t TEST_GetIndex(const NatsMsg &nats_msg)
+{
+	std::size_t msg_index;
+
+	if (static_cast<std::size_t>(nats_msg.GetDataLength()) !=
+		sizeof(msg_index))
+		throw std::logic_error("A reply has an incorrect length.");
+
+	::memcpy(&msg_index, nats_msg.GetData(), sizeof(msg_index));
+
+	return(msg_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Futures(NatsRequestMux &request_mux)
+{
+	const std::size_t                 request_count = 1000;
+	std::vector<std::size_t>          index_list(request_count);
+	std::vector<std::future<NatsMsg>> future_list;
+
+	for (std::size_t msg_index = 0; msg_index < request_count; ++msg_index) {
+		index_list[msg_index] = msg_index;
+		future_list.push_back(request_mux.Request(TEST_EchoSubject,
+			&index_list[msg_index], sizeof(index_list[msg_index])));
+	}
+
+	for (std::size_t msg_index = 0; msg_index < request_count; ++msg_index) {
+		if (TEST_GetIndex(future_list[msg_index].get()) != msg_index)
+			throw std::logic_error("A reply was matched to the wrong request.");
+	}
+
+	std::cout << "Futures: " << request_mux.GetStats() << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_TimeOut(NatsRequestMux &request_mux)
+{
+	auto reply_future = request_mux.Request(TEST_SilentSubject, "", 0,
+		std::chrono::milliseconds(100));
+
+	try {
+		reply_future.get();
+	}
+	catch (const NatsExceptionStatus &except) {
+		std::cout << "Request without a responder: " << except.what() <<
+			std::endl;
+		return;
+	}
+
+	throw std::logic_error("A request without a responder succeeded.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef NatsWrapper_HAS_COROUTINES
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_Task
+{
+	struct promise_type
+	{
+		TEST_Task           get_return_object() { return(TEST_Task()); }
+		std::suspend_never  initial_suspend() noexcept
+			{ return(std::suspend_never()); }
+		std::suspend_never  final_suspend() noexcept
+			{ return(std::suspend_never()); }
+		void                return_void() { }
+		void                unhandled_exception() { std::terminate(); }
+	};
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+TEST_Task TEST_CoroutineRequests(NatsRequestMux &request_mux,
+	std::size_t request_count, std::promise<std::size_t> &done_promise)
+{
+	std::size_t matched_count = 0;
+
+	for (std::size_t msg_index = 0; msg_index < request_count; ++msg_index) {
+		try {
+			NatsMsg nats_msg(co_await request_mux.AwaitRequest(TEST_EchoSubject,
+				&msg_index, sizeof(msg_index)));
+			matched_count += (TEST_GetIndex(nats_msg) == msg_index) ? 1 : 0;
+		}
+		catch (const std::exception &) {
+		}
+	}
+
+	try {
+		co_await request_mux.AwaitRequest(TEST_SilentSubject, "", 0,
+			std::chrono::milliseconds(100));
+	}
+	catch (const NatsExceptionStatus &) {
+		++matched_count;
+	}
+
+	done_promise.set_value(matched_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Coroutines(NatsRequestMux &request_mux)
+{
+	const std::size_t         request_count = 100;
+	std::promise<std::size_t> done_promise;
+	auto                      done_future(done_promise.get_future());
+
+	TEST_CoroutineRequests(request_mux, request_count, done_promise);
+
+	if (done_future.get() != (request_count + 1))
+		throw std::logic_error("Awaited requests did not complete correctly.");
+
+	std::cout << "Coroutines: " << request_mux.GetStats() << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		NatsContext      nats_context;
+		NatsOptions      nats_options;
+		NatsConnection   nats_connection(nats_options);
+		NatsSubscription echo_subs(nats_connection.Subscribe(TEST_EchoSubject,
+			TEST_EchoHandler, nullptr));
+		NatsRequestMux   request_mux(nats_connection);
+		TEST_Futures(request_mux);
+		TEST_TimeOut(request_mux);
+#ifdef NatsWrapper_HAS_COROUTINES
+		TEST_Coroutines(request_mux);
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
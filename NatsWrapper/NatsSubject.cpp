@@ -0,0 +1,495 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Module File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsSubject.cpp
+
+   File Description  :  Implementation of the NatsSubject class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsSubject.hpp>
+
+#include <Utility/ArgCheck.hpp>
+
+#include <cstring>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+bool IsWildcardToken(const std::string_view &token)
+{
+	return((token.size() == 1) && ((token[0] == '*') || (token[0] == '>')));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &CheckNatsSubject(const std::string &subject_name,
+	bool wildcard_flag)
+{
+	if (!IsValidNatsSubject(subject_name, wildcard_flag))
+		throw std::invalid_argument("The string '" + subject_name + "' is not "
+			"a valid NATS subject" + ((wildcard_flag) ? "" :
+			" on which data may be published") + ".");
+
+	return(subject_name);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool HasWildcardToken(const std::string_view &subject_name)
+{
+	std::size_t token_begin = 0;
+
+	for ( ; ; ) {
+		std::size_t token_end = subject_name.find('.', token_begin);
+		if (IsWildcardToken(subject_name.substr(token_begin,
+			(token_end == std::string_view::npos) ? std::string_view::npos :
+			(token_end - token_begin))))
+			return(true);
+		if (token_end == std::string_view::npos)
+			return(false);
+		token_begin = token_end + 1;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+bool IsValidNatsSubject(const std::string_view &subject_name,
+	bool wildcard_flag)
+{
+	if (subject_name.empty())
+		return(false);
+
+	std::size_t token_begin = 0;
+
+	for (std::size_t char_index = 0; char_index <= subject_name.size();
+		++char_index) {
+		if ((char_index == subject_name.size()) ||
+			(subject_name[char_index] == '.')) {
+			std::string_view token(subject_name.substr(token_begin,
+				char_index - token_begin));
+			if (token.empty())
+				return(false);
+			if (token.find_first_of("*>") != std::string_view::npos) {
+				if ((!wildcard_flag) || (!IsWildcardToken(token)) ||
+					((token[0] == '>') && (char_index != subject_name.size())))
+					return(false);
+			}
+			token_begin = char_index + 1;
+		}
+		else if (static_cast<unsigned char>(subject_name[char_index]) <= ' ')
+			return(false);
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool IsNatsSubjectMatch(const std::string_view &subject_pattern,
+	const std::string_view &subject_name)
+{
+	std::size_t pattern_begin = 0;
+	std::size_t subject_begin = 0;
+
+	for ( ; ; ) {
+		std::size_t      pattern_end = subject_pattern.find('.', pattern_begin);
+		std::size_t      subject_end = subject_name.find('.', subject_begin);
+		std::string_view pattern_token(subject_pattern.substr(pattern_begin,
+			(pattern_end == std::string_view::npos) ? std::string_view::npos :
+			(pattern_end - pattern_begin)));
+		if (pattern_token == ">")
+			return(subject_begin < subject_name.size());
+		if ((pattern_token != "*") && (pattern_token !=
+			subject_name.substr(subject_begin,
+			(subject_end == std::string_view::npos) ? std::string_view::npos :
+			(subject_end - subject_begin))))
+			return(false);
+		if (pattern_end == std::string_view::npos)
+			return(subject_end == std::string_view::npos);
+		if (subject_end == std::string_view::npos)
+			return(false);
+		pattern_begin = pattern_end + 1;
+		subject_begin = subject_end + 1;
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsSubject::NatsSubject(const std::string_view &subject_name,
+	bool wildcard_flag)
+	:NatsSubject(std::string(subject_name), wildcard_flag)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsSubject::NatsSubject(const std::string &subject_name, bool wildcard_flag)
+	:subject_name_(CheckNatsSubject(subject_name, wildcard_flag))
+	,has_wildcard_(wildcard_flag && HasWildcardToken(subject_name_))
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsSubject::NatsSubject(const char *subject_name, bool wildcard_flag)
+	:NatsSubject(std::string(MLB::Utility::ThrowIfNull(subject_name,
+		"The subject name")), wildcard_flag)
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const char *NatsSubject::GetPtr() const
+{
+	return(subject_name_.c_str());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsSubject::GetLength() const
+{
+	return(subject_name_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::string_view NatsSubject::GetStringView() const
+{
+	return(std::string_view(subject_name_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const std::string &NatsSubject::GetString() const
+{
+	return(subject_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsSubject::HasWildcard() const
+{
+	return(has_wildcard_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsSubject::operator == (const NatsSubject &other) const
+{
+	return(subject_name_ == other.subject_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsSubject::operator != (const NatsSubject &other) const
+{
+	return(!(*this == other));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+bool NatsSubject::operator < (const NatsSubject &other) const
+{
+	return(subject_name_ < other.subject_name_);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+NatsSubjectPool::NatsSubjectPool()
+	:subject_mutex_()
+	,subject_map_()
+{
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const NatsSubject &NatsSubjectPool::Intern(
+	const std::string_view &subject_name)
+{
+	std::lock_guard<std::mutex> subject_lock(subject_mutex_);
+
+	auto iter_f(subject_map_.find(subject_name));
+
+	if (iter_f != subject_map_.end())
+		return(*iter_f->second);
+
+	std::unique_ptr<NatsSubject> subject_uptr(new NatsSubject(subject_name));
+	const NatsSubject           &subject = *subject_uptr;
+
+	// The key refers to the text owned by the interned subject.
+	subject_map_.emplace(subject.GetStringView(), std::move(subject_uptr));
+
+	return(subject);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const NatsSubject *NatsSubjectPool::Find(
+	const std::string_view &subject_name) const
+{
+	std::lock_guard<std::mutex> subject_lock(subject_mutex_);
+
+	auto iter_f(subject_map_.find(subject_name));
+
+	return((iter_f != subject_map_.end()) ? iter_f->second.get() : nullptr);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::size_t NatsSubjectPool::GetCount() const
+{
+	std::lock_guard<std::mutex> subject_lock(subject_mutex_);
+
+	return(subject_map_.size());
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const NatsSubject &ThrowIfWildcard(const NatsSubject &subject,
+	const char *name_string)
+{
+	if (subject.HasWildcard())
+		throw std::invalid_argument(std::string(name_string) + " ('" +
+			subject.GetString() + "') contains a wildcard token.");
+
+	return(subject);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str, const NatsSubject &datum)
+{
+	o_str << datum.GetString();
+
+	return(o_str);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+// ////////////////////////////////////////////////////////////////////////////
+// ****************************************************************************
+// ****************************************************************************
+// ****************************************************************************
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_MAIN
+
+#include <iostream>
+
+using namespace MLB::NatsWrapper;
+
+namespace {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_SubjectCase
+{
+	const char *subject_name_;
+	bool        valid_flag_;
+	bool        valid_wildcard_flag_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const TEST_SubjectCase TEST_SubjectCaseList[] =
+{
+	{ "MD",                 true,  true  },
+	{ "MD.NYSE.IBM",        true,  true  },
+	{ "_INBOX.abc123.1",    true,  true  },
+	{ "",                   false, false },
+	{ ".MD",                false, false },
+	{ "MD.",                false, false },
+	{ "MD..IBM",            false, false },
+	{ "MD.NY SE.IBM",       false, false },
+	{ "MD.\tIBM",           false, false },
+	{ "MD.*.IBM",           false, true  },
+	{ "MD.>",               false, true  },
+	{ ">",                  false, true  },
+	{ "MD.>.IBM",           false, false },
+	{ "MD.N*.IBM",          false, false },
+	{ "MD.NYSE.IBM>",       false, false }
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct TEST_MatchCase
+{
+	const char *subject_pattern_;
+	const char *subject_name_;
+	bool        match_flag_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const TEST_MatchCase TEST_MatchCaseList[] =
+{
+	{ "MD.NYSE.IBM",        "MD.NYSE.IBM",        true  },
+	{ "MD.NYSE.IBM",        "MD.NYSE.IB",         false },
+	{ "MD.NYSE.IBM",        "MD.NYSE.IBM.A",      false },
+	{ "MD.NYSE",            "MD.NYSE.IBM",        false },
+	{ "MD.*.IBM",           "MD.NYSE.IBM",        true  },
+	{ "MD.*.IBM",           "MD.NYSE.MSFT",       false },
+	{ "MD.*",               "MD.NYSE.IBM",        false },
+	{ "*.*.*",              "MD.NYSE.IBM",        true  },
+	{ "MD.>",               "MD.NYSE.IBM",        true  },
+	{ "MD.>",               "MD.NYSE",            true  },
+	{ "MD.>",               "MD",                 false },
+	{ ">",                  "MD",                 true  },
+	{ "MD.*.>",             "MD.NYSE",            false },
+	{ "MD.*.>",             "MD.NYSE.IBM.A",      true  },
+	{ "_INBOX.abc.*",       "_INBOX.abc.17",      true  },
+	{ "_INBOX.abc.*",       "_INBOX.abcd.17",     false }
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Validation()
+{
+	for (const auto &this_case : TEST_SubjectCaseList) {
+		if ((IsValidNatsSubject(this_case.subject_name_) !=
+			this_case.valid_flag_) ||
+			(IsValidNatsSubject(this_case.subject_name_, true) !=
+			this_case.valid_wildcard_flag_))
+			throw std::logic_error("Validation of the subject '" +
+				std::string(this_case.subject_name_) + "' is incorrect.");
+		bool constructed_flag = false;
+		try {
+			NatsSubject subject(this_case.subject_name_);
+			constructed_flag = true;
+			if ((subject.GetLength() != ::strlen(this_case.subject_name_)) ||
+				subject.HasWildcard())
+				throw std::logic_error("The subject '" + subject.GetString() +
+					"' has incorrect properties.");
+		}
+		catch (const std::invalid_argument &) {
+		}
+		if (constructed_flag != this_case.valid_flag_)
+			throw std::logic_error("Construction of the subject '" +
+				std::string(this_case.subject_name_) + "' is incorrect.");
+	}
+
+	if (!NatsSubject("MD.*.IBM", true).HasWildcard())
+		throw std::logic_error("A wildcard subject was not recognized.");
+
+	ThrowIfWildcard(NatsSubject("MD.NYSE.IBM", true), "The subject");
+
+	bool rejected_flag = false;
+
+	try {
+		ThrowIfWildcard(NatsSubject("MD.>", true), "The subject");
+	}
+	catch (const std::invalid_argument &) {
+		rejected_flag = true;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("A wildcard subject was not rejected.");
+
+	std::cout << "Subject validation: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Match()
+{
+	for (const auto &this_case : TEST_MatchCaseList) {
+		if (IsNatsSubjectMatch(this_case.subject_pattern_,
+			this_case.subject_name_) != this_case.match_flag_)
+			throw std::logic_error("Matching of the subject '" +
+				std::string(this_case.subject_name_) + "' to the pattern '" +
+				std::string(this_case.subject_pattern_) + "' is incorrect.");
+	}
+
+	std::cout << "Subject matching: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_Pool()
+{
+	NatsSubjectPool    subject_pool;
+	std::string        subject_name("MD.NYSE.IBM");
+	const NatsSubject &subject_1 = subject_pool.Intern(subject_name);
+
+	subject_name[8] = 'X';
+
+	const NatsSubject &subject_2 = subject_pool.Intern("MD.NYSE.XBM");
+	const NatsSubject &subject_3 = subject_pool.Intern("MD.NYSE.IBM");
+
+	for (int subject_index = 0; subject_index < 1000; ++subject_index)
+		subject_pool.Intern("MD.NYSE.S" + std::to_string(subject_index));
+
+	if ((&subject_1 != &subject_3) || (&subject_1 == &subject_2) ||
+		(subject_1.GetStringView() != "MD.NYSE.IBM") ||
+		(subject_pool.Find("MD.NYSE.XBM") != &subject_2) ||
+		subject_pool.Find("MD.NYSE.MSFT") ||
+		(subject_pool.GetCount() != 1002))
+		throw std::logic_error("The subject pool did not intern correctly.");
+
+	bool rejected_flag = false;
+
+	try {
+		subject_pool.Intern("MD.*");
+	}
+	catch (const std::exception &except) {
+		rejected_flag = true;
+		std::cout << "Invalid subject rejected: " << except.what() << std::endl;
+	}
+
+	if (!rejected_flag)
+		throw std::logic_error("The subject pool interned a wildcard subject.");
+
+	std::cout << "Subject pool: OK" << std::endl;
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // Anonymous namespace
+
+// ////////////////////////////////////////////////////////////////////////////
+int main()
+{
+	int return_code = EXIT_SUCCESS;
+
+	try {
+		TEST_Validation();
+		TEST_Match();
+		TEST_Pool();
+	}
+	catch (const std::exception &except) {
+		return_code = EXIT_FAILURE;
+		std::cerr << "\n\nERROR: " << except.what() << std::endl;
+	}
+
+	return(return_code);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef TEST_MAIN
+
@@ -30,6 +30,7 @@
 
 #include <Utility/ArgCheck.hpp>
 
+#include <algorithm>
 #include <cstring>
 
 // ////////////////////////////////////////////////////////////////////////////
@@ -146,6 +147,69 @@ NatsMsg NatsSubscription::NextMsg(int64_t time_out)
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+natsStatus NatsSubscription::NextMsgs(NatsMsg *msg_array,
+	std::size_t max_count, int64_t time_out, std::size_t &msg_count)
+{
+	msg_count = 0;
+
+	if (!max_count)
+		return(NATS_OK);
+	else if (!msg_array)
+		return(NATS_INVALID_ARG);
+
+	natsMsg    *nats_msg = NULL;
+	natsStatus  nats_status;
+
+	if ((nats_status = ::natsSubscription_NextMsg(&nats_msg, GetPtr(),
+		time_out)) != NATS_OK)
+		return(nats_status);
+
+	msg_array[msg_count++].Reset(nats_msg);
+
+	/*
+		The pending count bounds the loop so that messages which arrive while
+		it runs don't prolong it. Further messages are taken without waiting.
+	*/
+	int pending_msgs  = 0;
+	int pending_bytes = 0;
+
+	if ((msg_count < max_count) &&
+		(::natsSubscription_GetPending(GetPtr(), &pending_msgs,
+		&pending_bytes) == NATS_OK)) {
+		std::size_t end_count = msg_count +
+			std::min(max_count - msg_count,
+			static_cast<std::size_t>(std::max(pending_msgs, 0)));
+		while (msg_count < end_count) {
+			nats_msg = NULL;
+			if (::natsSubscription_NextMsg(&nats_msg, GetPtr(), 0) != NATS_OK)
+				break;
+			msg_array[msg_count++].Reset(nats_msg);
+		}
+	}
+
+	return(NATS_OK);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+natsStatus NatsSubscription::NextMsgs(std::vector<NatsMsg> &msg_list,
+	std::size_t max_count, int64_t time_out)
+{
+	std::size_t old_size  = msg_list.size();
+	std::size_t msg_count = 0;
+
+	msg_list.resize(old_size + max_count);
+
+	natsStatus nats_status = NextMsgs(msg_list.data() + old_size, max_count,
+		time_out, msg_count);
+
+	msg_list.resize(old_size + msg_count);
+
+	return(nats_status);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 void NatsSubscription::Unsubscribe()
 {
@@ -154,6 +218,22 @@ void NatsSubscription::Unsubscribe()
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+natsStatus NatsSubscription::Drain(int64_t time_out)
+{
+	if (!nats_subscription_sptr_)
+		return(NATS_INVALID_SUBSCRIPTION);
+
+	natsStatus nats_status = ::natsSubscription_Drain(GetPtr());
+
+	if (nats_status == NATS_OK)
+		nats_status =
+			::natsSubscription_WaitForDrainCompletion(GetPtr(), time_out);
+
+	return(nats_status);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 void NatsSubscription::NatsMsgHandler(natsConnection * /* nats_conn_ptr */,
 	natsSubscription * /* nats_subs_ptr */, natsMsg * /* nats_msg_ptr */)
@@ -221,6 +301,54 @@ void TEST_NatsSubscription(int argc, char **argv)
 }
 // ////////////////////////////////////////////////////////////////////////////
 
+// ////////////////////////////////////////////////////////////////////////////
+void TEST_NextMsgs()
+{
+	using namespace MLB::NatsWrapper;
+
+	const std::size_t    publish_count = 1000;
+	const std::size_t    batch_size    = 64;
+	NatsContext          nats_context;
+	NatsOptions          nats_options;
+	NatsConnection       nats_connection(nats_options);
+	NatsSubscription     nats_subs(nats_connection, "TEST.NextMsgs");
+	std::vector<NatsMsg> msg_list;
+	std::size_t          batch_count = 0;
+
+	for (std::size_t msg_index = 0; msg_index < publish_count; ++msg_index)
+		nats_connection.Publish("TEST.NextMsgs", &msg_index,
+			sizeof(msg_index));
+
+	nats_connection.FlushTimeout(1000);
+
+	natsStatus nats_status;
+
+	while ((nats_status = nats_subs.NextMsgs(msg_list, batch_size, 100)) ==
+		NATS_OK)
+		++batch_count;
+
+	if (nats_status != NATS_TIMEOUT)
+		throw NatsExceptionStatus(nats_status, "NatsSubscription::NextMsgs");
+
+	std::cout << "Received " << msg_list.size() << " of " << publish_count <<
+		" messages in " << batch_count << " batches." << std::endl;
+
+	if (msg_list.size() != publish_count)
+		throw std::logic_error("Not all published messages were received.");
+
+	for (std::size_t msg_index = 0; msg_index < msg_list.size(); ++msg_index) {
+		std::size_t received_index;
+		if (static_cast<std::size_t>(msg_list[msg_index].GetDataLength()) !=
+			sizeof(received_index))
+			throw std::logic_error("A received message has an incorrect length.");
+		::memcpy(&received_index, msg_list[msg_index].GetData(),
+			sizeof(received_index));
+		if (received_index != msg_index)
+			throw std::logic_error("Messages were received out of order.");
+	}
+}
+// ////////////////////////////////////////////////////////////////////////////
+
 } // Anonymous namespace
 
 // ////////////////////////////////////////////////////////////////////////////
@@ -230,6 +358,7 @@ int main(int argc, char **argv)
 
 	try {
 		TEST_NatsSubscription(argc, argv);
+		TEST_NextMsgs();
 	}
 	catch (const std::exception &except) {
 		return_code = EXIT_FAILURE;
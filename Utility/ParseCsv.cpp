@@ -179,7 +179,7 @@ std::size_t ParseCsvControl::GetValueEnd(const std::string_view &src_line,
 
 	while (current_offset <= last_offset) {
 		char this_char = src_line[current_offset];
-		if ((this_char == '"') || (this_char == '\'')) {
+		if (IsQuoteChar(this_char)) {
 			char        quote_char   = this_char;
 			bool        in_quote     = true;
 			std::size_t quote_offset = current_offset;
@@ -336,13 +336,18 @@ bool ParseCsvState::ParseCsvLine(const ParseCsvControl &parse_control,
 			at_end_flag_ = true;
 			break;
 		}
-		else if (!parse_control.IsLineSep(src_line_[end_idx]))
+		/*
+			With CR/LF enabled the value end is the carriage return, so the
+			line separator is found at the offset of the next value.
+		*/
+		else if ((next_idx <= end_idx) ||
+			(!parse_control.IsLineSep(src_line_[next_idx - 1])))
 			tmp_current_pos.row_off_ = end_idx + 1;
 		else {
 			tmp_current_pos.is_line_end_ = true;
 			++original_pos.row_idx_;
 			original_pos.col_idx_        = 0;
-			original_pos.row_off_        = end_idx + 1;
+			original_pos.row_off_        = next_idx;
 			original_pos.is_line_end_    = false;
 			break;
 		}
@@ -0,0 +1,83 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  Crc32c.hpp
+
+   File Description  :  Include file for the CRC-32C (Castagnoli) functions.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__Crc32c_hpp__HH
+
+#define HH__MLB__MFStore__Crc32c_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file Crc32c.hpp
+
+   \brief   Declarations of the CRC-32C (Castagnoli) functions.
+
+   The SSE 4.2 \c crc32 instruction is used when the processor supports it;
+   otherwise a slice-by-8 table implementation is used.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStore.hpp>
+
+#include <cstddef>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the CRC-32C of the \e data_length bytes at \e data_ptr. Passing
+	the result of a previous call as \e crc_value continues that CRC, so that
+	\code
+		Crc32c(b, b_len, Crc32c(a, a_len))
+	\endcode
+	is the CRC of \e a followed by \e b.
+*/
+uint32_t Crc32c(const void *data_ptr, std::size_t data_length,
+	uint32_t crc_value = 0);
+
+/**
+	Returns the CRC-32C of the concatenation of two blocks given the CRC of
+	each block and the length of the second. This permits blocks to be
+	checksummed independently (and in parallel) and the results combined.
+*/
+uint32_t Crc32cCombine(uint32_t crc_value_1, uint32_t crc_value_2,
+	uint64_t data_length_2);
+
+uint32_t Crc32cParallel(const void *data_ptr, uint64_t data_length,
+	unsigned int thread_count = 0);
+
+bool     Crc32cIsHardware();
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__Crc32c_hpp__HH
+
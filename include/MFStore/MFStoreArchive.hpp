@@ -0,0 +1,264 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreArchive.hpp
+
+   File Description  :  Include file for compressed MFStore archives.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreArchive_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreArchive_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreArchive.hpp
+
+   \brief   Definition of the MFStoreArchive class, which reads the sections
+            of an MFStore file archived in compressed blocks, and of the
+            ArchiveMFStore() function which creates such archives.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An archive consists of this header (padded to MFStoreArchiveHeaderLength
+	bytes), the stored blocks, the section directory and the block index. The
+	header is written last, so that an archive which wasn't completely written
+	has no magic number.
+*/
+struct MFStoreArchiveHeader
+{
+	static const uint64_t ArchiveMagic = 0x315643524153464DULL;	// "MFSARCV1"
+
+	uint64_t magic_;
+	uint64_t block_size_;
+	uint64_t file_size_;
+	uint64_t alloc_gran_;
+	uint64_t section_count_;
+	uint64_t block_count_;
+	uint64_t directory_offset_;
+	uint64_t index_offset_;
+};
+static_assert(sizeof(MFStoreArchiveHeader) == 64,
+	"MFStoreArchiveHeader must occupy exactly 64 bytes.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An entry in the section directory. The data of the section (its first
+	length_actual_ bytes) is stored in block_count_ consecutive blocks of the
+	block index, beginning at first_block_.
+*/
+struct MFStoreArchiveSection
+{
+	MFStoreSection section_;
+	uint64_t       first_block_;
+	uint64_t       block_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An entry in the block index. Each block is compressed independently with
+	zlib. A block whose compressed form is no smaller than its data is stored
+	as is, in which case the stored length equals the block length. The
+	checksum is the CRC-32C of the uncompressed data.
+*/
+struct MFStoreArchiveBlock
+{
+	uint64_t data_offset_;
+	uint32_t stored_length_;
+	uint32_t checksum_;
+};
+static_assert(sizeof(MFStoreArchiveBlock) == 16,
+	"MFStoreArchiveBlock must occupy exactly 16 bytes.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreArchiveStats
+{
+	MFStoreArchiveStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t section_count_;
+	uint64_t block_count_;
+	uint64_t raw_block_count_;
+	uint64_t data_byte_count_;
+	uint64_t stored_byte_count_;
+	uint64_t elapsed_usecs_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreArchiveCacheStats
+{
+	MFStoreArchiveCacheStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t hit_count_;
+	uint64_t decompress_count_;
+	uint64_t evict_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+const MFStoreLen MFStoreArchiveHeaderLength    = 4096;
+const MFStoreLen MFStoreArchiveBlockSize       = 64 * 1024;
+const MFStoreLen MFStoreArchiveMaxBlockSize    = 64 * 1024 * 1024;
+const int        MFStoreArchiveCompressLevel   = 6;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Writes an archive of the sections of an MFStore file which is no longer
+	being modified. Blocks are compressed in parallel. The archive file must
+	not already exist.
+*/
+MFStoreArchiveStats ArchiveMFStore(const MFStoreControl &src_ctl,
+	const std::string &archive_file_name,
+	MFStoreLen block_size = MFStoreArchiveBlockSize,
+	int compress_level = MFStoreArchiveCompressLevel,
+	unsigned int thread_count = 0);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Reads an archive created by ArchiveMFStore().
+
+	Reads take offsets within the original MFStore file (or within one of its
+	sections) and decompress only the blocks which they touch. At most
+	\e max_cached_blocks decompressed blocks are retained in least-recently
+	used order, so that repeated reads of the same region don't decompress it
+	again. Bytes of the original file outside of any section read as zero.
+
+	Extract() re-creates the original MFStore file, after which it may be
+	used through MFStoreControl as before.
+*/
+class MFStoreArchive
+{
+public:
+	static const std::size_t DefaultMaxCachedBlocks = 64;
+
+	explicit MFStoreArchive(const std::string &file_name,
+		std::size_t max_cached_blocks = DefaultMaxCachedBlocks);
+
+	const std::string        &GetFileName() const;
+	MFStoreLen                GetFileSize() const;
+	MFStoreLen                GetAllocGran() const;
+	MFStoreLen                GetBlockSize() const;
+	MFStoreLen                GetStoredSize() const;
+	const MFStoreSectionList &GetSectionList() const;
+
+	void Read(MFStoreOff datum_offset, void *dst_ptr, MFStoreLen datum_length);
+	void ReadSection(std::size_t section_index, MFStoreOff datum_offset,
+		void *dst_ptr, MFStoreLen datum_length);
+
+	template <typename DatumType>
+		DatumType GetElement(std::size_t section_index, uint64_t element_index)
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore section elements must be trivially copyable.");
+
+		DatumType datum;
+
+		ReadSection(section_index, element_index *
+			GetSectionList().at(section_index).element_size_, &datum,
+			sizeof(datum));
+
+		return(datum);
+	}
+
+	/**
+		Writes the original MFStore file, which must not already exist, and
+		returns a read-only MFStoreControl for it.
+	*/
+	MFStoreControl Extract(const std::string &dst_file_name,
+		unsigned int thread_count = 0) const;
+
+	void                     ReleaseBlocks();
+	MFStoreArchiveCacheStats GetStats() const;
+
+private:
+	struct CachedBlock
+	{
+		uint64_t          block_index_;
+		std::vector<char> block_data_;
+	};
+	using CachedBlockSPtr = std::shared_ptr<const CachedBlock>;
+	using BlockLruList    = std::list<CachedBlockSPtr>;
+	using BlockLruMap     = std::unordered_map<uint64_t, BlockLruList::iterator>;
+
+	std::string                        file_name_;
+	std::size_t                        max_cached_blocks_;
+	FileMapping                        file_mapping_;
+	MappedRegion                       region_;
+	const char                        *archive_ptr_;
+	MFStoreLen                         archive_size_;
+	MFStoreArchiveHeader               header_;
+	std::vector<MFStoreArchiveSection> directory_;
+	const MFStoreArchiveBlock         *block_index_ptr_;
+	MFStoreSectionList                 section_list_;
+	mutable std::mutex                 lru_mutex_;
+	BlockLruList                       lru_list_;
+	BlockLruMap                        lru_map_;
+	MFStoreArchiveCacheStats           stats_;
+
+	void            CheckArchive();
+	MFStoreLen      GetBlockLength(std::size_t section_index,
+		uint64_t block_index) const;
+	void            DecompressBlock(std::size_t section_index,
+		uint64_t block_index, char *dst_ptr) const;
+	CachedBlockSPtr GetBlock(std::size_t section_index, uint64_t block_index);
+
+	MFStoreArchive(const MFStoreArchive &) = delete;
+	MFStoreArchive & operator = (const MFStoreArchive &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreArchiveStats &datum);
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreArchiveCacheStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreArchive_hpp__HH
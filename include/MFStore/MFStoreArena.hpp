@@ -0,0 +1,131 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreArena.hpp
+
+   File Description  :  Include file for the MFStoreArena class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreArena_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreArena_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreArena.hpp
+
+   \brief   Definition of the MFStoreArena class, which implements a persistent
+            variable-size allocation arena within an MFStore section.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <atomic>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An arena handle is the offset of an allocation within its section. The
+	arena header occupies the start of the section, and so no allocation has
+	a handle of zero.
+*/
+using MFStoreArenaHandle = uint64_t;
+
+const MFStoreArenaHandle MFStoreArenaNullHandle = 0;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct alignas(64) MFStoreArenaHeader
+{
+	static const uint64_t HeaderMagic = 0x414E45524153464DULL;	// "MFSARENA"
+
+	uint64_t              magic_;
+	uint64_t              capacity_;
+	std::atomic<uint64_t> used_length_;
+	std::atomic<uint64_t> alloc_count_;
+	uint64_t              reserved_[4];
+};
+static_assert(sizeof(MFStoreArenaHeader) == 64,
+	"MFStoreArenaHeader must occupy exactly one cache line.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An append-only arena for variable-length data such as strings. Each
+	allocation is preceded by its 64-bit length and is padded to an eight-byte
+	boundary. Allocations made by AddString() are also NUL-terminated.
+
+	Allocate() may be called concurrently by any number of writer threads.
+	Individual allocations can't be freed; Reset() discards all of them and
+	must not be called while handles into the arena are in use.
+*/
+class MFStoreArena
+{
+public:
+	MFStoreArena(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag = false);
+
+	/// Returns MFStoreArenaNullHandle if the arena is full.
+	MFStoreArenaHandle TryAllocate(uint64_t data_length);
+	/// Throws if the arena is full.
+	MFStoreArenaHandle Allocate(uint64_t data_length);
+	MFStoreArenaHandle AddData(const void *data_ptr, uint64_t data_length);
+	MFStoreArenaHandle AddString(const std::string &src);
+
+	char        *GetPtr(MFStoreArenaHandle arena_handle);
+	const char  *GetPtr(MFStoreArenaHandle arena_handle) const;
+	uint64_t     GetLength(MFStoreArenaHandle arena_handle) const;
+	std::string  GetString(MFStoreArenaHandle arena_handle) const;
+
+	MFStoreOff GetOffset(MFStoreArenaHandle arena_handle) const;
+
+	uint64_t GetCapacity() const;
+	uint64_t GetUsedLength() const;
+	uint64_t GetAllocatedCount() const;
+
+	void Reset();
+
+	static MFStoreSection MakeArenaSection(uint64_t arena_length,
+		const std::string &description = "Arena");
+
+private:
+	MFStoreControl     *mfstore_ctl_ptr_;
+	bool                is_writer_;
+	MFStoreOff          section_offset_;
+	char               *section_ptr_;
+	MFStoreArenaHeader *header_ptr_;
+
+	void CheckHandle(MFStoreArenaHandle arena_handle) const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreArena_hpp__HH
+
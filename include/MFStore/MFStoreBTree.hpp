@@ -0,0 +1,750 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreBTree.hpp
+
+   File Description  :  Include file for the MFStoreBTree class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreBTree_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreBTree_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreBTree.hpp
+
+   \brief   Definition of the MFStoreBTree class, which implements a persistent
+            ordered index within an MFStore section.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Resides in the first node of a B+tree section. Node index zero therefore
+	never refers to a tree node and serves as the null node index.
+*/
+struct alignas(64) MFStoreBTreeHeader
+{
+	static const uint64_t HeaderMagic = 0x454552544253464DULL;	// "MFSBTREE"
+
+	uint64_t              magic_;
+	uint64_t              key_size_;
+	uint64_t              value_size_;
+	uint64_t              node_size_;
+	uint64_t              node_count_;
+	std::atomic<uint64_t> root_node_;
+	std::atomic<uint64_t> next_unused_;
+	std::atomic<uint64_t> entry_count_;
+};
+static_assert(sizeof(MFStoreBTreeHeader) == 64,
+	"MFStoreBTreeHeader must occupy exactly one cache line.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Begins every node. The version is a sequence lock: the writer makes it
+	odd before it modifies the node and even again afterwards.
+
+	A node with a high key holds only keys less than that key; greater keys
+	have been moved to the node to its right. Leaves are also linked in key
+	order through their right node index.
+*/
+struct MFStoreBTreeNodeHeader
+{
+	static const uint16_t FlagLeaf    = 0x1;
+	static const uint16_t FlagHighKey = 0x2;
+
+	uint32_t version_;
+	uint16_t node_flags_;
+	uint16_t key_count_;
+	uint32_t right_node_;
+	uint32_t reserved_;
+};
+static_assert(sizeof(MFStoreBTreeNodeHeader) == 16,
+	"MFStoreBTreeNodeHeader must be 16 bytes in size.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The parts of the B+tree which don't depend upon the key and value types.
+*/
+class MFStoreBTreeBase
+{
+public:
+	static const uint64_t NodeAlignment = 64;
+
+	uint64_t GetNodeSize() const;
+	uint64_t GetNodeCapacity() const;
+	uint64_t GetNodesUsed() const;
+	uint64_t GetEntryCount() const;
+
+	static MFStoreSection MakeBTreeSection(uint64_t node_size,
+		uint64_t node_count, const std::string &description = "BTree");
+
+protected:
+	MFStoreBTreeBase(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag, uint64_t key_size, uint64_t value_size,
+		uint64_t node_size);
+
+	MFStoreControl     *mfstore_ctl_ptr_;
+	bool                is_writer_;
+	uint64_t            node_size_;
+	char               *section_ptr_;
+	MFStoreBTreeHeader *header_ptr_;
+
+	MFStoreBTreeNodeHeader *GetNodePtr(uint32_t node_index) const
+	{
+		return(reinterpret_cast<MFStoreBTreeNodeHeader *>(section_ptr_ +
+			(node_index * node_size_)));
+	}
+
+	uint32_t GetRootNode() const
+	{
+		return(static_cast<uint32_t>(
+			header_ptr_->root_node_.load(std::memory_order_acquire)));
+	}
+
+	void     SetRootNode(uint32_t node_index);
+	void     CheckNodesFree(uint64_t node_count) const;
+	uint32_t AllocateNode(uint16_t node_flags);
+	void     CheckWriter() const;
+
+	static std::atomic<uint32_t> &GetVersion(
+		const MFStoreBTreeNodeHeader *node_ptr)
+	{
+		return(*reinterpret_cast<std::atomic<uint32_t> *>(
+			const_cast<uint32_t *>(&node_ptr->version_)));
+	}
+
+	static void BeginWrite(MFStoreBTreeNodeHeader *node_ptr)
+	{
+		std::atomic<uint32_t> &version = GetVersion(node_ptr);
+
+		version.store(version.load(std::memory_order_relaxed) + 1,
+			std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	static void EndWrite(MFStoreBTreeNodeHeader *node_ptr)
+	{
+		std::atomic<uint32_t> &version = GetVersion(node_ptr);
+
+		version.store(version.load(std::memory_order_relaxed) + 1,
+			std::memory_order_release);
+	}
+
+	/**
+		Copies a node to dst_ptr once no write to it is in progress and the
+		copy is known not to have overlapped one.
+	*/
+	void ReadNode(uint32_t node_index, void *dst_ptr) const
+	{
+		const MFStoreBTreeNodeHeader *node_ptr = GetNodePtr(node_index);
+		std::atomic<uint32_t>        &version  = GetVersion(node_ptr);
+
+		for (unsigned spin_count = 0; ; ++spin_count) {
+			uint32_t version_1 = version.load(std::memory_order_acquire);
+			if (!(version_1 & 1)) {
+				::memcpy(dst_ptr, node_ptr, node_size_);
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (version.load(std::memory_order_relaxed) == version_1)
+					return;
+			}
+			if (spin_count > 100)
+				std::this_thread::yield();
+		}
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A persistent B+tree of fixed-size keys and values. Nodes are NodeSize
+	bytes (a multiple of the cache line size) and are allocated from the
+	section as needed. Nodes are never merged or freed; a leaf emptied by
+	Erase() remains in the tree and is re-used by later insertions.
+
+	A single writer thread modifies the tree. Readers, in the same or other
+	processes, take no locks: each node is copied under its sequence lock and
+	a reader which arrives at a node after a concurrent split follows the
+	node's right link (the B-link technique). A range scan descends the tree
+	once and then reads only the leaves which hold keys in the range.
+
+	A scan running concurrently with the writer sees each key that was
+	present for the whole of the scan exactly once, and may or may not see
+	keys inserted or erased during it.
+*/
+template <typename KeyType, typename ValueType, std::size_t NodeSize = 256,
+	typename KeyCompare = std::less<KeyType> >
+	class MFStoreBTree : public MFStoreBTreeBase
+{
+	static_assert(std::is_trivially_copyable<KeyType>::value,
+		"MFStoreBTree keys must be trivially copyable.");
+	static_assert(std::is_trivially_copyable<ValueType>::value,
+		"MFStoreBTree values must be trivially copyable.");
+	static_assert((NodeSize % NodeAlignment) == 0,
+		"MFStoreBTree nodes must be a whole number of cache lines.");
+
+	using NodeHeader = MFStoreBTreeNodeHeader;
+
+	static const std::size_t NodeSlack = alignof(KeyType) +
+		alignof(ValueType) + alignof(uint32_t);
+
+public:
+	static const std::size_t LeafCapacity =
+		(NodeSize - sizeof(NodeHeader) - sizeof(KeyType) - NodeSlack) /
+		(sizeof(KeyType) + sizeof(ValueType));
+	static const std::size_t InnerCapacity =
+		(NodeSize - sizeof(NodeHeader) - sizeof(KeyType) - sizeof(uint32_t) -
+		NodeSlack) / (sizeof(KeyType) + sizeof(uint32_t));
+
+private:
+	struct LeafNode
+	{
+		NodeHeader header_;
+		KeyType    high_key_;
+		KeyType    keys_[LeafCapacity];
+		ValueType  values_[LeafCapacity];
+	};
+
+	struct InnerNode
+	{
+		NodeHeader header_;
+		KeyType    high_key_;
+		KeyType    keys_[InnerCapacity];
+		uint32_t   children_[InnerCapacity + 1];
+	};
+
+	static_assert((LeafCapacity >= 3) && (InnerCapacity >= 3),
+		"MFStoreBTree nodes must be large enough to hold at least three keys.");
+	static_assert((sizeof(LeafNode) <= NodeSize) &&
+		(sizeof(InnerNode) <= NodeSize),
+		"MFStoreBTree node layout exceeds the node size.");
+
+	/// A reader's private copy of a node.
+	struct alignas(NodeAlignment) NodeBuffer
+	{
+		const NodeHeader &Header() const
+		{
+			return(*reinterpret_cast<const NodeHeader *>(data_));
+		}
+
+		const LeafNode &Leaf() const
+		{
+			return(*reinterpret_cast<const LeafNode *>(data_));
+		}
+
+		const InnerNode &Inner() const
+		{
+			return(*reinterpret_cast<const InnerNode *>(data_));
+		}
+
+		char data_[NodeSize];
+	};
+
+	static const std::size_t MaxDepth = 32;
+
+public:
+	// ////////////////////////////////////////////////////////////////////////
+	/**
+		A position within the leaves of the tree. A cursor holds a copy of its
+		current leaf and so remains valid while the writer modifies the tree.
+	*/
+	class Cursor
+	{
+	public:
+		Cursor()
+			:tree_ptr_(nullptr)
+			,position_(0)
+			,is_valid_(false)
+		{
+		}
+
+		bool IsValid() const
+		{
+			return(is_valid_);
+		}
+
+		const KeyType &GetKey() const
+		{
+			return(leaf_.Leaf().keys_[position_]);
+		}
+
+		const ValueType &GetValue() const
+		{
+			return(leaf_.Leaf().values_[position_]);
+		}
+
+		void Next()
+		{
+			if (!is_valid_)
+				return;
+
+			KeyType last_key(GetKey());
+
+			++position_;
+
+			Settle(&last_key, false);
+		}
+
+	private:
+		friend class MFStoreBTree;
+
+		const MFStoreBTree *tree_ptr_;
+		NodeBuffer          leaf_;
+		std::size_t         position_;
+		bool                is_valid_;
+
+		/*
+			Moves right through the leaves until the position refers to a key.
+			Keys in later leaves which don't follow the bound are skipped: they
+			were moved by splits made since the earlier leaf was copied.
+		*/
+		void Settle(const KeyType *bound_ptr, bool inclusive)
+		{
+			while (position_ >= leaf_.Header().key_count_) {
+				if (!leaf_.Header().right_node_) {
+					is_valid_ = false;
+					return;
+				}
+				tree_ptr_->ReadNode(leaf_.Header().right_node_, &leaf_);
+				position_ = (!bound_ptr) ? 0 : (inclusive) ?
+					FindLower(leaf_.Leaf().keys_, leaf_.Header().key_count_,
+						*bound_ptr) :
+					FindUpper(leaf_.Leaf().keys_, leaf_.Header().key_count_,
+						*bound_ptr);
+			}
+
+			is_valid_ = true;
+		}
+	};
+	// ////////////////////////////////////////////////////////////////////////
+
+	MFStoreBTree(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag = false)
+		:MFStoreBTreeBase(mfstore_ctl, section_index, format_flag,
+			sizeof(KeyType), sizeof(ValueType), NodeSize)
+	{
+	}
+
+	bool Find(const KeyType &key, ValueType &value) const
+	{
+		NodeBuffer  leaf;
+		std::size_t position = FindLeaf(key, leaf);
+
+		if ((position >= leaf.Header().key_count_) ||
+			KeyCompare()(key, leaf.Leaf().keys_[position]))
+			return(false);
+
+		value = leaf.Leaf().values_[position];
+
+		return(true);
+	}
+
+	/// Returns a cursor at the first key not less than the specified key.
+	Cursor LowerBound(const KeyType &key) const
+	{
+		Cursor cursor;
+
+		cursor.tree_ptr_ = this;
+		cursor.position_ = FindLeaf(key, cursor.leaf_);
+		cursor.Settle(&key, true);
+
+		return(cursor);
+	}
+
+	/// Returns a cursor at the first key in the tree.
+	Cursor Begin() const
+	{
+		Cursor   cursor;
+		uint32_t node_index = GetRootNode();
+
+		cursor.tree_ptr_ = this;
+
+		for ( ; ; ) {
+			ReadNode(node_index, &cursor.leaf_);
+			if (cursor.leaf_.Header().node_flags_ & NodeHeader::FlagLeaf)
+				break;
+			node_index = cursor.leaf_.Inner().children_[0];
+		}
+
+		cursor.position_ = 0;
+		cursor.Settle(nullptr, true);
+
+		return(cursor);
+	}
+
+	/**
+		Invokes scan_func(key, value) for each key in [first_key, last_key).
+		If scan_func returns false the scan stops. Returns the number of keys
+		passed to scan_func.
+	*/
+	template <typename ScanFunc>
+		std::size_t ScanRange(const KeyType &first_key, const KeyType &last_key,
+			ScanFunc scan_func) const
+	{
+		std::size_t scan_count = 0;
+
+		for (Cursor cursor(LowerBound(first_key));
+			cursor.IsValid() && KeyCompare()(cursor.GetKey(), last_key);
+			cursor.Next()) {
+			++scan_count;
+			if (!scan_func(cursor.GetKey(), cursor.GetValue()))
+				break;
+		}
+
+		return(scan_count);
+	}
+
+	/// Returns false (and leaves the tree unchanged) if the key is present.
+	bool Insert(const KeyType &key, const ValueType &value)
+	{
+		return(InsertImpl(key, value, false));
+	}
+
+	/// Returns true if the key was inserted and false if it was updated.
+	bool InsertOrAssign(const KeyType &key, const ValueType &value)
+	{
+		return(InsertImpl(key, value, true));
+	}
+
+	/// Returns false if the key is not present.
+	bool Erase(const KeyType &key)
+	{
+		CheckWriter();
+
+		LeafNode    *leaf_ptr = GetLeafPtr(DescendForWrite(key, nullptr));
+		std::size_t  count    = leaf_ptr->header_.key_count_;
+		std::size_t  position = FindLower(leaf_ptr->keys_, count, key);
+
+		if ((position >= count) || KeyCompare()(key, leaf_ptr->keys_[position]))
+			return(false);
+
+		BeginWrite(&leaf_ptr->header_);
+		std::copy(leaf_ptr->keys_ + position + 1, leaf_ptr->keys_ + count,
+			leaf_ptr->keys_ + position);
+		std::copy(leaf_ptr->values_ + position + 1, leaf_ptr->values_ + count,
+			leaf_ptr->values_ + position);
+		leaf_ptr->header_.key_count_ = static_cast<uint16_t>(count - 1);
+		EndWrite(&leaf_ptr->header_);
+
+		header_ptr_->entry_count_.fetch_sub(1, std::memory_order_relaxed);
+
+		return(true);
+	}
+
+private:
+	static std::size_t FindLower(const KeyType *keys, std::size_t count,
+		const KeyType &key)
+	{
+		return(static_cast<std::size_t>(std::lower_bound(keys, keys + count, key,
+			KeyCompare()) - keys));
+	}
+
+	static std::size_t FindUpper(const KeyType *keys, std::size_t count,
+		const KeyType &key)
+	{
+		return(static_cast<std::size_t>(std::upper_bound(keys, keys + count, key,
+			KeyCompare()) - keys));
+	}
+
+	static bool IsBeyondHighKey(const NodeHeader &header,
+		const KeyType &high_key, const KeyType &key)
+	{
+		return((header.node_flags_ & NodeHeader::FlagHighKey) &&
+			(!KeyCompare()(key, high_key)));
+	}
+
+	LeafNode *GetLeafPtr(uint32_t node_index) const
+	{
+		return(reinterpret_cast<LeafNode *>(GetNodePtr(node_index)));
+	}
+
+	InnerNode *GetInnerPtr(uint32_t node_index) const
+	{
+		return(reinterpret_cast<InnerNode *>(GetNodePtr(node_index)));
+	}
+
+	/*
+		The reader's descent: copies each node on the path to the leaf which
+		should hold the key into the buffer and returns the lower bound of the
+		key within that leaf.
+	*/
+	std::size_t FindLeaf(const KeyType &key, NodeBuffer &buffer) const
+	{
+		uint32_t node_index = GetRootNode();
+
+		for ( ; ; ) {
+			ReadNode(node_index, &buffer);
+			if (IsBeyondHighKey(buffer.Header(), buffer.Leaf().high_key_, key))
+				node_index = buffer.Header().right_node_;
+			else if (buffer.Header().node_flags_ & NodeHeader::FlagLeaf)
+				return(FindLower(buffer.Leaf().keys_, buffer.Header().key_count_,
+					key));
+			else
+				node_index = buffer.Inner().children_[FindUpper(
+					buffer.Inner().keys_, buffer.Header().key_count_, key)];
+		}
+	}
+
+	/*
+		The writer's descent. No node on the path can be modified while the
+		writer walks it, so it reads the nodes in place.
+	*/
+	uint32_t DescendForWrite(const KeyType &key, uint32_t *path_ptr,
+		std::size_t *depth_ptr = nullptr) const
+	{
+		uint32_t    node_index = GetRootNode();
+		std::size_t depth      = 0;
+
+		for ( ; ; ) {
+			const NodeHeader *node_ptr = GetNodePtr(node_index);
+			if (node_ptr->node_flags_ & NodeHeader::FlagLeaf)
+				break;
+			if (depth >= MaxDepth)
+				throw std::logic_error("The MFStore B+tree depth exceeds " +
+					std::to_string(MaxDepth) + ".");
+			if (path_ptr)
+				path_ptr[depth] = node_index;
+			++depth;
+			const InnerNode *inner_ptr = GetInnerPtr(node_index);
+			node_index = inner_ptr->children_[FindUpper(inner_ptr->keys_,
+				inner_ptr->header_.key_count_, key)];
+		}
+
+		if (depth_ptr)
+			*depth_ptr = depth;
+
+		return(node_index);
+	}
+
+	bool InsertImpl(const KeyType &key, const ValueType &value,
+		bool assign_flag)
+	{
+		CheckWriter();
+
+		uint32_t     path_list[MaxDepth];
+		std::size_t  depth;
+		uint32_t     leaf_index = DescendForWrite(key, path_list, &depth);
+		LeafNode    *leaf_ptr   = GetLeafPtr(leaf_index);
+		std::size_t  count      = leaf_ptr->header_.key_count_;
+		std::size_t  position   = FindLower(leaf_ptr->keys_, count, key);
+
+		if ((position < count) && (!KeyCompare()(key, leaf_ptr->keys_[position]))) {
+			if (assign_flag) {
+				BeginWrite(&leaf_ptr->header_);
+				leaf_ptr->values_[position] = value;
+				EndWrite(&leaf_ptr->header_);
+			}
+			return(false);
+		}
+
+		if (count < LeafCapacity) {
+			BeginWrite(&leaf_ptr->header_);
+			std::copy_backward(leaf_ptr->keys_ + position, leaf_ptr->keys_ + count,
+				leaf_ptr->keys_ + count + 1);
+			std::copy_backward(leaf_ptr->values_ + position,
+				leaf_ptr->values_ + count, leaf_ptr->values_ + count + 1);
+			leaf_ptr->keys_[position]    = key;
+			leaf_ptr->values_[position]  = value;
+			leaf_ptr->header_.key_count_ = static_cast<uint16_t>(count + 1);
+			EndWrite(&leaf_ptr->header_);
+		}
+		else {
+			CheckNodesFree(CountSplitNodes(path_list, depth));
+			SplitLeaf(path_list, depth, leaf_index, position, key, value);
+		}
+
+		header_ptr_->entry_count_.fetch_add(1, std::memory_order_relaxed);
+
+		return(true);
+	}
+
+	/*
+		The most nodes a split of the leaf below the path can allocate: the new
+		leaf, one for each full inner node above it and, if all of those are
+		full, a new root. They are checked before any node is changed, so that
+		a split never fails part way through.
+	*/
+	std::size_t CountSplitNodes(const uint32_t *path_list,
+		std::size_t depth) const
+	{
+		std::size_t node_count = 1;
+
+		for ( ; depth; --depth, ++node_count) {
+			if (GetInnerPtr(path_list[depth - 1])->header_.key_count_ <
+				InnerCapacity)
+				return(node_count);
+		}
+
+		return(node_count + 1);
+	}
+
+	/*
+		The new right-hand node is completely built before the left-hand node
+		is changed to link to it, so that a reader sees either the full node
+		or both halves.
+	*/
+	void SplitLeaf(const uint32_t *path_list, std::size_t depth,
+		uint32_t leaf_index, std::size_t position, const KeyType &key,
+		const ValueType &value)
+	{
+		KeyType   tmp_keys[LeafCapacity + 1];
+		ValueType tmp_values[LeafCapacity + 1];
+		uint32_t  right_index = AllocateNode(NodeHeader::FlagLeaf);
+		LeafNode *leaf_ptr    = GetLeafPtr(leaf_index);
+		LeafNode *right_ptr   = GetLeafPtr(right_index);
+
+		std::copy(leaf_ptr->keys_, leaf_ptr->keys_ + position, tmp_keys);
+		std::copy(leaf_ptr->values_, leaf_ptr->values_ + position, tmp_values);
+		tmp_keys[position]   = key;
+		tmp_values[position] = value;
+		std::copy(leaf_ptr->keys_ + position, leaf_ptr->keys_ + LeafCapacity,
+			tmp_keys + position + 1);
+		std::copy(leaf_ptr->values_ + position, leaf_ptr->values_ + LeafCapacity,
+			tmp_values + position + 1);
+
+		const std::size_t left_count  = (LeafCapacity + 1) / 2;
+		const std::size_t right_count = (LeafCapacity + 1) - left_count;
+
+		right_ptr->header_.node_flags_ = leaf_ptr->header_.node_flags_;
+		right_ptr->header_.key_count_  = static_cast<uint16_t>(right_count);
+		right_ptr->header_.right_node_ = leaf_ptr->header_.right_node_;
+		right_ptr->high_key_           = leaf_ptr->high_key_;
+		std::copy(tmp_keys + left_count, tmp_keys + LeafCapacity + 1,
+			right_ptr->keys_);
+		std::copy(tmp_values + left_count, tmp_values + LeafCapacity + 1,
+			right_ptr->values_);
+
+		BeginWrite(&leaf_ptr->header_);
+		std::copy(tmp_keys, tmp_keys + left_count, leaf_ptr->keys_);
+		std::copy(tmp_values, tmp_values + left_count, leaf_ptr->values_);
+		leaf_ptr->header_.key_count_   = static_cast<uint16_t>(left_count);
+		leaf_ptr->header_.node_flags_ |= NodeHeader::FlagHighKey;
+		leaf_ptr->header_.right_node_  = right_index;
+		leaf_ptr->high_key_            = right_ptr->keys_[0];
+		EndWrite(&leaf_ptr->header_);
+
+		InsertIntoParent(path_list, depth, leaf_index, right_ptr->keys_[0],
+			right_index);
+	}
+
+	void InsertIntoParent(const uint32_t *path_list, std::size_t depth,
+		uint32_t left_index, const KeyType &separator, uint32_t right_index)
+	{
+		if (!depth) {
+			uint32_t   root_index = AllocateNode(0);
+			InnerNode *root_ptr   = GetInnerPtr(root_index);
+			root_ptr->header_.key_count_ = 1;
+			root_ptr->keys_[0]           = separator;
+			root_ptr->children_[0]       = left_index;
+			root_ptr->children_[1]       = right_index;
+			SetRootNode(root_index);
+			return;
+		}
+
+		uint32_t     parent_index = path_list[depth - 1];
+		InnerNode   *parent_ptr   = GetInnerPtr(parent_index);
+		std::size_t  count        = parent_ptr->header_.key_count_;
+		std::size_t  position     = FindUpper(parent_ptr->keys_, count,
+			separator);
+
+		if (count < InnerCapacity) {
+			BeginWrite(&parent_ptr->header_);
+			std::copy_backward(parent_ptr->keys_ + position,
+				parent_ptr->keys_ + count, parent_ptr->keys_ + count + 1);
+			std::copy_backward(parent_ptr->children_ + position + 1,
+				parent_ptr->children_ + count + 1,
+				parent_ptr->children_ + count + 2);
+			parent_ptr->keys_[position]         = separator;
+			parent_ptr->children_[position + 1] = right_index;
+			parent_ptr->header_.key_count_      =
+				static_cast<uint16_t>(count + 1);
+			EndWrite(&parent_ptr->header_);
+			return;
+		}
+
+		KeyType  tmp_keys[InnerCapacity + 1];
+		uint32_t tmp_children[InnerCapacity + 2];
+
+		std::copy(parent_ptr->keys_, parent_ptr->keys_ + position, tmp_keys);
+		tmp_keys[position] = separator;
+		std::copy(parent_ptr->keys_ + position, parent_ptr->keys_ + count,
+			tmp_keys + position + 1);
+		std::copy(parent_ptr->children_, parent_ptr->children_ + position + 1,
+			tmp_children);
+		tmp_children[position + 1] = right_index;
+		std::copy(parent_ptr->children_ + position + 1,
+			parent_ptr->children_ + count + 1, tmp_children + position + 2);
+
+		// The middle key moves up to the grandparent.
+		const std::size_t left_count  = (InnerCapacity + 1) / 2;
+		const std::size_t right_count = InnerCapacity - left_count;
+		uint32_t          new_index   = AllocateNode(0);
+		InnerNode        *new_ptr     = GetInnerPtr(new_index);
+
+		new_ptr->header_.node_flags_ = parent_ptr->header_.node_flags_;
+		new_ptr->header_.key_count_  = static_cast<uint16_t>(right_count);
+		new_ptr->header_.right_node_ = parent_ptr->header_.right_node_;
+		new_ptr->high_key_           = parent_ptr->high_key_;
+		std::copy(tmp_keys + left_count + 1, tmp_keys + InnerCapacity + 1,
+			new_ptr->keys_);
+		std::copy(tmp_children + left_count + 1,
+			tmp_children + InnerCapacity + 2, new_ptr->children_);
+
+		BeginWrite(&parent_ptr->header_);
+		std::copy(tmp_keys, tmp_keys + left_count, parent_ptr->keys_);
+		std::copy(tmp_children, tmp_children + left_count + 1,
+			parent_ptr->children_);
+		parent_ptr->header_.key_count_   = static_cast<uint16_t>(left_count);
+		parent_ptr->header_.node_flags_ |= NodeHeader::FlagHighKey;
+		parent_ptr->header_.right_node_  = new_index;
+		parent_ptr->high_key_            = tmp_keys[left_count];
+		EndWrite(&parent_ptr->header_);
+
+		InsertIntoParent(path_list, depth - 1, parent_index,
+			tmp_keys[left_count], new_index);
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreBTree_hpp__HH
+
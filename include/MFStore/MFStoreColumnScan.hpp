@@ -0,0 +1,118 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreColumnScan.hpp
+
+   File Description  :  Include file for the column scan functions.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreColumnScan_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreColumnScan_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreColumnScan.hpp
+
+   \brief   Vectorized scan, filter and aggregate functions over the columns
+            of columnar sections.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStore.hpp>
+
+#include <type_traits>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The functions are instantiated for int32_t, uint32_t, int64_t, uint64_t,
+	float and double columns. Sums are accumulated in 64-bit integers or in
+	doubles, as appropriate. The results of scans over floating-point columns
+	which contain NaNs are unspecified.
+*/
+template <typename DatumType>
+	using MFStoreColumnSum = typename std::conditional<
+		std::is_floating_point<DatumType>::value, double,
+		typename std::conditional<std::is_signed<DatumType>::value, int64_t,
+		uint64_t>::type>::type;
+
+/// Bit \e n is set if row \e n satisfied the predicate.
+using MFStoreColumnBitmap = std::vector<uint64_t>;
+
+enum class MFStoreColumnOp
+{
+	  Less
+	, LessEqual
+	, Equal
+	, NotEqual
+	, GreaterEqual
+	, Greater
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	DatumType ColumnMin(const DatumType *column_ptr, uint64_t row_count);
+template <typename DatumType>
+	DatumType ColumnMax(const DatumType *column_ptr, uint64_t row_count);
+template <typename DatumType>
+	MFStoreColumnSum<DatumType> ColumnSum(const DatumType *column_ptr,
+		uint64_t row_count);
+
+/// Sums the rows for which the corresponding bitmap bit is set.
+template <typename DatumType>
+	MFStoreColumnSum<DatumType> ColumnSumSelected(const DatumType *column_ptr,
+		uint64_t row_count, const MFStoreColumnBitmap &row_bitmap);
+
+/// Returns the number of rows which satisfy \e column_op \e datum_value.
+template <typename DatumType>
+	uint64_t ColumnFilter(const DatumType *column_ptr, uint64_t row_count,
+		MFStoreColumnOp column_op, DatumType datum_value,
+		MFStoreColumnBitmap &row_bitmap);
+
+/// Returns the number of rows which are in the closed interval.
+template <typename DatumType>
+	uint64_t ColumnFilterRange(const DatumType *column_ptr, uint64_t row_count,
+		DatumType low_value, DatumType high_value,
+		MFStoreColumnBitmap &row_bitmap);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint64_t BitmapCount(const MFStoreColumnBitmap &row_bitmap);
+uint64_t BitmapAnd(MFStoreColumnBitmap &dst_bitmap,
+	const MFStoreColumnBitmap &src_bitmap);
+uint64_t BitmapOr(MFStoreColumnBitmap &dst_bitmap,
+	const MFStoreColumnBitmap &src_bitmap);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreColumnScan_hpp__HH
+
@@ -0,0 +1,169 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreColumnar.hpp
+
+   File Description  :  Include file for the columnar section classes.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreColumnar_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreColumnar_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreColumnar.hpp
+
+   \brief   Definition of the classes which support sections laid out as
+            structures-of-arrays.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreColumnSpec
+{
+	MFStoreColumnSpec(const std::string &column_name, uint64_t column_width);
+
+	std::string column_name_;
+	uint64_t    column_width_;
+};
+using MFStoreColumnSpecList = std::vector<MFStoreColumnSpec>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Describes the placement of each column within a columnar section. Column
+	\e n holds row_count values of column_width_ bytes and begins at an offset
+	which is a multiple of ColumnAlignment from the start of the section, so
+	that scans over a column always begin on a cache line.
+
+	Because the section list only records element sizes and counts, a
+	columnar section is recorded as row_count elements of a padded row width
+	large enough to hold all of the columns. The column specifications
+	themselves are supplied by the program, as is the section list.
+*/
+class MFStoreColumnLayout
+{
+public:
+	static const uint64_t ColumnAlignment = 64;
+
+	MFStoreColumnLayout(uint64_t row_count,
+		const MFStoreColumnSpecList &column_list);
+
+	uint64_t                 GetRowCount() const;
+	std::size_t              GetColumnCount() const;
+	const MFStoreColumnSpec &GetColumnSpec(std::size_t column_index) const;
+	uint64_t                 GetColumnOffset(std::size_t column_index) const;
+	std::size_t              FindColumn(const std::string &column_name) const;
+	uint64_t                 GetLengthUsed() const;
+	uint64_t                 GetRowWidthPadded() const;
+
+	MFStoreSection MakeSection(const std::string &description = "Columnar")
+		const;
+
+	void CheckSection(const MFStoreSection &section) const;
+
+private:
+	uint64_t              row_count_;
+	MFStoreColumnSpecList column_list_;
+	std::vector<uint64_t> offset_list_;
+	uint64_t              length_used_;
+
+	void CheckColumnIndex(std::size_t column_index) const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Provides typed access to the columns of a columnar section. The scan
+	functions in MFStoreColumnScan.hpp operate upon the returned pointers.
+*/
+class MFStoreColumnar
+{
+public:
+	MFStoreColumnar(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		const MFStoreColumnSpecList &column_list);
+
+	const MFStoreColumnLayout &GetLayout() const;
+	uint64_t                   GetRowCount() const;
+
+	template <typename DatumType>
+		DatumType *GetColumn(std::size_t column_index)
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore column values must be trivially copyable.");
+
+		if (!is_writer_)
+			mfstore_ctl_ptr_->CheckIsWriter();
+
+		return(static_cast<DatumType *>(GetColumnPtr(column_index,
+			sizeof(DatumType), alignof(DatumType))));
+	}
+
+	template <typename DatumType>
+		const DatumType *GetColumn(std::size_t column_index) const
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore column values must be trivially copyable.");
+
+		return(static_cast<const DatumType *>(GetColumnPtr(column_index,
+			sizeof(DatumType), alignof(DatumType))));
+	}
+
+	template <typename DatumType>
+		DatumType *GetColumn(const std::string &column_name)
+	{
+		return(GetColumn<DatumType>(layout_.FindColumn(column_name)));
+	}
+
+	template <typename DatumType>
+		const DatumType *GetColumn(const std::string &column_name) const
+	{
+		return(GetColumn<DatumType>(layout_.FindColumn(column_name)));
+	}
+
+private:
+	MFStoreControl      *mfstore_ctl_ptr_;
+	bool                 is_writer_;
+	MFStoreColumnLayout  layout_;
+	char                *section_ptr_;
+
+	void *GetColumnPtr(std::size_t column_index, std::size_t datum_size,
+		std::size_t datum_alignment) const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreColumnar_hpp__HH
+
@@ -36,6 +36,8 @@
 // Required include files...
 // ////////////////////////////////////////////////////////////////////////////
 
+#include <MFStore/MFStoreMapPolicy.hpp>
+#include <MFStore/MFStoreNuma.hpp>
 #include <MFStore/MFStoreSection.hpp>
 
 #ifdef _Windows
@@ -59,6 +61,7 @@
 # pragma warning(pop)
 #endif // #ifdef _Windows
 
+#include <map>
 #include <memory>
 
 // ////////////////////////////////////////////////////////////////////////////
@@ -85,7 +88,8 @@ public:
 	MFStoreControl();
 	MFStoreControl(const std::string &file_name, bool is_writer,
 		MFStoreLen file_size, MFStoreLen mmap_size, MFStoreLen alloc_gran,
-		const MFStoreSectionList &section_list = MFStoreSectionList());
+		const MFStoreSectionList &section_list = MFStoreSectionList(),
+		const MFStoreMapPolicy &map_policy = MFStoreMapPolicy());
 
 	template <typename DatumType>
 		DatumType *GetPtr(MFStoreOff datum_offset)
@@ -115,10 +119,47 @@ public:
 	MappedRegionSPtr          GetRegionSPtr() const;
 	const MFStoreSectionList &GetSectionList() const;
 	void                      SetSectionList(const MFStoreSectionList &src);
+	const MFStoreMapPolicy   &GetMapPolicy() const;
 
 	void CheckSectionList() const;
 	void CheckSectionList(const MFStoreSectionList &section_list) const;
 
+	void ApplyMapPolicy(const MFStoreMapPolicy &map_policy);
+	void ApplyMapPolicy(std::size_t section_index,
+		const MFStoreMapPolicy &map_policy);
+	void ApplyMapPolicy(const MFStoreSectionPolicyList &policy_list);
+
+	void ApplyNumaPolicy(std::size_t section_index,
+		const MFStoreNumaPolicy &numa_policy);
+	void ApplyNumaPolicy(const MFStoreSectionNumaPolicyList &policy_list);
+	void RefreshNumaReplicas();
+
+	MFStoreNumaPlacement      GetNumaPlacement(std::size_t section_index) const;
+	const MFStoreNumaReplica *GetNumaReplica(std::size_t section_index) const;
+
+	/**
+		Returns the copy of the section on the node of the calling thread if
+		the section is replicated, and the section within the mapping if not.
+	*/
+	template <typename DatumType>
+		const DatumType *GetSectionPtrLocal(std::size_t section_index) const
+	{
+		const MFStoreNumaReplica *replica_ptr = GetNumaReplica(section_index);
+
+		return((replica_ptr) ?
+			static_cast<const DatumType *>(replica_ptr->GetLocalPtr()) :
+			GetPtr<DatumType>(GetSectionMapped(section_index).section_offset_));
+	}
+
+	const MFStoreSection &GetSectionMapped(std::size_t section_index) const;
+
+	void Flush(bool async = false);
+	void Flush(MFStoreOff offset, MFStoreLen length, bool async = false);
+	void FlushSection(std::size_t section_index, bool async = false);
+
+	void WriteSectionList(std::size_t section_list_index = 1);
+	void ReadSectionList(std::size_t section_list_index = 1);
+
 private:
 	FileMappingSPtr    mapping_sptr_;
 	MappedRegionSPtr   region_sptr_;
@@ -127,6 +168,9 @@ private:
 	MFStoreLen         mmap_size_;
 	MFStoreLen         alloc_gran_;
 	MFStoreSectionList section_list_;
+	MFStoreMapPolicy   map_policy_;
+
+	std::map<std::size_t, MFStoreNumaReplicaSPtr> numa_replica_map_;
 };
 // ////////////////////////////////////////////////////////////////////////////
 
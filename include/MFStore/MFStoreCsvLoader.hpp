@@ -0,0 +1,269 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreCsvLoader.hpp
+
+   File Description  :  Include file for the MFStoreCsvLoader class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreCsvLoader_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreCsvLoader_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreCsvLoader.hpp
+
+   \brief   Definition of the MFStoreCsvLoader class, which parses a CSV file
+            in parallel and writes its records directly into the fixed-size
+            elements of an MFStore section.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <Utility/ParseCsv.hpp>
+
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Invoked once for each data record of the CSV file with the columns of the
+	record, a pointer to the section element which receives it and the index
+	of that element. Column values are as they appear in the file, including
+	any quotes. May be invoked concurrently for different records.
+*/
+using MFStoreCsvConvertFunc =
+	std::function<void (const MLB::Utility::ParseCsvColList &col_list,
+		void *element_ptr, uint64_t record_index)>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreCsvLoadStats
+{
+	MFStoreCsvLoadStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t     byte_count_;
+	uint64_t     record_count_;
+	std::size_t  chunk_count_;
+	unsigned int thread_count_;
+	uint64_t     scan_usecs_;
+	uint64_t     load_usecs_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Loads a CSV file into a pre-sized MFStore section.
+
+	The constructor maps the file and divides it into one chunk per thread.
+	Chunk boundaries fall only at the start of a record: because a quote
+	state can't be known without scanning everything before it, each chunk
+	is first scanned from each of the possible quote states (outside a quote
+	or within a quote opened by each of the quote characters recognized by
+	the ParseCsvControl) and the actual states are then chained from the
+	start of the file. A second parallel scan locates the first record of each
+	chunk and counts its records, so that each chunk knows the index of the
+	section element which receives its first record.
+
+	Load() then parses the chunks in parallel with the ParseCsvControl
+	settings and passes each record to the conversion function along with
+	the address of its element within the mapping of the store.
+
+	Empty lines are ignored. The first \e header_record_count records are
+	skipped and aren't included in the record count.
+*/
+class MFStoreCsvLoader
+{
+public:
+	MFStoreCsvLoader(const std::string &file_name,
+		const MLB::Utility::ParseCsvControl &parse_control =
+			MLB::Utility::ParseCsvControl(),
+		uint64_t header_record_count = 0, unsigned int thread_count = 0);
+
+	const std::string &GetFileName() const;
+	uint64_t           GetFileSize() const;
+	uint64_t           GetRecordCount() const;
+	std::size_t        GetChunkCount() const;
+
+	/// A section with one element of the specified size for each record.
+	MFStoreSection MakeSection(uint64_t element_size,
+		const std::string &description = "CsvRecords") const;
+
+	/**
+		The section must be mapped by a writer and must have at least as many
+		elements as there are records. If \e column_count is not zero, records
+		with some other number of columns are rejected.
+	*/
+	MFStoreCsvLoadStats Load(MFStoreControl &mfstore_ctl,
+		std::size_t section_index, const MFStoreCsvConvertFunc &convert_func,
+		std::size_t column_count = 0) const;
+
+	/// Loads elements of type DatumType, which must be the section element size.
+	template <typename DatumType, typename ConvertFunc>
+		MFStoreCsvLoadStats LoadAs(MFStoreControl &mfstore_ctl,
+			std::size_t section_index, ConvertFunc convert_func,
+			std::size_t column_count = 0) const
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore section elements must be trivially copyable.");
+
+		CheckElementSize(mfstore_ctl, section_index, sizeof(DatumType));
+
+		return(Load(mfstore_ctl, section_index,
+			[&convert_func](const MLB::Utility::ParseCsvColList &col_list,
+				void *element_ptr, uint64_t) {
+				convert_func(col_list, *static_cast<DatumType *>(element_ptr));
+			}, column_count));
+	}
+
+private:
+	struct Chunk
+	{
+		uint64_t begin_offset_;
+		uint64_t end_offset_;
+		/// Counts records from the start of the file, including the header.
+		uint64_t first_record_;
+		uint64_t record_count_;
+	};
+
+	std::string                   file_name_;
+	MLB::Utility::ParseCsvControl parse_control_;
+	std::string                   quote_char_list_;
+	char                          line_sep_char_;
+	uint64_t                      header_record_count_;
+	unsigned int                  thread_count_;
+	FileMapping                   file_mapping_;
+	MappedRegion                  region_;
+	const char                   *file_ptr_;
+	uint64_t                      file_size_;
+	/// The start of a final record not followed by a line separator.
+	uint64_t                      tail_offset_;
+	std::vector<Chunk>            chunk_list_;
+	uint64_t                      scan_usecs_;
+
+	void ScanChunks();
+	void LoadRecords(std::string_view src_data, uint64_t src_offset,
+		uint64_t &record_index, uint64_t &record_count, char *section_ptr,
+		std::size_t element_size, const MFStoreCsvConvertFunc &convert_func,
+		std::size_t column_count) const;
+	void CheckElementSize(const MFStoreControl &mfstore_ctl,
+		std::size_t section_index, std::size_t element_size) const;
+
+	MFStoreCsvLoader(const MFStoreCsvLoader &) = delete;
+	MFStoreCsvLoader & operator = (const MFStoreCsvLoader &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns the column value without its enclosing quotes, if any. Quotes
+	doubled within the value are left as they are.
+*/
+inline std::string_view CsvUnquote(std::string_view src)
+{
+	if ((src.size() > 1) && ((src.front() == '"') || (src.front() == '\'')) &&
+		(src.back() == src.front()))
+		return(src.substr(1, src.size() - 2));
+
+	return(src);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Converts a column value to an arithmetic type. An empty value converts to
+	zero.
+*/
+template <typename DatumType>
+	void CsvToValue(std::string_view src, DatumType &dst)
+{
+	static_assert(std::is_arithmetic<DatumType>::value,
+		"CsvToValue() requires an arithmetic type.");
+
+	src = CsvUnquote(src);
+
+	if (src.empty()) {
+		dst = DatumType();
+		return;
+	}
+
+	auto result = std::from_chars(src.data(), src.data() + src.size(), dst);
+
+	if ((result.ec != std::errc()) || (result.ptr != (src.data() + src.size())))
+		throw std::invalid_argument("Unable to convert the CSV value '" +
+			std::string(src) + "' to a numeric value of " +
+			std::to_string(sizeof(DatumType)) + " bytes.");
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Copies a column value, without its enclosing quotes and with doubled
+	quotes collapsed, into a fixed-size character array. The remainder of
+	the array is zero-filled. The value may occupy the entire array, in
+	which case it isn't terminated.
+*/
+template <std::size_t DstLength>
+	void CsvToChars(std::string_view src, char (&dst)[DstLength])
+{
+	std::string_view value(CsvUnquote(src));
+	std::size_t      dst_index = 0;
+	bool             quoted    = value.size() != src.size();
+
+	for (std::size_t src_index = 0; src_index < value.size(); ++src_index) {
+		if (dst_index == DstLength)
+			throw std::invalid_argument("The CSV value '" + std::string(value) +
+				"' is too long for a field of " + std::to_string(DstLength) +
+				" characters.");
+		dst[dst_index++] = value[src_index];
+		if (quoted && (value[src_index] == src.front()) &&
+			((src_index + 1) < value.size()) &&
+			(value[src_index + 1] == src.front()))
+			++src_index;
+	}
+
+	if (dst_index < DstLength)
+		::memset(dst + dst_index, '\0', DstLength - dst_index);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreCsvLoadStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreCsvLoader_hpp__HH
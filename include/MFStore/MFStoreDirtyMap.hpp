@@ -0,0 +1,116 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreDirtyMap.hpp
+
+   File Description  :  Include file for the MFStoreDirtyMap class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreDirtyMap_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreDirtyMap_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreDirtyMap.hpp
+
+   \brief   Definition of the MFStoreDirtyMap class, a lock-free bitmap of
+            the modified granules (usually pages) of an MFStore file.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreSection.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreRange
+{
+	MFStoreRange(MFStoreOff offset = 0, MFStoreLen length = 0)
+		:offset_(offset)
+		,length_(length)
+	{
+	}
+
+	MFStoreOff CalcEndOffset() const
+	{
+		return(offset_ + length_);
+	}
+
+	MFStoreOff offset_;
+	MFStoreLen length_;
+};
+using MFStoreRangeList = std::vector<MFStoreRange>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Any number of threads may call MarkDirty() concurrently with a single
+	thread calling Harvest(). MarkDirty() should be called after the data
+	has been modified so that a concurrent Harvest() can't miss the change.
+*/
+class MFStoreDirtyMap
+{
+public:
+	explicit MFStoreDirtyMap(MFStoreLen map_length, MFStoreLen granule = 0);
+
+	void MarkDirty(MFStoreOff offset, MFStoreLen length);
+	void MarkDirtySection(const MFStoreSection &section);
+	void MarkDirtyElements(const MFStoreSection &section,
+		uint64_t element_index, uint64_t element_count = 1);
+	bool IsDirty(MFStoreOff offset) const;
+	bool IsEmpty() const;
+
+	/// Clears the map and returns the coalesced dirty ranges.
+	std::size_t Harvest(MFStoreRangeList &range_list);
+	void        Clear();
+
+	MFStoreLen GetMapLength() const;
+	MFStoreLen GetGranule() const;
+
+private:
+	using WordType = std::atomic<uint64_t>;
+
+	MFStoreLen                  map_length_;
+	MFStoreLen                  granule_;
+	std::size_t                 granule_count_;
+	std::size_t                 word_count_;
+	std::unique_ptr<WordType[]> word_list_;
+
+	MFStoreDirtyMap(const MFStoreDirtyMap &) = delete;
+	MFStoreDirtyMap & operator = (const MFStoreDirtyMap &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreDirtyMap_hpp__HH
+
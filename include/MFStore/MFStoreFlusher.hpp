@@ -0,0 +1,135 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreFlusher.hpp
+
+   File Description  :  Include file for the MFStoreFlusher class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreFlusher_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreFlusher_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreFlusher.hpp
+
+   \brief   Definition of the MFStoreFlusher class, which writes the dirty
+            ranges of an MFStore back to storage from a background thread.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+#include <MFStore/MFStoreDirtyMap.hpp>
+#include <MFStore/MFStoreIntervalThread.hpp>
+
+#include <mutex>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreFlusherStats
+{
+	MFStoreFlusherStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t pass_count_;
+	uint64_t barrier_count_;
+	uint64_t range_count_;
+	uint64_t byte_count_;
+	uint64_t sync_range_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Writers call MarkDirty() (or one of its variants) after modifying the
+	mapping. Once every flush interval the background thread harvests the
+	dirty map and writes each coalesced range back to storage; on Linux this
+	is done with sync_file_range() so that the writeback of one range can
+	overlap the submission of the next. Elsewhere an asynchronous msync() is
+	used.
+
+	Flush(true) is a barrier: on return, every range marked dirty before the
+	call has been written with msync(MS_SYNC), including those which the
+	background thread had already written back but not synced. Flush(false)
+	merely wakes the background thread.
+
+	An exception raised within the background thread is retained and
+	re-thrown by the next call to Flush() or Stop().
+*/
+class MFStoreFlusher
+{
+public:
+	using FlushInterval = MFStoreIntervalThread::Interval;
+
+	explicit MFStoreFlusher(MFStoreControl &mfstore_ctl,
+		const FlushInterval &flush_interval = FlushInterval(100),
+		MFStoreLen granule = 0, bool start_flag = true);
+	~MFStoreFlusher();
+
+	void MarkDirty(MFStoreOff offset, MFStoreLen length);
+	void MarkDirtySection(std::size_t section_index);
+	void MarkDirtyElements(std::size_t section_index, uint64_t element_index,
+		uint64_t element_count = 1);
+
+	void Flush(bool barrier = true);
+
+	void Start();
+	void Stop();
+	bool IsRunning() const;
+
+	FlushInterval        GetFlushInterval() const;
+	MFStoreFlusherStats  GetStats() const;
+
+private:
+	MFStoreControl          &mfstore_ctl_;
+	MFStoreDirtyMap          dirty_map_;
+	MFStoreDirtyMap          unsynced_map_;
+	MFStoreRangeList         range_list_;
+	MFStoreRangeList         unsynced_list_;
+	mutable std::mutex       flush_mutex_;
+	MFStoreFlusherStats      stats_;
+	MFStoreIntervalThread    flush_thread_;
+
+	void FlushPass(bool barrier);
+
+	MFStoreFlusher(const MFStoreFlusher &) = delete;
+	MFStoreFlusher & operator = (const MFStoreFlusher &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreFlusherStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreFlusher_hpp__HH
+
@@ -0,0 +1,103 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreIntervalThread.hpp
+
+   File Description  :  Include file for the MFStoreIntervalThread class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreIntervalThread_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreIntervalThread_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreIntervalThread.hpp
+
+   \brief   Definition of the MFStoreIntervalThread class, the background
+            thread which drives MFStoreFlusher and MFStoreReplicator.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Calls the pass function once every interval, or sooner if woken, until
+	stopped. An exception thrown by the pass function ends the thread; it is
+	retained and re-thrown by the next call to RethrowException().
+
+	IsRunning() is true only while the thread is running passes, and so
+	becomes false once the thread has ended because of an exception.
+*/
+class MFStoreIntervalThread
+{
+public:
+	using Interval = std::chrono::milliseconds;
+	using PassFunc = std::function<void ()>;
+
+	MFStoreIntervalThread(const Interval &interval, const PassFunc &pass_func);
+	~MFStoreIntervalThread();
+
+	void Start();
+	/// Stops the thread and waits for it to end. Doesn't re-throw.
+	void Stop();
+	void Wake();
+	bool IsRunning() const;
+	void RethrowException();
+
+	Interval GetInterval() const;
+
+private:
+	Interval                 interval_;
+	PassFunc                 pass_func_;
+	mutable std::mutex       thread_mutex_;
+	std::condition_variable  thread_cv_;
+	bool                     stop_flag_;
+	bool                     wake_flag_;
+	bool                     running_flag_;
+	std::exception_ptr       thread_except_;
+	std::thread              thread_;
+
+	void RunThread();
+
+	MFStoreIntervalThread(const MFStoreIntervalThread &) = delete;
+	MFStoreIntervalThread & operator = (const MFStoreIntervalThread &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreIntervalThread_hpp__HH
+
@@ -0,0 +1,207 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreJournal.hpp
+
+   File Description  :  Include file for the MFStoreJournal class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreJournal_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreJournal_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreJournal.hpp
+
+   \brief   Definition of the MFStoreJournal class, which makes batches of
+            writes to an MFStore atomic with respect to crashes.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Resides at the start of a journal section. Batches which have not yet
+	been checkpointed begin at head_offset_ within the section and have
+	sequence numbers following checkpoint_sequence_.
+*/
+struct alignas(64) MFStoreJournalHeader
+{
+	static const uint64_t HeaderMagic = 0x314C4E524A53464DULL;	// "MFSJRNL1"
+
+	uint64_t magic_;
+	uint64_t capacity_;
+	uint64_t head_offset_;
+	uint64_t checkpoint_sequence_;
+	uint64_t reserved_[4];
+};
+static_assert(sizeof(MFStoreJournalHeader) == 64,
+	"MFStoreJournalHeader must occupy exactly one cache line.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Precedes the data of each write within a batch and, without data, ends
+	the batch. In a commit record, offset_ holds the number of writes in the
+	batch, length_ the number of bytes they occupy in the journal, and
+	data_crc_ the CRC-32C of those bytes.
+*/
+struct MFStoreJournalRecord
+{
+	static const uint32_t RecordMagic  = 0x4A46464DU;	// "MFFJ"
+	static const uint32_t RecordWrite  = 1;
+	static const uint32_t RecordCommit = 2;
+
+	uint32_t magic_;
+	uint32_t record_type_;
+	uint64_t sequence_;
+	uint64_t offset_;
+	uint64_t length_;
+	uint32_t data_crc_;
+	uint32_t header_crc_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreJournalStats
+{
+	MFStoreJournalStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t batch_count_;
+	uint64_t write_count_;
+	uint64_t byte_count_;
+	uint64_t sync_count_;
+	uint64_t checkpoint_count_;
+	uint64_t recovered_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A write-ahead (redo) journal kept in a section of the MFStore whose
+	writes it protects.
+
+	The writer describes the changes of a batch with AddWrite() instead of
+	making them to the mapping directly. Commit() appends the batch and a
+	commit record to the journal. Sync() makes all committed batches durable
+	with a single flush of the journal and only then applies their writes to
+	the mapping, so that a batch committed with Commit(false) costs no flush
+	of its own (group commit). Checkpoint() flushes the applied writes and
+	empties the journal; it is called automatically when the journal is
+	full.
+
+	Constructing a journal in a writer which doesn't format it recovers the
+	store: each complete batch after the last checkpoint is re-applied, and
+	the first incomplete or damaged batch and those following it are
+	discarded.
+
+	Because writes reach the mapping only when they are synced, a writer
+	which reads data it may have changed since the last sync should use
+	Read(), which overlays the pending writes upon the mapping.
+
+	The journal provides atomicity with respect to crashes, not isolation:
+	readers which examine the mapping while Sync() applies a batch may see
+	part of it.
+*/
+class MFStoreJournal
+{
+public:
+	MFStoreJournal(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag = false);
+	~MFStoreJournal();
+
+	MFStoreJournal(const MFStoreJournal &) = delete;
+	MFStoreJournal & operator = (const MFStoreJournal &) = delete;
+
+	void     AddWrite(MFStoreOff offset, const void *data_ptr,
+		MFStoreLen length);
+	uint64_t Commit(bool sync_flag = true);
+	void     Abort();
+	void     Sync();
+	void     Checkpoint();
+
+	void     Read(MFStoreOff offset, void *dst_ptr, MFStoreLen length) const;
+
+	uint64_t                   GetSequence() const;
+	uint64_t                   GetSyncedSequence() const;
+	MFStoreLen                 GetCapacity() const;
+	MFStoreLen                 GetUsedLength() const;
+	std::size_t                GetRecoveredCount() const;
+	const MFStoreJournalStats &GetStats() const;
+
+	static MFStoreSection MakeJournalSection(MFStoreLen journal_length,
+		const std::string &description = "Journal");
+
+private:
+	using AppliedRange     = std::pair<MFStoreOff, MFStoreLen>;
+	using AppliedRangeList = std::vector<AppliedRange>;
+
+	MFStoreControl       &mfstore_ctl_;
+	MFStoreOff            section_offset_;
+	MFStoreLen            section_length_;
+	char                 *section_ptr_;
+	MFStoreJournalHeader *header_ptr_;
+	std::vector<char>     batch_buffer_;
+	uint64_t              batch_write_count_;
+	MFStoreOff            tail_offset_;
+	MFStoreOff            sync_offset_;
+	uint64_t              sequence_;
+	uint64_t              synced_sequence_;
+	AppliedRangeList      applied_list_;
+	std::size_t           recovered_count_;
+	MFStoreJournalStats   stats_;
+
+	std::size_t Recover();
+	void        ApplyBatches(MFStoreOff begin_offset, MFStoreOff end_offset);
+	void        FlushApplied();
+	void        OverlayWrites(const char *begin_ptr, const char *end_ptr,
+		MFStoreOff offset, void *dst_ptr, MFStoreLen length) const;
+	void        CheckTarget(MFStoreOff offset, MFStoreLen length) const;
+	bool        IsValidRecord(MFStoreOff record_offset,
+		uint64_t expected_sequence, MFStoreJournalRecord &record) const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreJournalStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreJournal_hpp__HH
+
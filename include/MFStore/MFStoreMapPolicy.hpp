@@ -0,0 +1,112 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreMapPolicy.hpp
+
+   File Description  :  Include file for the MFStoreMapPolicy class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreMapPolicy_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreMapPolicy_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreMapPolicy.hpp
+
+   \brief   Definition of the MFStoreMapPolicy class, which describes the
+            page size, access advice, locking and pre-faulting to be applied
+            to an MFStore mapping or to a section within that mapping.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStore.hpp>
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+enum class MFStoreAdvice {
+	Normal     = 0,
+	Random     = 1,
+	Sequential = 2,
+	WillNeed   = 3
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Huge pages are requested with madvise(MADV_HUGEPAGE). Whether the kernel
+	actually backs a file mapping with huge pages depends upon the file
+	system (tmpfs, DAX, or kernels built with read-only THP for file systems).
+
+	Pre-faulting uses MAP_POPULATE when the policy is supplied at the time
+	the mapping is created and MADV_POPULATE_READ/WRITE (or, on kernels which
+	lack those, a touch of each page) when applied to an existing mapping.
+*/
+class MFStoreMapPolicy
+{
+public:
+	explicit MFStoreMapPolicy(bool huge_pages = false,
+		MFStoreAdvice advice = MFStoreAdvice::Normal, bool lock_pages = false,
+		bool pre_fault = false);
+
+	bool IsDefault() const;
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+	std::string   ToString() const;
+
+	bool          huge_pages_;
+	MFStoreAdvice advice_;
+	bool          lock_pages_;
+	bool          pre_fault_;
+
+	static const char *AdviceToString(MFStoreAdvice advice);
+
+	static void Apply(void *mmap_address, MFStoreLen mmap_length,
+		const MFStoreMapPolicy &policy, bool is_writer);
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+using MFStoreSectionPolicy     = std::pair<std::size_t, MFStoreMapPolicy>;
+using MFStoreSectionPolicyList = std::vector<MFStoreSectionPolicy>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreMapPolicy &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreMapPolicy_hpp__HH
+
@@ -0,0 +1,175 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreNotify.hpp
+
+   File Description  :  Include file for the MFStoreNotify class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+                        2026-10-18 --- Added GetSectionIndex().
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreNotify_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreNotify_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreNotify.hpp
+
+   \brief   Definition of the MFStoreNotify class, which implements a
+            per-section change notification channel within an MFStore.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	One slot per cache line so that a writer advancing one section doesn't
+	cause false sharing with readers waiting on another.
+*/
+struct alignas(64) MFStoreNotifySlot
+{
+	std::atomic<uint32_t> generation_;
+	uint32_t              reserved_[15];
+};
+static_assert(sizeof(MFStoreNotifySlot) == 64,
+	"MFStoreNotifySlot must occupy exactly one cache line.");
+
+/**
+	The number of readers blocked (or about to block) on the generation of
+	the corresponding MFStoreNotifySlot. These live in a shared memory
+	segment outside the store, so that readers need no write access to the
+	store file.
+*/
+struct alignas(64) MFStoreNotifyWaiter
+{
+	std::atomic<uint32_t> waiter_count_;
+	uint32_t              reserved_[15];
+};
+static_assert(sizeof(MFStoreNotifyWaiter) == 64,
+	"MFStoreNotifyWaiter must occupy exactly one cache line.");
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+	"MFStoreNotifySlot requires a lock-free (and address-free) 32-bit atomic.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The notify section holds one MFStoreNotifySlot for each section in the
+	store; slot \e n carries the generation of section \e n.
+
+	The writer calls Advance() after updating a section. Readers remember the
+	generation they last processed and call WaitForChange(), which blocks on
+	a futex keyed by the slot's location in the file, so that the wake-up
+	reaches readers in other processes. A reader increments the slot's
+	waiter count before it blocks, and the writer issues a wake only when
+	that count is non-zero, so that an update nobody waits for costs no
+	system call. Writers updating many records should use
+	MFStoreNotifyBatch, which advances and wakes each touched slot only once.
+
+	The waiter counts are kept in a shared memory segment named after the
+	device and inode of the store file and the index of the notify section,
+	which is created on first use with read and write permission for each
+	class of user permitted to read the store. Nothing in the store itself
+	is written by a reader. A reader which dies while waiting leaves the
+	count raised, which costs the writer only the wakes it would have issued
+	anyway. The segment outlives the processes which use it; call
+	RemoveWaiterSegment() to remove it once the store is no longer in use.
+
+	On operating systems without futexes WaitForChange() falls back to a
+	sleeping poll.
+*/
+class MFStoreNotify
+{
+public:
+	using WaitTimeout = std::chrono::nanoseconds;
+
+	MFStoreNotify(MFStoreControl &mfstore_ctl, std::size_t notify_section_index);
+
+	std::size_t GetSectionIndex() const;
+	std::size_t GetSlotCount() const;
+
+	uint32_t GetGeneration(std::size_t slot_index) const;
+	uint32_t GetWaiterCount(std::size_t slot_index) const;
+	uint32_t Advance(std::size_t slot_index, bool wake_flag = true);
+	void     Wake(std::size_t slot_index);
+
+	/// Returns the new generation, or last_generation upon a timeout.
+	uint32_t WaitForChange(std::size_t slot_index,
+		uint32_t last_generation) const;
+	uint32_t WaitForChange(std::size_t slot_index, uint32_t last_generation,
+		const WaitTimeout &wait_timeout) const;
+
+	static MFStoreSection MakeNotifySection(std::size_t slot_count,
+		const std::string &description = "Notify");
+
+	static bool RemoveWaiterSegment(const std::string &file_name,
+		std::size_t notify_section_index);
+
+private:
+	MFStoreControl      *mfstore_ctl_ptr_;
+	bool                 is_writer_;
+	std::size_t          section_index_;
+	std::size_t          slot_count_;
+	MFStoreNotifySlot   *slot_list_;
+	MappedRegionSPtr     waiter_region_sptr_;
+	MFStoreNotifyWaiter *waiter_list_;
+
+	MFStoreNotifySlot &GetSlot(std::size_t slot_index) const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+class MFStoreNotifyBatch
+{
+public:
+	explicit MFStoreNotifyBatch(MFStoreNotify &notify);
+	~MFStoreNotifyBatch();
+
+	void Touch(std::size_t slot_index);
+	void Commit();
+
+private:
+	MFStoreNotify     &notify_;
+	std::vector<bool>  touched_list_;
+	bool               touched_flag_;
+
+	MFStoreNotifyBatch(const MFStoreNotifyBatch &) = delete;
+	MFStoreNotifyBatch & operator = (const MFStoreNotifyBatch &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreNotify_hpp__HH
+
@@ -0,0 +1,197 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreNuma.hpp
+
+   File Description  :  Include file for the MFStore NUMA placement support.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreNuma_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreNuma_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreNuma.hpp
+
+   \brief   Definition of the MFStoreNumaPolicy class, which describes the
+            NUMA node placement of an MFStore section, and of the supporting
+            placement report and per-node section replicas.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStore.hpp>
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+enum class MFStoreNumaMode {
+	Default    = 0,
+	Bind       = 1,
+	Preferred  = 2,
+	Interleave = 3,
+	Replicate  = 4
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+using MFStoreNumaNodeList = std::vector<int>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The Bind, Preferred and Interleave modes are applied to the shared mapping
+	with mbind(). An empty node list means all online nodes. When move_pages_
+	is true, pages already resident elsewhere are migrated (MPOL_MF_MOVE);
+	only pages mapped by this process alone can be moved.
+
+	The kernel honors these policies for files on tmpfs (such as /dev/shm),
+	but allocates the page cache of files on most other file systems
+	according to the policy of the faulting thread. Use the placement report
+	to see where the pages actually reside.
+
+	Replicate mode leaves the shared mapping alone and instead gives this
+	process a private, read-only copy of the section on each listed node.
+	It is intended for read-mostly sections; see MFStoreNumaReplica.
+*/
+class MFStoreNumaPolicy
+{
+public:
+	explicit MFStoreNumaPolicy(MFStoreNumaMode mode = MFStoreNumaMode::Default,
+		const MFStoreNumaNodeList &node_list = MFStoreNumaNodeList(),
+		bool move_pages = true);
+
+	bool IsDefault() const;
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+	std::string   ToString() const;
+
+	MFStoreNumaMode     mode_;
+	MFStoreNumaNodeList node_list_;
+	bool                move_pages_;
+
+	static const char *ModeToString(MFStoreNumaMode mode);
+
+	static void Apply(void *mmap_address, MFStoreLen mmap_length,
+		const MFStoreNumaPolicy &policy);
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+using MFStoreSectionNumaPolicy     = std::pair<std::size_t, MFStoreNumaPolicy>;
+using MFStoreSectionNumaPolicyList = std::vector<MFStoreSectionNumaPolicy>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The number of pages of a range which reside on each node. Pages which
+	have not yet been faulted in are counted as absent.
+*/
+struct MFStoreNumaPlacement
+{
+	MFStoreNumaPlacement();
+
+	int GetPrincipalNode() const;
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+	std::string   ToString() const;
+
+	uint64_t              page_count_;
+	uint64_t              absent_count_;
+	std::vector<uint64_t> node_page_count_;
+
+	static MFStoreNumaPlacement Get(const void *mmap_address,
+		MFStoreLen mmap_length);
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Private copies of a range, one per node, each allocated on its node.
+	GetLocalPtr() returns the copy on the node of the calling thread, or the
+	source range if that node has no copy.
+
+	The copies are taken at construction and by Refresh(). They don't see
+	subsequent changes to the source; a reader should call Refresh() when it
+	learns (by MFStoreNotify, for example) that the section has changed, and
+	must not do so concurrently with its own use of the copies.
+*/
+class MFStoreNumaReplica
+{
+public:
+	MFStoreNumaReplica(const void *src_ptr, MFStoreLen src_length,
+		const MFStoreNumaNodeList &node_list = MFStoreNumaNodeList());
+	~MFStoreNumaReplica();
+
+	MFStoreNumaReplica(const MFStoreNumaReplica &) = delete;
+	MFStoreNumaReplica & operator = (const MFStoreNumaReplica &) = delete;
+
+	void Refresh();
+
+	const void *GetPtr(int node) const;
+	const void *GetLocalPtr() const;
+
+	MFStoreLen                 GetLength() const;
+	const MFStoreNumaNodeList &GetNodeList() const;
+	MFStoreNumaPlacement       GetPlacement(int node) const;
+
+private:
+	const void          *src_ptr_;
+	MFStoreLen           src_length_;
+	MFStoreLen           mmap_length_;
+	MFStoreNumaNodeList  node_list_;
+	std::vector<void *>  replica_list_;
+
+	void Release();
+};
+using MFStoreNumaReplicaSPtr = std::shared_ptr<MFStoreNumaReplica>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/// Returns one more than the highest-numbered online node.
+int GetNumaNodeCount();
+/// Returns the node of the CPU on which the calling thread is running.
+int GetNumaCurrentNode();
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreNumaPolicy &datum);
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreNumaPlacement &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreNuma_hpp__HH
+
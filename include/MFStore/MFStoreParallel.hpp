@@ -0,0 +1,115 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreParallel.hpp
+
+   File Description  :  Include file for parallel section initialization and
+                        checksum support.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreParallel_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreParallel_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreParallel.hpp
+
+   \brief   Parallel initialization of MFStore sections and the calculation
+            and verification of the per-section CRC-32C checksums held in
+            the persisted section list.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <functional>
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The function is invoked with the chunk index, the index of the first item
+	in the chunk and the number of items in the chunk. The first chunk is
+	processed by the calling thread. The first exception thrown by any chunk
+	is re-thrown once all threads have completed.
+
+	A \e thread_count of 0 uses std::thread::hardware_concurrency().
+*/
+using MFStoreParallelFunc =
+	std::function<void (unsigned int, uint64_t, uint64_t)>;
+
+unsigned int ResolveThreadCount(unsigned int thread_count,
+	uint64_t item_count, uint64_t min_items_per_thread = 1);
+
+void MFStoreParallelFor(uint64_t item_count, unsigned int thread_count,
+	const MFStoreParallelFunc &chunk_func, uint64_t min_items_per_thread = 1);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+void InitSectionParallel(MFStoreControl &mfstore_ctl,
+	std::size_t section_index, const void *template_ptr,
+	std::size_t template_size, unsigned int thread_count = 0);
+
+template <typename DatumType>
+	void InitSectionParallel(MFStoreControl &mfstore_ctl,
+		std::size_t section_index, const DatumType &template_element,
+		unsigned int thread_count = 0)
+{
+	static_assert(std::is_trivially_copyable<DatumType>::value,
+		"MFStore section elements must be trivially copyable.");
+
+	InitSectionParallel(mfstore_ctl, section_index, &template_element,
+		sizeof(template_element), thread_count);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+uint32_t CalcSectionChecksum(const MFStoreControl &mfstore_ctl,
+	std::size_t section_index, unsigned int thread_count = 0);
+
+/**
+	Calculates the checksum of every section other than the section list
+	itself, records them in the section list and writes the section list to
+	the mapping.
+*/
+void UpdateSectionChecksums(MFStoreControl &mfstore_ctl,
+	std::size_t section_list_index = 1, unsigned int thread_count = 0);
+
+/**
+	Reads the persisted section list and verifies the checksum of every
+	section flagged as having one. Throws upon the first mismatch.
+*/
+void VerifySectionChecksums(MFStoreControl &mfstore_ctl,
+	std::size_t section_list_index = 1, unsigned int thread_count = 0);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreParallel_hpp__HH
+
@@ -0,0 +1,177 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreReplicaTransport.hpp
+
+   File Description  :  Include file for the MFStore replication transports.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreReplicaTransport_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreReplicaTransport_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreReplicaTransport.hpp
+
+   \brief   Definition of the transports by which changed ranges of an
+            MFStore are shipped to a standby copy.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+#include <MFStore/MFStoreDirtyMap.hpp>
+
+#include <memory>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The replicator calls SendRange() for each changed range and then calls
+	SendCommit() with the same sequence number. A standby is consistent as of
+	the last commit applied to it; ranges received after that commit may be
+	from a later, incomplete pass.
+*/
+class MFStoreReplicaTransport
+{
+public:
+	virtual ~MFStoreReplicaTransport();
+
+	virtual void SendRange(uint64_t sequence, MFStoreOff offset,
+		MFStoreLen length, const void *data_ptr) = 0;
+	virtual void SendCommit(uint64_t sequence) = 0;
+};
+using MFStoreReplicaTransportSPtr = std::shared_ptr<MFStoreReplicaTransport>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Applies replicated ranges to a standby MFStore opened by this process as
+	a writer. It serves both as the transport for a local standby and as the
+	target of ReceiveReplicaStream().
+
+	The ranges of a pass are held in memory until its commit arrives and are
+	then written to the standby together, so that the standby never holds
+	part of a pass. Ranges held for a sequence number which is never
+	committed are discarded when a range for a different sequence number
+	arrives.
+*/
+class MFStoreReplicaApplier : public MFStoreReplicaTransport
+{
+public:
+	explicit MFStoreReplicaApplier(MFStoreControl &standby_ctl,
+		bool flush_on_commit = true);
+
+	void SendRange(uint64_t sequence, MFStoreOff offset, MFStoreLen length,
+		const void *data_ptr) override;
+	void SendCommit(uint64_t sequence) override;
+
+	uint64_t GetAppliedSequence() const;
+
+private:
+	MFStoreControl    &standby_ctl_;
+	bool               flush_on_commit_;
+	uint64_t           applied_sequence_;
+	uint64_t           staged_sequence_;
+	MFStoreRangeList   staged_list_;
+	std::vector<char>  staged_data_;
+
+	void FlushStagedRanges();
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef __unix
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The record which precedes each replicated range (and which, without data,
+	marks a commit) in a replication stream. Records are written in host
+	byte order.
+*/
+struct MFStoreReplicaRecord
+{
+	static const uint32_t RecordMagic  = 0x5246464DU;	// "MFFR"
+	static const uint32_t RecordRange  = 1;
+	static const uint32_t RecordCommit = 2;
+
+	uint32_t magic_;
+	uint32_t record_type_;
+	uint64_t sequence_;
+	uint64_t offset_;
+	uint64_t length_;
+	uint32_t data_crc_;
+	uint32_t header_crc_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Writes replicated ranges to a file descriptor, such as a pipe or a
+	connected socket. The descriptor isn't closed by the destructor.
+
+	Ranges longer than StreamChunkLength are sent as several records.
+*/
+class MFStoreReplicaStreamTransport : public MFStoreReplicaTransport
+{
+public:
+	static const MFStoreLen StreamChunkLength = 1ULL << 20;
+
+	explicit MFStoreReplicaStreamTransport(int stream_fd);
+
+	void SendRange(uint64_t sequence, MFStoreOff offset, MFStoreLen length,
+		const void *data_ptr) override;
+	void SendCommit(uint64_t sequence) override;
+
+private:
+	int               stream_fd_;
+	std::vector<char> send_buffer_;
+
+	void SendRecord(uint32_t record_type, uint64_t sequence, MFStoreOff offset,
+		MFStoreLen length, const void *data_ptr);
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Reads a replication stream until end-of-file, passing each range and
+	commit to the target transport (usually an MFStoreReplicaApplier).
+	Returns the sequence number of the last commit received.
+
+	Throws if the stream ends within a record, if a record fails its
+	checksum or if a range record is longer than StreamChunkLength.
+*/
+uint64_t ReceiveReplicaStream(int stream_fd, MFStoreReplicaTransport &target);
+// ////////////////////////////////////////////////////////////////////////////
+
+#endif // #ifdef __unix
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreReplicaTransport_hpp__HH
+
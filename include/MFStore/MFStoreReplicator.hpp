@@ -0,0 +1,141 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreReplicator.hpp
+
+   File Description  :  Include file for the MFStoreReplicator class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreReplicator_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreReplicator_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreReplicator.hpp
+
+   \brief   Definition of the MFStoreReplicator class, which ships the changed
+            ranges of an MFStore to a standby copy.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreDirtyMap.hpp>
+#include <MFStore/MFStoreIntervalThread.hpp>
+#include <MFStore/MFStoreNotify.hpp>
+#include <MFStore/MFStoreReplicaTransport.hpp>
+
+#include <mutex>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreReplicatorStats
+{
+	MFStoreReplicatorStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t pass_count_;
+	uint64_t commit_count_;
+	uint64_t range_count_;
+	uint64_t byte_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Changes are found in two ways. Writers may call MarkDirty() (or one of its
+	variants) after modifying the mapping, as with MFStoreFlusher. In addition,
+	if TrackGenerations() has been called, each pass marks as dirty every
+	section whose MFStoreNotify generation has advanced since the previous
+	pass.
+
+	Each pass harvests the changed ranges, sends each to the transport and
+	then sends a commit with the next sequence number. Passes without changes
+	send nothing. A range modified while being sent will have been marked
+	dirty again by the writer, and so is re-sent by the following pass.
+
+	To establish a standby, call MarkAll() before the first pass.
+*/
+class MFStoreReplicator
+{
+public:
+	using ReplicateInterval = MFStoreIntervalThread::Interval;
+
+	MFStoreReplicator(MFStoreControl &primary_ctl,
+		const MFStoreReplicaTransportSPtr &transport_sptr,
+		const ReplicateInterval &replicate_interval = ReplicateInterval(10),
+		MFStoreLen granule = 0, bool start_flag = true);
+	~MFStoreReplicator();
+
+	void MarkDirty(MFStoreOff offset, MFStoreLen length);
+	void MarkDirtySection(std::size_t section_index);
+	void MarkDirtyElements(std::size_t section_index, uint64_t element_index,
+		uint64_t element_count = 1);
+	void MarkAll();
+
+	void TrackGenerations(const MFStoreNotify &notify);
+
+	/// Performs a pass and returns the sequence number last committed.
+	uint64_t Replicate();
+
+	void Start();
+	void Stop();
+	bool IsRunning() const;
+
+	uint64_t               GetSequence() const;
+	MFStoreReplicatorStats GetStats() const;
+
+private:
+	MFStoreControl              &primary_ctl_;
+	MFStoreReplicaTransportSPtr  transport_sptr_;
+	MFStoreDirtyMap              dirty_map_;
+	MFStoreRangeList             range_list_;
+	const MFStoreNotify         *notify_ptr_;
+	std::vector<uint32_t>        generation_list_;
+	uint64_t                     sequence_;
+	mutable std::mutex           pass_mutex_;
+	MFStoreReplicatorStats       stats_;
+	MFStoreIntervalThread        replicate_thread_;
+
+	void ReplicatePass();
+	void MarkChangedGenerations();
+
+	MFStoreReplicator(const MFStoreReplicator &) = delete;
+	MFStoreReplicator & operator = (const MFStoreReplicator &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreReplicatorStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreReplicator_hpp__HH
+
@@ -0,0 +1,393 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSchema.hpp
+
+   File Description  :  Include file for the MFStoreSchema class template.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreSchema_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreSchema_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreSchema.hpp
+
+   \brief   Definition of the MFStoreSchema class template, which describes
+            the sections of an MFStore at compile time and provides typed
+            access to them.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <array>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+# include <span>
+#endif // #if __cplusplus >= 202002L
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+#ifdef __cpp_lib_span
+template <typename DatumType>
+	using MFStoreSpan = std::span<DatumType>;
+#else
+/**
+	A minimal stand-in for std::span for use before C++20.
+*/
+template <typename DatumType>
+	class MFStoreSpan
+{
+public:
+	using element_type = DatumType;
+	using value_type   = typename std::remove_cv<DatumType>::type;
+	using size_type    = std::size_t;
+	using pointer      = DatumType *;
+	using reference    = DatumType &;
+	using iterator     = DatumType *;
+
+	constexpr MFStoreSpan()
+		:data_ptr_(nullptr)
+		,element_count_(0)
+	{
+	}
+
+	constexpr MFStoreSpan(DatumType *data_ptr, std::size_t element_count)
+		:data_ptr_(data_ptr)
+		,element_count_(element_count)
+	{
+	}
+
+	constexpr iterator    begin() const { return(data_ptr_); }
+	constexpr iterator    end() const { return(data_ptr_ + element_count_); }
+	constexpr pointer     data() const { return(data_ptr_); }
+	constexpr size_type   size() const { return(element_count_); }
+	constexpr size_type   size_bytes() const
+	{
+		return(element_count_ * sizeof(DatumType));
+	}
+	constexpr bool        empty() const { return(!element_count_); }
+	constexpr reference   front() const { return(*data_ptr_); }
+	constexpr reference   back() const
+	{
+		return(data_ptr_[element_count_ - 1]);
+	}
+
+	constexpr reference operator [] (size_type element_index) const
+	{
+		return(data_ptr_[element_index]);
+	}
+
+private:
+	DatumType   *data_ptr_;
+	std::size_t  element_count_;
+};
+#endif // #ifdef __cpp_lib_span
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The base of each section declaration in a schema. The declaration must
+	also provide the section description as a static constexpr const char *
+	named SectionName; MLB_MFSTORE_SCHEMA_SECTION() does both.
+*/
+template <typename SectionDatumType, uint64_t SectionElementCount>
+	struct MFStoreSchemaSection
+{
+	using DatumType = SectionDatumType;
+
+	static constexpr uint64_t ElementSize  = sizeof(DatumType);
+	static constexpr uint64_t ElementCount = SectionElementCount;
+
+	static_assert(std::is_trivially_copyable<DatumType>::value,
+		"The datum type of an MFStore section must be trivially copyable.");
+	static_assert(std::is_standard_layout<DatumType>::value,
+		"The datum type of an MFStore section must have standard layout.");
+	static_assert(alignof(DatumType) <= MFStoreAllocGran,
+		"The datum type of an MFStore section may not be more strictly aligned "
+		"than the section allocation granularity.");
+	static_assert((ElementSize > 0) &&
+		(ElementSize <= MFStoreSection::MaxElementValue),
+		"The element size of an MFStore section is out of range.");
+	static_assert((ElementCount > 0) &&
+		(ElementCount <= MFStoreSection::MaxElementValue),
+		"The element count of an MFStore section is out of range.");
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+#define MLB_MFSTORE_SCHEMA_SECTION(section_name, datum_type, element_count) \
+	struct section_name                                                      \
+		:public MLB::MFStore::MFStoreSchemaSection<datum_type, element_count> \
+	{                                                                        \
+		static constexpr const char *SectionName = #section_name;             \
+	}
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace Detail {
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename SectionType>
+	struct SchemaDependentFalse : std::false_type { };
+
+template <typename SectionType, typename... SectionTypes>
+	struct SchemaIndexOf
+{
+	static_assert(SchemaDependentFalse<SectionType>::value,
+		"The section is not a member of the MFStore schema.");
+};
+
+template <typename SectionType, typename... OtherTypes>
+	struct SchemaIndexOf<SectionType, SectionType, OtherTypes...>
+	:std::integral_constant<std::size_t, 0> { };
+
+template <typename SectionType, typename FirstType, typename... OtherTypes>
+	struct SchemaIndexOf<SectionType, FirstType, OtherTypes...>
+	:std::integral_constant<std::size_t,
+		1 + SchemaIndexOf<SectionType, OtherTypes...>::value> { };
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t SchemaNameLength(const char *section_name)
+{
+	std::size_t name_length = 0;
+
+	while (section_name[name_length])
+		++name_length;
+
+	return(name_length);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+constexpr MFStoreLen SchemaRoundUp(MFStoreLen length)
+{
+	return(((length + (MFStoreAllocGran - 1)) / MFStoreAllocGran) *
+		MFStoreAllocGran);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename... SectionTypes>
+	constexpr std::array<MFStoreOff, sizeof...(SectionTypes) + 1>
+	SchemaCalcOffsetList()
+{
+	std::array<MFStoreLen, sizeof...(SectionTypes)> length_list{{
+		(SectionTypes::ElementSize * SectionTypes::ElementCount)...}};
+	std::array<MFStoreOff, sizeof...(SectionTypes) + 1> offset_list{ };
+
+	for (std::size_t section_index = 0; section_index < length_list.size();
+		++section_index)
+		offset_list[section_index + 1] = offset_list[section_index] +
+			SchemaRoundUp(length_list[section_index]);
+
+	return(offset_list);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename... SectionTypes>
+	constexpr bool SchemaCheckNames()
+{
+	for (const char *section_name : {SectionTypes::SectionName...}) {
+		std::size_t name_length = SchemaNameLength(section_name);
+		if ((!name_length) ||
+			(name_length > MFStoreSection::MaxDescriptionLength))
+			return(false);
+	}
+
+	return(true);
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace Detail
+
+// ////////////////////////////////////////////////////////////////////////////
+void CheckSchemaSectionList(const MFStoreSectionList &expected_list,
+	const MFStoreSection *actual_ptr, std::size_t actual_count,
+	const std::string &list_source);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Describes the first sections of an MFStore as a list of section
+	declarations, each giving the section description, datum type and
+	element count:
+
+	\code
+	MLB_MFSTORE_SCHEMA_SECTION(Header, HeaderBlock, 1);
+	MLB_MFSTORE_SCHEMA_SECTION(Ticks,  Tick,        1000000);
+	using TickSchema = MLB::MFStore::MFStoreSchema<Header, Ticks>;
+	\endcode
+
+	Section offsets are computed at compile time using the layout applied
+	by MFStoreSection::FixupSectionList() with the default allocation
+	granularity. Binding a schema to an MFStoreControl checks its section
+	list and, optionally, the section list persisted in the mapping by
+	MFStoreControl::WriteSectionList(); Get() then returns the section as a
+	span of its datum type at no cost beyond an addition.
+*/
+template <typename... SectionTypes>
+	class MFStoreSchema
+{
+	static_assert(sizeof...(SectionTypes) > 0,
+		"An MFStore schema must have at least one section.");
+
+	static constexpr std::array<MFStoreOff, sizeof...(SectionTypes) + 1>
+		offset_list_ = Detail::SchemaCalcOffsetList<SectionTypes...>();
+
+	static_assert(Detail::SchemaCheckNames<SectionTypes...>(),
+		"Each MFStore schema section name must have between 1 and 63 "
+		"characters.");
+
+public:
+	static constexpr std::size_t NoSectionListIndex =
+		std::numeric_limits<std::size_t>::max();
+
+	static constexpr std::size_t SectionCount = sizeof...(SectionTypes);
+
+	/// The length of the mapping (and minimum file size) the schema requires.
+	static constexpr MFStoreLen StoreLength = offset_list_[SectionCount];
+
+	template <typename SectionType>
+		static constexpr std::size_t IndexOf()
+	{
+		static_assert((std::is_same<SectionType, SectionTypes>::value + ...) ==
+			1, "A section appears more than once in the MFStore schema.");
+
+		return(Detail::SchemaIndexOf<SectionType, SectionTypes...>::value);
+	}
+
+	template <typename SectionType>
+		static constexpr MFStoreOff OffsetOf()
+	{
+		return(offset_list_[IndexOf<SectionType>()]);
+	}
+
+	static MFStoreSectionList MakeSectionList()
+	{
+		MFStoreSectionList section_list;
+
+		(MFStoreSection::AppendSection(MFStoreSection(0,
+			SectionTypes::ElementSize, SectionTypes::ElementCount, 0, 0, 0, 0, 0,
+			SectionTypes::SectionName), section_list), ...);
+
+		MFStoreSection::FixupSectionList(section_list);
+
+		for (std::size_t section_index = 0; section_index < SectionCount;
+			++section_index) {
+			if (section_list[section_index].section_offset_ !=
+				offset_list_[section_index])
+				throw std::logic_error("The offset of MFStore schema section '" +
+					std::string(section_list[section_index].description_) +
+					"' computed at run-time (" +
+					std::to_string(section_list[section_index].section_offset_) +
+					") differs from that computed at compile-time (" +
+					std::to_string(offset_list_[section_index]) + ").");
+		}
+
+		return(section_list);
+	}
+
+	/**
+		The section list of the control must begin with the sections of the
+		schema. If section_list_index is specified, so must the section list
+		persisted in that section.
+	*/
+	explicit MFStoreSchema(MFStoreControl &mfstore_ctl,
+		std::size_t section_list_index = NoSectionListIndex)
+		:mfstore_ctl_ptr_(&mfstore_ctl)
+		,base_ptr_(nullptr)
+	{
+		try {
+			mfstore_ctl.CheckIsActive();
+			if (mfstore_ctl.GetMmapSize() < StoreLength)
+				throw std::invalid_argument("The mapping length (" +
+					std::to_string(mfstore_ctl.GetMmapSize()) + ") is less than "
+					"the length required by the schema (" +
+					std::to_string(StoreLength) + ").");
+			MFStoreSectionList expected_list(MakeSectionList());
+			const MFStoreSectionList &section_list =
+				mfstore_ctl.GetSectionList();
+			CheckSchemaSectionList(expected_list, section_list.data(),
+				section_list.size(), "section list");
+			if (section_list_index != NoSectionListIndex) {
+				const MFStoreSection &list_section =
+					mfstore_ctl.GetSectionMapped(section_list_index);
+				CheckSchemaSectionList(expected_list,
+					mfstore_ctl.GetPtr<MFStoreSection>(
+					list_section.section_offset_),
+					static_cast<std::size_t>(list_section.CalcLengthUsed() /
+					sizeof(MFStoreSection)), "persisted section list");
+			}
+			base_ptr_ = static_cast<char *>(mfstore_ctl.GetMmapAddress());
+		}
+		catch (const std::exception &except) {
+			throw std::invalid_argument("Unable to bind the schema to MFStore "
+				"file '" + mfstore_ctl.GetFileName() + "': " +
+				std::string(except.what()));
+		}
+	}
+
+	template <typename SectionType>
+		MFStoreSpan<typename SectionType::DatumType> Get()
+	{
+		return(MFStoreSpan<typename SectionType::DatumType>(
+			reinterpret_cast<typename SectionType::DatumType *>(base_ptr_ +
+			OffsetOf<SectionType>()),
+			static_cast<std::size_t>(SectionType::ElementCount)));
+	}
+
+	template <typename SectionType>
+		MFStoreSpan<const typename SectionType::DatumType> Get() const
+	{
+		return(MFStoreSpan<const typename SectionType::DatumType>(
+			reinterpret_cast<const typename SectionType::DatumType *>(base_ptr_ +
+			OffsetOf<SectionType>()),
+			static_cast<std::size_t>(SectionType::ElementCount)));
+	}
+
+	MFStoreControl &GetControl() const
+	{
+		return(*mfstore_ctl_ptr_);
+	}
+
+private:
+	MFStoreControl *mfstore_ctl_ptr_;
+	char           *base_ptr_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreSchema_hpp__HH
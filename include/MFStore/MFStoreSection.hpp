@@ -57,6 +57,12 @@ public:
 	static const uint64_t MaxElementValue      = 1000000000ULL;
 	static const uint64_t MaxDescriptionLength = 63ULL;
 
+	/// Set in section_flags_ when reserved_ holds the section CRC-32C.
+	static const uint64_t FlagChecksum         = 0x0000000000000001ULL;
+
+	/// Set in section_flags_ when the section is laid out column-wise.
+	static const uint64_t FlagColumnar         = 0x0000000000000002ULL;
+
 	MFStoreSection();
 
 	MFStoreSection(
@@ -111,6 +117,11 @@ private:
 };
 // ////////////////////////////////////////////////////////////////////////////
 
+static_assert(sizeof(MFStoreSection) == 128,
+	"MFStoreSection must occupy exactly 128 bytes in the persisted section "
+	"list.");
+// ////////////////////////////////////////////////////////////////////////////
+
 // ////////////////////////////////////////////////////////////////////////////
 using MFStoreSectionList = MFStoreSection::MFStoreSectionList;
 // ////////////////////////////////////////////////////////////////////////////
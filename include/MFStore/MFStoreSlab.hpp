@@ -0,0 +1,165 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSlab.hpp
+
+   File Description  :  Include file for the MFStoreSlab class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreSlab_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreSlab_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreSlab.hpp
+
+   \brief   Definition of the MFStoreSlab class, which implements a persistent
+            fixed-size slot allocator within an MFStore section.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <atomic>
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A slot handle is the index of the slot within its section. Because the
+	first slots of the section hold the slab header, no slot has a handle of
+	zero and so MFStoreSlabNullHandle can never be allocated.
+*/
+using MFStoreSlabHandle = uint64_t;
+
+const MFStoreSlabHandle MFStoreSlabNullHandle = 0;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Resides at the start of a slab section. The free list head is tagged: the
+	low 32 bits hold the index of the first free slot and the high 32 bits a
+	count of updates, which defeats the ABA problem.
+*/
+struct alignas(64) MFStoreSlabHeader
+{
+	static const uint64_t HeaderMagic = 0x31424C415353464DULL;	// "MFSSLAB1"
+
+	uint64_t              magic_;
+	uint64_t              slot_size_;
+	uint64_t              slot_count_;
+	uint64_t              first_slot_;
+	std::atomic<uint64_t> free_head_;
+	std::atomic<uint64_t> next_unused_;
+	std::atomic<uint64_t> alloc_count_;
+	uint64_t              reserved_;
+};
+static_assert(sizeof(MFStoreSlabHeader) == 64,
+	"MFStoreSlabHeader must occupy exactly one cache line.");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+	"MFStoreSlabHeader requires a lock-free (and address-free) 64-bit atomic.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Each element of a slab section is a slot. Slots which have never been
+	allocated are taken from the end of the used portion of the section, so
+	that formatting a slab doesn't touch every slot. Freed slots are kept on
+	a lock-free list linked through their first eight bytes.
+
+	Allocate() and Free() may be called concurrently by any number of writer
+	threads. Freeing a slot twice, or using a slot after it has been freed,
+	corrupts the free list.
+*/
+class MFStoreSlab
+{
+public:
+	MFStoreSlab(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag = false);
+
+	/// Returns MFStoreSlabNullHandle if the slab is full.
+	MFStoreSlabHandle TryAllocate();
+	/// Throws if the slab is full.
+	MFStoreSlabHandle Allocate();
+	void              Free(MFStoreSlabHandle slot_handle);
+
+	uint64_t GetSlotSize() const;
+	uint64_t GetCapacity() const;
+	uint64_t GetAllocatedCount() const;
+
+	MFStoreOff        GetOffset(MFStoreSlabHandle slot_handle) const;
+	MFStoreSlabHandle GetHandle(const void *slot_ptr) const;
+
+	template <typename DatumType>
+		DatumType *GetPtr(MFStoreSlabHandle slot_handle)
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore slab slots must hold trivially copyable types.");
+
+		if (!is_writer_)
+			mfstore_ctl_ptr_->CheckIsWriter();
+
+		return(static_cast<DatumType *>(GetSlotPtr(slot_handle,
+			sizeof(DatumType))));
+	}
+
+	template <typename DatumType>
+		const DatumType *GetPtr(MFStoreSlabHandle slot_handle) const
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"MFStore slab slots must hold trivially copyable types.");
+
+		return(static_cast<const DatumType *>(GetSlotPtr(slot_handle,
+			sizeof(DatumType))));
+	}
+
+	static MFStoreSection MakeSlabSection(uint64_t slot_size,
+		uint64_t slot_count, const std::string &description = "Slab");
+
+private:
+	MFStoreControl    *mfstore_ctl_ptr_;
+	bool               is_writer_;
+	MFStoreOff         section_offset_;
+	char              *section_ptr_;
+	MFStoreSlabHeader *header_ptr_;
+
+	void  CheckHandle(MFStoreSlabHandle slot_handle) const;
+	void *GetSlotPtr(MFStoreSlabHandle slot_handle, std::size_t datum_size)
+		const;
+
+	std::atomic<uint64_t> &GetLink(uint64_t slot_index) const;
+
+	static uint64_t CalcHeaderSlots(uint64_t slot_size);
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreSlab_hpp__HH
+
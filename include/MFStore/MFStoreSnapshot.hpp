@@ -0,0 +1,125 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreSnapshot.hpp
+
+   File Description  :  Include file for point-in-time snapshots of MFStore
+                        files.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreSnapshot_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreSnapshot_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreSnapshot.hpp
+
+   \brief   Declarations of the functions which take point-in-time snapshots
+            of MFStore files.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreNotify.hpp>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Reflink clones the file (with the FICLONE ioctl) and throws if the file
+	system doesn't support it; Copy copies the file section by section; Auto
+	attempts a reflink and copies if it isn't supported.
+*/
+enum class MFStoreSnapshotMode
+{
+	Auto,
+	Reflink,
+	Copy
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreSnapshotStats
+{
+	MFStoreSnapshotStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	bool     reflink_flag_;
+	uint64_t section_count_;
+	uint64_t retry_count_;
+	uint64_t inconsistent_count_;
+	uint64_t byte_count_;
+	uint64_t elapsed_usecs_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Creates a new file holding a point-in-time copy of the MFStore, whose
+	writer may continue to update it, and marks it read-only. The snapshot
+	has the file size and section layout of the source and so may be
+	attached at once with AttachMFStoreSnapshot().
+
+	A reflink shares the data blocks of the source until either file is
+	modified and so takes time proportional to the number of extents rather
+	than to the size of the file. It is supported by XFS and btrfs (among
+	others), but not by ext4, nor across file systems.
+
+	Copying is driven by the section list of the source. If notify_ptr is
+	not null, each section with a slot in that MFStoreNotify is copied again
+	if its generation changed while it was being copied, up to max_attempts
+	times in all; sections still changing after that are counted in
+	inconsistent_count_. Because a writer which advances the generation only
+	after an update could be in the middle of that update throughout a copy,
+	writers which require consistent snapshots should advance it both before
+	and after each update and specify bracketed_flag, so that sections with
+	an odd generation are known to be in the midst of an update.
+
+	A reflink is checked in the same way, against the generations of all of
+	the sections with slots, and the clone is made again if any changed. If
+	they are still changing after max_attempts clones, Auto mode copies the
+	file instead and Reflink mode throws.
+*/
+MFStoreSnapshotStats SnapshotMFStore(const MFStoreControl &src_ctl,
+	const std::string &dst_file_name,
+	MFStoreSnapshotMode snapshot_mode = MFStoreSnapshotMode::Auto,
+	const MFStoreNotify *notify_ptr = nullptr, bool bracketed_flag = false,
+	unsigned int max_attempts = 8);
+
+MFStoreControl AttachMFStoreSnapshot(const MFStoreControl &src_ctl,
+	const std::string &snapshot_file_name);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreSnapshotStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreSnapshot_hpp__HH
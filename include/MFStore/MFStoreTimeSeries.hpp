@@ -0,0 +1,189 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreTimeSeries.hpp
+
+   File Description  :  Include file for the MFStoreTimeSeries class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreTimeSeries_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreTimeSeries_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreTimeSeries.hpp
+
+   \brief   Definition of the MFStoreTimeSeries class, which implements an
+            append-only series of time-stamped records within an MFStore
+            section.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <atomic>
+#include <type_traits>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Resides at the start of a time series section. It is followed by the
+	sparse time index and then, at records_offset_ within the section, by
+	the record slots.
+*/
+struct alignas(64) MFStoreTimeSeriesHeader
+{
+	static const uint64_t HeaderMagic = 0x315245535453464DULL;	// "MFSTSER1"
+
+	uint64_t              magic_;
+	uint64_t              record_size_;
+	uint64_t              slot_size_;
+	uint64_t              record_capacity_;
+	uint64_t              index_interval_;
+	uint64_t              records_offset_;
+	std::atomic<uint64_t> record_count_;
+	std::atomic<uint64_t> last_time_;
+};
+static_assert(sizeof(MFStoreTimeSeriesHeader) == 64,
+	"MFStoreTimeSeriesHeader must occupy exactly one cache line.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	An append-only series of fixed-size records, each stored with a 64-bit
+	time which may not be less than that of the record before it.
+
+	The time of every index_interval-th record is also stored in a sparse
+	index so that FindTime() can locate a time with a binary search of the
+	index followed by one of at most index_interval records.
+
+	A single writer appends records with Append(). Any number of readers,
+	in the writer's process or in others, may search the series and stream
+	records with a Cursor while the writer continues to append: a record
+	becomes visible only once it and its index entry have been completely
+	written.
+*/
+class MFStoreTimeSeries
+{
+public:
+	static const uint64_t DefaultIndexInterval = 4096;
+
+	class Cursor
+	{
+	public:
+		Cursor();
+
+		/// Returns nullptr if the writer has not yet appended the next record.
+		const char *Next(uint64_t &record_time);
+
+		template <typename DatumType>
+			const DatumType *NextDatum(uint64_t &record_time)
+		{
+			return(reinterpret_cast<const DatumType *>(Next(record_time)));
+		}
+
+		uint64_t GetRecordIndex() const;
+
+	private:
+		friend class MFStoreTimeSeries;
+
+		Cursor(const MFStoreTimeSeries *series_ptr, uint64_t record_index);
+
+		const MFStoreTimeSeries *series_ptr_;
+		uint64_t                 record_index_;
+		uint64_t                 available_count_;
+	};
+
+	MFStoreTimeSeries(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		uint64_t record_size, bool format_flag = false,
+		uint64_t index_interval = DefaultIndexInterval);
+
+	void Append(uint64_t record_time, const void *data_ptr);
+
+	template <typename DatumType>
+		void AppendDatum(uint64_t record_time, const DatumType &datum)
+	{
+		static_assert(std::is_trivially_copyable<DatumType>::value,
+			"Time series records must be trivially copyable.");
+
+		CheckDatumSize(sizeof(DatumType));
+
+		Append(record_time, &datum);
+	}
+
+	/// Returns the index of the first record at or after the specified time.
+	uint64_t FindTime(uint64_t record_time) const;
+	Cursor   Seek(uint64_t record_time) const;
+	Cursor   GetCursor(uint64_t record_index = 0) const;
+
+	uint64_t    GetRecordTime(uint64_t record_index) const;
+	const char *GetRecordPtr(uint64_t record_index) const;
+
+	template <typename DatumType>
+		const DatumType *GetDatumPtr(uint64_t record_index) const
+	{
+		return(reinterpret_cast<const DatumType *>(GetRecordPtr(record_index)));
+	}
+
+	uint64_t GetCount() const;
+	uint64_t GetCapacity() const;
+	uint64_t GetRecordSize() const;
+	uint64_t GetIndexInterval() const;
+	/// Both return zero if the series is empty.
+	uint64_t GetFirstTime() const;
+	uint64_t GetLastTime() const;
+
+	static MFStoreSection MakeTimeSeriesSection(uint64_t record_size,
+		uint64_t record_capacity,
+		uint64_t index_interval = DefaultIndexInterval,
+		const std::string &description = "TimeSeries");
+
+private:
+	MFStoreControl          *mfstore_ctl_ptr_;
+	bool                     is_writer_;
+	MFStoreOff               section_offset_;
+	char                    *section_ptr_;
+	MFStoreTimeSeriesHeader *header_ptr_;
+	uint64_t                *index_ptr_;
+	char                    *records_ptr_;
+
+	uint64_t SearchRecords(uint64_t begin_index, uint64_t end_index,
+		uint64_t record_time) const;
+	void     CheckDatumSize(std::size_t datum_size) const;
+
+	char *GetSlotPtr(uint64_t record_index) const
+	{
+		return(records_ptr_ + (record_index * header_ptr_->slot_size_));
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreTimeSeries_hpp__HH
@@ -0,0 +1,303 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreWindowView.hpp
+
+   File Description  :  Include file for the MFStoreWindowView class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreWindowView_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreWindowView_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreWindowView.hpp
+
+   \brief   Definition of the MFStoreWindowView class, which provides access
+            to an MFStore file through a bounded set of fixed-size windows
+            mapped on demand.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreWindow
+{
+	MFStoreWindow(const FileMapping &file_mapping, bool is_writer,
+		uint64_t window_index, MFStoreOff window_offset,
+		MFStoreLen window_length, const MFStoreMapPolicy &map_policy);
+
+	bool Contains(MFStoreOff datum_offset, MFStoreLen datum_length) const
+	{
+		return((datum_offset >= window_offset_) &&
+			((datum_offset + datum_length) <= (window_offset_ + window_length_)));
+	}
+
+	char *GetPtr(MFStoreOff datum_offset) const
+	{
+		return(static_cast<char *>(region_.get_address()) +
+			(datum_offset - window_offset_));
+	}
+
+	uint64_t     window_index_;
+	MFStoreOff   window_offset_;
+	MFStoreLen   window_length_;
+	MappedRegion region_;
+};
+using MFStoreWindowSPtr = std::shared_ptr<MFStoreWindow>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreWindowViewStats
+{
+	MFStoreWindowViewStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t hit_count_;
+	uint64_t map_count_;
+	uint64_t evict_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+template <typename DatumType> class MFStoreWindowIterator;
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Window \e n covers the file from offset (\e n * window_size) for
+	(window_size + window_overlap) bytes, so any datum no longer than the
+	overlap is always wholly within a single window. Window sizes are a
+	multiple of the allocation granularity; the overlap is rounded up to a
+	multiple of the page size.
+
+	At most max_windows windows are retained by the view in least-recently
+	used order. A window evicted from the view remains mapped until the last
+	MFStoreWindowSPtr (including those held by iterators) referring to it is
+	released.
+*/
+class MFStoreWindowView
+{
+public:
+	MFStoreWindowView(const std::string &file_name, bool is_writer,
+		MFStoreLen window_size, std::size_t max_windows,
+		MFStoreLen window_overlap = 0, MFStoreLen file_size = 0,
+		const MFStoreMapPolicy &map_policy = MFStoreMapPolicy());
+
+	const std::string &GetFileName() const;
+	bool               IsWriter() const;
+	MFStoreLen         GetFileSize() const;
+	MFStoreLen         GetWindowSize() const;
+	MFStoreLen         GetWindowOverlap() const;
+	std::size_t        GetMaxWindows() const;
+	std::size_t        GetWindowCount() const;
+
+	MFStoreWindowSPtr GetWindow(MFStoreOff datum_offset,
+		MFStoreLen datum_length = 1);
+
+	template <typename DatumType>
+		DatumType *GetPtr(MFStoreOff datum_offset,
+			MFStoreWindowSPtr &window_sptr)
+	{
+		window_sptr = GetWindow(datum_offset, sizeof(DatumType));
+
+		return(reinterpret_cast<DatumType *>(window_sptr->GetPtr(datum_offset)));
+	}
+
+	template <typename DatumType>
+		MFStoreWindowIterator<DatumType> SectionBegin(
+			const MFStoreSection &section);
+	template <typename DatumType>
+		MFStoreWindowIterator<DatumType> SectionEnd(
+			const MFStoreSection &section);
+
+	void                   ReleaseWindows();
+	MFStoreWindowViewStats GetStats() const;
+
+private:
+	using WindowLruList = std::list<MFStoreWindowSPtr>;
+	using WindowLruMap  =
+		std::unordered_map<uint64_t, WindowLruList::iterator>;
+
+	FileMapping            file_mapping_;
+	std::string            file_name_;
+	bool                   is_writer_;
+	MFStoreLen             file_size_;
+	MFStoreLen             window_size_;
+	MFStoreLen             window_overlap_;
+	std::size_t            max_windows_;
+	MFStoreMapPolicy       map_policy_;
+	mutable std::mutex     lru_mutex_;
+	WindowLruList          lru_list_;
+	WindowLruMap           lru_map_;
+	MFStoreWindowViewStats stats_;
+
+	void CheckSectionForIterator(const MFStoreSection &section,
+		std::size_t datum_size) const;
+
+	MFStoreWindowView(const MFStoreWindowView &) = delete;
+	MFStoreWindowView & operator = (const MFStoreWindowView &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A forward iterator over the elements of a section which re-fetches its
+	window from the view only when it steps off the end of the current one.
+*/
+template <typename DatumType>
+	class MFStoreWindowIterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type        = DatumType;
+	using difference_type   = std::ptrdiff_t;
+	using pointer           = DatumType *;
+	using reference         = DatumType &;
+
+	MFStoreWindowIterator()
+		:view_ptr_(nullptr)
+		,section_offset_(0)
+		,element_size_(0)
+		,element_index_(0)
+		,window_sptr_()
+	{
+	}
+
+	MFStoreWindowIterator(MFStoreWindowView &view,
+		const MFStoreSection &section, uint64_t element_index)
+		:view_ptr_(&view)
+		,section_offset_(section.section_offset_)
+		,element_size_(section.element_size_)
+		,element_index_(element_index)
+		,window_sptr_()
+	{
+	}
+
+	reference operator * ()
+	{
+		return(*GetCurrentPtr());
+	}
+
+	pointer operator -> ()
+	{
+		return(GetCurrentPtr());
+	}
+
+	MFStoreWindowIterator &operator ++ ()
+	{
+		++element_index_;
+
+		return(*this);
+	}
+
+	MFStoreWindowIterator operator ++ (int)
+	{
+		MFStoreWindowIterator tmp_iter(*this);
+
+		++element_index_;
+
+		return(tmp_iter);
+	}
+
+	bool operator == (const MFStoreWindowIterator &other) const
+	{
+		return((section_offset_ == other.section_offset_) &&
+			(element_index_ == other.element_index_));
+	}
+
+	bool operator != (const MFStoreWindowIterator &other) const
+	{
+		return(!(*this == other));
+	}
+
+	uint64_t GetElementIndex() const
+	{
+		return(element_index_);
+	}
+
+private:
+	MFStoreWindowView *view_ptr_;
+	MFStoreOff         section_offset_;
+	MFStoreLen         element_size_;
+	uint64_t           element_index_;
+	MFStoreWindowSPtr  window_sptr_;
+
+	pointer GetCurrentPtr()
+	{
+		MFStoreOff datum_offset = section_offset_ +
+			(element_index_ * element_size_);
+
+		if ((!window_sptr_) ||
+			(!window_sptr_->Contains(datum_offset, sizeof(DatumType))))
+			window_sptr_ = view_ptr_->GetWindow(datum_offset, sizeof(DatumType));
+
+		return(reinterpret_cast<pointer>(window_sptr_->GetPtr(datum_offset)));
+	}
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	MFStoreWindowIterator<DatumType> MFStoreWindowView::SectionBegin(
+		const MFStoreSection &section)
+{
+	CheckSectionForIterator(section, sizeof(DatumType));
+
+	return(MFStoreWindowIterator<DatumType>(*this, section, 0));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+template <typename DatumType>
+	MFStoreWindowIterator<DatumType> MFStoreWindowView::SectionEnd(
+		const MFStoreSection &section)
+{
+	CheckSectionForIterator(section, sizeof(DatumType));
+
+	return(MFStoreWindowIterator<DatumType>(*this, section,
+		section.element_count_));
+}
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreWindowViewStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreWindowView_hpp__HH
+
@@ -0,0 +1,197 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB MFStore Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  MFStoreWriterLease.hpp
+
+   File Description  :  Include file for the MFStoreWriterLease class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__MFStore__MFStoreWriterLease_hpp__HH
+
+#define HH__MLB__MFStore__MFStoreWriterLease_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file MFStoreWriterLease.hpp
+
+   \brief   Definition of the MFStoreWriterLease class, which grants the right
+            to write to an MFStore to one process at a time and passes it to a
+            standby when the holder stops renewing it.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <MFStore/MFStoreControl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace MFStore {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Resides in the lease section. The lease word holds the time of the last
+	heartbeat, in milliseconds after base_time_ms_ plus one (so that zero
+	means the lease was released), in its upper 40 bits and the epoch in its
+	lower 24 bits. Because both change together, a heartbeat by the holder
+	and a takeover by a standby can't both succeed.
+
+	The owner fields are informational and describe the holder of the epoch
+	in owner_epoch_.
+*/
+struct alignas(64) MFStoreWriterLeaseRecord
+{
+	static const uint64_t RecordMagic = 0x455341454C53464DULL;	// "MFSLEASE"
+
+	uint64_t              magic_;
+	uint64_t              base_time_ms_;
+	uint64_t              lease_timeout_ms_;
+	std::atomic<uint64_t> lease_word_;
+	std::atomic<uint64_t> owner_epoch_;
+	uint64_t              owner_pid_;
+	uint64_t              reserved_[2];
+	char                  owner_host_[64];
+};
+static_assert(sizeof(MFStoreWriterLeaseRecord) == 128,
+	"MFStoreWriterLeaseRecord must occupy exactly two cache lines.");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+	"MFStoreWriterLeaseRecord requires a lock-free (and address-free) 64-bit "
+	"atomic.");
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct MFStoreWriterLeaseState
+{
+	MFStoreWriterLeaseState();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t    epoch_;
+	/// Milliseconds since the UNIX epoch, or zero if the lease was released.
+	uint64_t    heartbeat_ms_;
+	uint64_t    owner_pid_;
+	std::string owner_host_;
+	bool        live_flag_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A lease on the right to write to an MFStore, kept in a section of the
+	store so that every process mapping it sees the same lease.
+
+	A writer calls TryAcquire() or Acquire() and then renews the lease by
+	calling Heartbeat() (or by running StartHeartbeat()) more often than the
+	lease timeout. A standby opens the store as a writer and blocks in
+	Acquire(), which succeeds once the holder has released the lease or has
+	failed to renew it within the timeout. Each acquisition advances the
+	epoch, so a former holder which resumes after a stall finds that its
+	next heartbeat fails and must stop writing, and readers may detect the
+	change of writer by comparing epochs.
+
+	The lease timeout is set when the section is formatted. Heartbeat times
+	are taken from the system clock, and so the clocks of the hosts sharing
+	the store must agree to well within the timeout.
+
+	Unlike GetWriterAdvisoryLock(), the lease doesn't prevent another
+	process from opening the store as a writer; writers must co-operate by
+	writing only while IsHeld() returns true. IsHeld() returns false once
+	seven eighths of the lease timeout has passed since the last successful
+	heartbeat, so that a stalled holder stops writing before a standby may
+	take over.
+*/
+class MFStoreWriterLease
+{
+public:
+	using Clock        = std::chrono::steady_clock;
+	using LeaseTimeout = std::chrono::milliseconds;
+	using LostCallback = std::function<void (uint64_t lost_epoch)>;
+
+	static const uint64_t DefaultLeaseTimeoutMs = 500;
+
+	MFStoreWriterLease(MFStoreControl &mfstore_ctl, std::size_t section_index,
+		bool format_flag = false,
+		const LeaseTimeout &lease_timeout =
+			LeaseTimeout(DefaultLeaseTimeoutMs));
+	~MFStoreWriterLease();
+
+	bool TryAcquire();
+	/// Returns false if the lease couldn't be acquired within the wait timeout.
+	bool Acquire(const LeaseTimeout &wait_timeout = LeaseTimeout::max());
+	/// Returns false if the lease has been lost.
+	bool Heartbeat();
+	void Release();
+
+	/// The default interval is one quarter of the lease timeout.
+	void StartHeartbeat(const LeaseTimeout &heartbeat_interval = LeaseTimeout(0),
+		const LostCallback &lost_callback = LostCallback());
+	void StopHeartbeat();
+
+	bool     IsHeld() const;
+	uint64_t GetHeldEpoch() const;
+	uint64_t GetEpoch() const;
+	bool     IsWriterLive() const;
+
+	MFStoreWriterLeaseState GetState() const;
+	LeaseTimeout            GetLeaseTimeout() const;
+
+	static MFStoreSection MakeLeaseSection(
+		const std::string &description = "WriterLease");
+
+private:
+	MFStoreControl           *mfstore_ctl_ptr_;
+	MFStoreWriterLeaseRecord *record_ptr_;
+	std::atomic<uint64_t>     held_epoch_;
+	/// The steady clock time taken before the last successful heartbeat.
+	std::atomic<Clock::rep>   renewed_time_;
+	std::mutex                thread_mutex_;
+	std::condition_variable   thread_cv_;
+	bool                      stop_flag_;
+	std::thread               heartbeat_thread_;
+
+	uint64_t     GetLeaseTime() const;
+	LeaseTimeout GetHeldTimeout() const;
+	bool         IsExpired(uint64_t lease_word, uint64_t lease_time) const;
+	void         HeartbeatThread(LeaseTimeout heartbeat_interval,
+		LostCallback lost_callback);
+
+	MFStoreWriterLease(const MFStoreWriterLease &) = delete;
+	MFStoreWriterLease & operator = (const MFStoreWriterLease &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const MFStoreWriterLeaseState &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace MFStore
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__MFStore__MFStoreWriterLease_hpp__HH
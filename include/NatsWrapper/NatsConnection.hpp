@@ -38,6 +38,7 @@
 
 #include <NatsWrapper/NatsOptions.hpp>
 
+#include <NatsWrapper/NatsSubject.hpp>
 #include <NatsWrapper/NatsSubscription.hpp>
 
 #include <string>
@@ -77,6 +78,12 @@ public:
 		std::size_t data_length);
 	void Publish(const char *subject_name, const void *data_ptr,
 		std::size_t data_length);
+	/**
+		The subject was validated on construction, and so is checked only to
+		ensure that it has no wildcard token.
+	*/
+	void Publish(const NatsSubject &subject, const void *data_ptr,
+		std::size_t data_length);
 
 	void PublishString(const char *subject_name, const char *str);
 	void PublishString(const std::string &subject_name, const std::string &str);
@@ -88,6 +95,9 @@ public:
 	void PublishRequest(const std::string &send_subject,
 		const std::string &reply_subject, const void *data_ptr,
 		std::size_t data_length);
+	void PublishRequest(const NatsSubject &send_subject,
+		const NatsSubject &reply_subject, const void *data_ptr,
+		std::size_t data_length);
 
 	void PublishRequestString(const char *send_subject,
 		const char *reply_subject, const char *str);
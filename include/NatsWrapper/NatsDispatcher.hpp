@@ -0,0 +1,202 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsDispatcher.hpp
+
+   File Description  :  Include file for the NatsDispatcher class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsDispatcher_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsDispatcher_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsDispatcher.hpp
+
+   \brief   Main include file for the NatsDispatcher class, which processes
+            received messages on a pool of threads while preserving their
+            order for each subject or key.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsConnection.hpp>
+#include <NatsWrapper/NatsMsg.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+/// Processes a message on one of the threads of the dispatcher.
+using NatsDispatchHandlerFunc = std::function<void (NatsMsg &nats_msg)>;
+
+/**
+	Returns the ordering key of a message. Messages with the same key are
+	processed one at a time in the order in which they were dispatched.
+*/
+using NatsDispatchKeyFunc =
+	std::function<std::size_t (const NatsMsg &nats_msg)>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsDispatcherStats
+{
+	NatsDispatcherStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t dispatch_count_;
+	uint64_t process_count_;
+	uint64_t steal_count_;
+	uint64_t error_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Hands received messages to a pool of worker threads so that a slow
+	handler for one subject doesn't delay the messages of other subjects.
+
+	Each message is placed on one of a fixed number of strands, selected by
+	the hash of its key (by default, its subject). A strand is run by at
+	most one worker at a time and its messages are processed in order, so
+	that ordering is preserved for each key. Keys which hash to the same
+	strand are also ordered with respect to each other.
+
+	A strand with messages to process is placed on the run queue of the
+	worker associated with it, which takes strands from the front of its own
+	queue. Workers with empty queues steal strands from the back of the
+	queues of other workers. A worker returns a strand to its queue after
+	processing a limited number of its messages, so that one busy key can't
+	monopolize a worker.
+
+	Exceptions thrown by the handler are counted in the statistics rather
+	than propagated, as they occur on the worker threads.
+*/
+class NatsDispatcher
+{
+public:
+	static const std::size_t DefaultStrandCount  = 1024;
+	static const std::size_t StrandBatchLimit    = 64;
+
+	NatsDispatcher(const NatsDispatchHandlerFunc &handler_func,
+		unsigned int thread_count = 0,
+		const NatsDispatchKeyFunc &key_func = NatsDispatchKeyFunc(),
+		std::size_t strand_count = DefaultStrandCount);
+
+	/// Processes any messages already dispatched before returning.
+	virtual ~NatsDispatcher();
+
+	/// Takes ownership of the message.
+	void Dispatch(natsMsg *nats_msg_ptr);
+
+	/// Subscribes with a callback which dispatches to this object.
+	NatsSubscription Subscribe(NatsConnection &nats_conn,
+		const std::string &subject_name);
+
+	/**
+		Waits until all messages dispatched have been processed. Returns false
+		on timeout.
+	*/
+	bool Drain(std::chrono::microseconds time_out);
+
+	/// Processes any messages already dispatched and ends the threads.
+	void Stop();
+
+	unsigned int        GetThreadCount() const;
+	std::size_t         GetStrandCount() const;
+	NatsDispatcherStats GetStats() const;
+
+	/// The NATS callback. The closure is a pointer to the dispatcher.
+	static void NatsMsgHandler(natsConnection *nats_conn_ptr,
+		natsSubscription *nats_subs_ptr, natsMsg *nats_msg_ptr,
+		void *closure_ptr);
+
+private:
+	struct Strand
+	{
+		Strand();
+
+		std::mutex          strand_mutex_;
+		std::deque<NatsMsg> msg_queue_;
+		bool                scheduled_flag_;
+		std::size_t         worker_index_;
+	};
+
+	struct Worker
+	{
+		Worker();
+
+		std::mutex           run_mutex_;
+		std::deque<Strand *> run_queue_;
+		std::thread          worker_thread_;
+	};
+
+	NatsDispatchHandlerFunc              handler_func_;
+	NatsDispatchKeyFunc                  key_func_;
+	std::vector<std::unique_ptr<Strand>> strand_list_;
+	std::vector<std::unique_ptr<Worker>> worker_list_;
+	std::atomic<uint64_t>                runnable_count_;
+	std::atomic<uint64_t>                pending_count_;
+	std::atomic<unsigned int>            idle_count_;
+	std::atomic<bool>                    stop_flag_;
+	std::mutex                           idle_mutex_;
+	std::condition_variable              idle_cv_;
+	std::atomic<uint64_t>                dispatch_count_;
+	std::atomic<uint64_t>                process_count_;
+	std::atomic<uint64_t>                steal_count_;
+	std::atomic<uint64_t>                error_count_;
+
+	std::size_t GetKey(const NatsMsg &nats_msg) const;
+	void        Schedule(Strand *strand_ptr, std::size_t worker_index);
+	Strand     *TakeStrand(std::size_t worker_index);
+	void        RunStrand(Strand *strand_ptr, std::size_t worker_index);
+	void        WorkerThread(std::size_t worker_index);
+
+	NatsDispatcher(const NatsDispatcher &) = delete;
+	NatsDispatcher & operator = (const NatsDispatcher &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsDispatcherStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsDispatcher_hpp__HH
+
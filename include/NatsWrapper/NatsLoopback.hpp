@@ -0,0 +1,249 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsLoopback.hpp
+
+   File Description  :  Include file for the NatsLoopback class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsLoopback_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsLoopback_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsLoopback.hpp
+
+   \brief   Main include file for the NatsLoopback class, which routes
+            messages between publishers and subscribers within a process.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsMsg.hpp>
+#include <NatsWrapper/NatsPublishQueue.hpp>
+#include <NatsWrapper/NatsSubject.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+class NatsLoopbackSubscription;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsLoopbackStats
+{
+	NatsLoopbackStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t    publish_count_;
+	uint64_t    deliver_count_;
+	uint64_t    drop_count_;
+	uint64_t    no_interest_count_;
+	std::size_t subscription_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Delivers messages between publishers and subscribers in the same process
+	without a NATS server, so that messaging code can be tested in isolation
+	and its own overhead measured apart from that of the network.
+
+	Subscription subjects may contain the '*' and '>' wildcards, and
+	subscriptions with the same queue group share the messages on their
+	subject so that each is received by only one of them. Request/reply
+	works as it does with a server, except that a request for which there
+	are no subscriptions fails at once with \c NATS_NO_RESPONDERS.
+
+	Each subscription has a bounded lock-free queue of messages. A message
+	published when that queue is full is dropped for that subscription, as
+	a server does for a slow consumer. Messages for asynchronous
+	subscriptions are delivered to the callback on a thread belonging to the
+	subscription, in the order published. The callback takes ownership of
+	the message as it does with the NATS library, and receives null
+	connection and subscription pointers.
+
+	The messages delivered are ordinary NATS messages, so that NatsMsg,
+	NatsMsgPool and NatsDispatcher may be used with them unchanged, and
+	GetPublishFunc() allows a NatsPublishQueue to publish to the loopback.
+
+	All subscriptions must be destroyed before the loopback.
+*/
+class NatsLoopback
+{
+public:
+	static const std::size_t DefaultQueueCapacity = 65536;
+
+	/// The queue capacity of each subscription is rounded up to a power of 2.
+	explicit NatsLoopback(std::size_t queue_capacity = DefaultQueueCapacity);
+
+	virtual ~NatsLoopback();
+
+	/// Returns the number of subscriptions which received the message.
+	std::size_t Publish(const char *subject_name,
+		std::size_t subject_name_length, const void *data_ptr,
+		std::size_t data_length);
+	std::size_t Publish(const std::string_view &subject_name,
+		const void *data_ptr, std::size_t data_length);
+	std::size_t Publish(const std::string &subject_name, const void *data_ptr,
+		std::size_t data_length);
+	std::size_t Publish(const char *subject_name, const void *data_ptr,
+		std::size_t data_length);
+	std::size_t Publish(const NatsSubject &subject, const void *data_ptr,
+		std::size_t data_length);
+
+	std::size_t PublishRequest(const char *send_subject,
+		const char *reply_subject, const void *data_ptr,
+		std::size_t data_length);
+	std::size_t PublishRequest(const std::string &send_subject,
+		const std::string &reply_subject, const void *data_ptr,
+		std::size_t data_length);
+
+	/**
+		Publishes a request and waits up to \e time_out milliseconds for the
+		reply. Throws a NatsExceptionStatus with \c NATS_TIMEOUT or
+		\c NATS_NO_RESPONDERS if there is no reply.
+	*/
+	NatsMsg Request(const char *subject_name, const void *data_ptr,
+		std::size_t data_length, int64_t time_out);
+	NatsMsg Request(const std::string &subject_name, const void *data_ptr,
+		std::size_t data_length, int64_t time_out);
+
+	NatsLoopbackSubscription Subscribe(const std::string &subject_name,
+		natsMsgHandler call_back, void *closure = nullptr);
+	NatsLoopbackSubscription QueueSubscribe(const std::string &subject_name,
+		const std::string &queue_group, natsMsgHandler call_back,
+		void *closure = nullptr);
+	NatsLoopbackSubscription SubscribeSync(const std::string &subject_name);
+	NatsLoopbackSubscription QueueSubscribeSync(const std::string &subject_name,
+		const std::string &queue_group);
+
+	/// The returned function must not be used after the loopback is destroyed.
+	NatsPublishFunc   GetPublishFunc();
+
+	std::size_t       GetQueueCapacity() const;
+	NatsLoopbackStats GetStats() const;
+
+private:
+	friend class NatsLoopbackSubscription;
+
+	struct Subscriber;
+
+	using SubscriberList = std::vector<Subscriber *>;
+
+	std::size_t                                  queue_capacity_;
+	mutable std::shared_mutex                    route_mutex_;
+	std::map<std::string, SubscriberList, std::less<>>
+	                                             literal_map_;
+	SubscriberList                               wildcard_list_;
+	std::size_t                                  subscription_count_;
+	std::atomic<uint64_t>                        next_inbox_;
+	std::atomic<uint64_t>                        queue_select_;
+	std::atomic<uint64_t>                        publish_count_;
+	std::atomic<uint64_t>                        deliver_count_;
+	std::atomic<uint64_t>                        drop_count_;
+	std::atomic<uint64_t>                        no_interest_count_;
+
+	NatsLoopbackSubscription AddSubscriber(const std::string &subject_name,
+		const std::string &queue_group, natsMsgHandler call_back,
+		void *closure);
+	void                     RemoveSubscriber(Subscriber *subscriber_ptr);
+	std::size_t              Route(const char *subject_name,
+		const std::string_view &subject_view, const char *reply_subject,
+		const void *data_ptr, std::size_t data_length);
+	bool                     Deliver(Subscriber *subscriber_ptr,
+		const char *subject_name, const char *reply_subject,
+		const void *data_ptr, std::size_t data_length);
+
+	NatsLoopback(const NatsLoopback &) = delete;
+	NatsLoopback & operator = (const NatsLoopback &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A subscription to a NatsLoopback. Copies refer to the same subscription,
+	which is unsubscribed when the last of them is destroyed.
+*/
+class NatsLoopbackSubscription
+{
+public:
+	NatsLoopbackSubscription();
+
+	virtual ~NatsLoopbackSubscription();
+
+	/**
+		Returns a hollow NatsMsg upon timeout. Only synchronous subscriptions
+		may be read.
+	*/
+	NatsMsg NextMsg(int64_t time_out);
+
+	/// As NatsSubscription::NextMsgs().
+	natsStatus NextMsgs(NatsMsg *msg_array, std::size_t max_count,
+		int64_t time_out, std::size_t &msg_count);
+	natsStatus NextMsgs(std::vector<NatsMsg> &msg_list, std::size_t max_count,
+		int64_t time_out);
+
+	/// Stops delivery. Messages still queued are discarded.
+	void Unsubscribe();
+
+	const std::string &GetSubject() const;
+	const std::string &GetQueueGroup() const;
+	std::size_t        GetPendingCount() const;
+	uint64_t           GetDropCount() const;
+	bool               IsEmpty() const;
+
+private:
+	friend class NatsLoopback;
+
+	std::shared_ptr<NatsLoopback::Subscriber> subscriber_sptr_;
+
+	explicit NatsLoopbackSubscription(
+		const std::shared_ptr<NatsLoopback::Subscriber> &subscriber_sptr);
+
+	NatsLoopback::Subscriber &GetSubscriberChecked() const;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsLoopbackStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsLoopback_hpp__HH
+
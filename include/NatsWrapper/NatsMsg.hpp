@@ -39,6 +39,7 @@
 #include <NatsWrapper/NatsSubscription.hpp>
 
 #include <string>
+#include <string_view>
 
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -47,31 +48,53 @@ namespace MLB {
 namespace NatsWrapper {
 
 // ////////////////////////////////////////////////////////////////////////////
+/**
+	Owns a single NATS message, which it destroys. Instances may be moved but
+	not copied, so that no allocation or reference counting is performed for
+	each message received.
+*/
 class NatsMsg
 {
-	NatsMsg(natsMsg *nats_msg);
-
-	friend NatsMsg NatsSubscription::NextMsg(int64_t time_out);
-
 public:
+	/// Takes ownership of the message, which may be NULL.
+	explicit NatsMsg(natsMsg *nats_msg = nullptr) noexcept;
 	NatsMsg(NatsSubscription &nats_subs, int64_t time_out);
+	NatsMsg(NatsMsg &&other) noexcept;
 
 	virtual ~NatsMsg();
 
+	NatsMsg & operator = (NatsMsg &&other) noexcept;
+
 	const char *GetSubject() const;
 	const char *GetReply() const;
 	const char *GetData() const;
 	int         GetDataLength() const;
 
+	/// The reply view is empty if the message has no reply subject.
+	std::string_view GetSubjectView() const;
+	std::string_view GetReplyView() const;
+	std::string_view GetDataView() const;
+
 	bool        IsNoResponders() const;
 
+	/// True for the hollow message returned upon timeout.
+	bool        IsEmpty() const;
+
 	      natsMsg    *GetPtr();
 	const natsMsg    *GetPtr() const;
 	      natsMsg    *GetPtrChecked();
 	const natsMsg    *GetPtrChecked() const;
 
+	/// Relinquishes ownership of the message without destroying it.
+	natsMsg *Release() noexcept;
+	/// Destroys the message, if any, and takes ownership of another.
+	void     Reset(natsMsg *nats_msg = nullptr) noexcept;
+
 private:
-	std::shared_ptr<natsMsg> nats_msg_sptr_;
+	natsMsg *nats_msg_ptr_;
+
+	NatsMsg(const NatsMsg &) = delete;
+	NatsMsg & operator = (const NatsMsg &) = delete;
 };
 // ////////////////////////////////////////////////////////////////////////////
 
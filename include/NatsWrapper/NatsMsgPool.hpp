@@ -0,0 +1,179 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsMsgPool.hpp
+
+   File Description  :  Include file for the NatsMsgPool class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsMsgPool_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsMsgPool_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsMsgPool.hpp
+
+   \brief   Main include file for the NatsMsgPool class, which copies received
+            messages into reusable buffers, and the NatsPooledMsg class.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsMsg.hpp>
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+class NatsPooledMsg;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsMsgPoolStats
+{
+	NatsMsgPoolStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t    copy_count_;
+	uint64_t    allocate_count_;
+	uint64_t    shrink_count_;
+	std::size_t free_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Copies messages into buffers which are returned to the pool when the
+	NatsPooledMsg which refers to them is destroyed, so that once the pool
+	has grown to the number of messages outstanding at once no further
+	allocation is performed.
+
+	Copying a received message lets the NATS message be destroyed at once
+	while its contents are retained, for example in a queue. Buffers which
+	have grown beyond \e max_retained_length bytes are shrunk when they are
+	returned, which bounds the memory held by the pool.
+
+	All NatsPooledMsg instances must be destroyed before the pool.
+*/
+class NatsMsgPool
+{
+public:
+	static const std::size_t DefaultMaxRetainedLength = 64 * 1024;
+
+	explicit NatsMsgPool(std::size_t initial_count = 0,
+		std::size_t max_retained_length = DefaultMaxRetainedLength);
+
+	virtual ~NatsMsgPool();
+
+	NatsPooledMsg Copy(const NatsMsg &nats_msg);
+	NatsPooledMsg Copy(const std::string_view &subject_name,
+		const std::string_view &reply_name, const std::string_view &data);
+
+	NatsMsgPoolStats GetStats() const;
+
+private:
+	friend class NatsPooledMsg;
+
+	struct Buffer
+	{
+		std::vector<char> buffer_data_;
+		std::size_t       subject_length_;
+		std::size_t       reply_length_;
+		std::size_t       data_length_;
+		Buffer           *next_free_ptr_;
+	};
+
+	std::size_t                          max_retained_length_;
+	mutable std::mutex                   pool_mutex_;
+	std::vector<std::unique_ptr<Buffer>> buffer_list_;
+	Buffer                              *free_list_ptr_;
+	std::size_t                          free_count_;
+	uint64_t                             copy_count_;
+	uint64_t                             shrink_count_;
+
+	Buffer *AcquireBuffer();
+	void    ReleaseBuffer(Buffer *buffer_ptr);
+
+	NatsMsgPool(const NatsMsgPool &) = delete;
+	NatsMsgPool & operator = (const NatsMsgPool &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A copy of a message held in a buffer of a NatsMsgPool. Instances may be
+	moved but not copied.
+*/
+class NatsPooledMsg
+{
+public:
+	NatsPooledMsg() noexcept;
+	NatsPooledMsg(NatsPooledMsg &&other) noexcept;
+
+	/// Returns the buffer to the pool.
+	~NatsPooledMsg();
+
+	NatsPooledMsg & operator = (NatsPooledMsg &&other) noexcept;
+
+	std::string_view GetSubject() const;
+	std::string_view GetReply() const;
+	std::string_view GetData() const;
+
+	bool             IsEmpty() const;
+
+	void             Reset() noexcept;
+
+private:
+	friend class NatsMsgPool;
+
+	NatsMsgPool         *pool_ptr_;
+	NatsMsgPool::Buffer *buffer_ptr_;
+
+	NatsPooledMsg(NatsMsgPool *pool_ptr, NatsMsgPool::Buffer *buffer_ptr)
+		noexcept;
+
+	const NatsMsgPool::Buffer &GetBufferChecked() const;
+
+	NatsPooledMsg(const NatsPooledMsg &) = delete;
+	NatsPooledMsg & operator = (const NatsPooledMsg &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsMsgPoolStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsMsgPool_hpp__HH
+
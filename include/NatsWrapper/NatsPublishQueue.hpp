@@ -0,0 +1,246 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsPublishQueue.hpp
+
+   File Description  :  Include file for the NatsPublishQueue class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsPublishQueue_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsPublishQueue_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsPublishQueue.hpp
+
+   \brief   Main include file for the NatsPublishQueue class, which publishes
+            messages on a dedicated thread.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsConnection.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Determines what Enqueue() does when the queue is full.
+*/
+enum class NatsPublishQueuePolicy
+{
+	/// Waits until the publishing thread has made room.
+	Block,
+	/// Discards the message being enqueued.
+	DropNewest,
+	/// Discards the oldest message in the queue to make room.
+	DropOldest
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Publishes a single message. The subject name is NUL-terminated. Invoked
+	only on the publishing thread of the queue.
+*/
+using NatsPublishFunc = std::function<natsStatus (const char *subject_name,
+	const void *data_ptr, int data_length)>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsPublishQueueParams
+{
+	static const std::size_t DefaultQueueCapacity     = 65536;
+	static const std::size_t DefaultMaxSubjectLength  = 255;
+	static const std::size_t DefaultMaxPayloadLength  = 1024;
+	static const std::size_t DefaultMaxBatchCount     = 256;
+
+	NatsPublishQueueParams();
+
+	/// Rounded up to a power of two.
+	std::size_t               queue_capacity_;
+	std::size_t               max_subject_length_;
+	std::size_t               max_payload_length_;
+	NatsPublishQueuePolicy    policy_;
+	/// The longest the publishing thread waits for a batch to fill.
+	std::chrono::microseconds latency_budget_;
+	std::size_t               max_batch_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsPublishQueueStats
+{
+	NatsPublishQueueStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t   enqueue_count_;
+	uint64_t   publish_count_;
+	uint64_t   drop_count_;
+	uint64_t   block_count_;
+	uint64_t   batch_count_;
+	uint64_t   error_count_;
+	natsStatus last_error_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Publishes messages asynchronously.
+
+	Enqueue() copies the subject and payload of a message into a slot of a
+	bounded lock-free queue and returns without making any NATS library call.
+	A dedicated thread removes messages in batches of up to
+	\e max_batch_count_ messages and publishes them directly from their
+	slots. When the latency budget is not zero, the thread waits up to that
+	long after the first message of a batch arrives so that a burst may be
+	published together.
+
+	The memory used is fixed at construction: one slot of
+	\e max_subject_length_ plus \e max_payload_length_ bytes for each entry
+	of the queue. Messages which don't fit in a slot are rejected. When the
+	queue is full, the policy determines whether the caller waits or a
+	message is dropped.
+
+	Errors returned by the publish function are counted in the statistics
+	rather than thrown, as they occur on the publishing thread.
+*/
+class NatsPublishQueue
+{
+public:
+	/// The connection must outlive the queue.
+	explicit NatsPublishQueue(NatsConnection &nats_conn,
+		const NatsPublishQueueParams &params = NatsPublishQueueParams());
+	explicit NatsPublishQueue(const NatsPublishFunc &publish_func,
+		const NatsPublishQueueParams &params = NatsPublishQueueParams());
+
+	/// Publishes any messages remaining in the queue before returning.
+	virtual ~NatsPublishQueue();
+
+	/// Returns false if the policy caused the message to be dropped.
+	bool Enqueue(const char *subject_name, std::size_t subject_name_length,
+		const void *data_ptr, std::size_t data_length);
+	bool Enqueue(const std::string_view &subject_name, const void *data_ptr,
+		std::size_t data_length);
+	bool Enqueue(const std::string &subject_name, const void *data_ptr,
+		std::size_t data_length);
+	bool Enqueue(const char *subject_name, const void *data_ptr,
+		std::size_t data_length);
+	/**
+		Only a reference to the subject is queued, so the subject must remain
+		valid until the message has been published, as is the case for those
+		interned by a NatsSubjectPool.
+	*/
+	bool Enqueue(const NatsSubject &subject, const void *data_ptr,
+		std::size_t data_length);
+
+	/**
+		Waits until as many messages as had been enqueued at the time of the
+		call have been published or dropped. Returns false on timeout.
+	*/
+	bool Flush(std::chrono::microseconds time_out);
+
+	/// Publishes any messages remaining in the queue and ends the thread.
+	void Stop();
+
+	const NatsPublishQueueParams &GetParams() const;
+	std::size_t                   GetCapacity() const;
+	std::size_t                   GetApproximateCount() const;
+	NatsPublishQueueStats         GetStats() const;
+
+private:
+	struct SlotHeader
+	{
+		std::atomic<uint64_t> sequence_;
+		const char           *interned_ptr_;
+		uint32_t              subject_length_;
+		uint32_t              data_length_;
+	};
+
+	NatsPublishFunc         publish_func_;
+	NatsPublishQueueParams  params_;
+	std::size_t             slot_stride_;
+	uint64_t                slot_mask_;
+	std::vector<char>       slot_storage_;
+	char                   *slot_base_ptr_;
+	alignas(64)
+	std::atomic<uint64_t>   enqueue_pos_;
+	alignas(64)
+	std::atomic<uint64_t>   dequeue_pos_;
+	alignas(64)
+	std::atomic<uint64_t>   release_count_;
+	std::atomic<bool>       stop_flag_;
+	std::atomic<bool>       sleeping_flag_;
+	std::mutex              wake_mutex_;
+	std::condition_variable wake_cv_;
+	std::atomic<uint64_t>   enqueue_count_;
+	std::atomic<uint64_t>   publish_count_;
+	std::atomic<uint64_t>   drop_count_;
+	std::atomic<uint64_t>   block_count_;
+	std::atomic<uint64_t>   batch_count_;
+	std::atomic<uint64_t>   error_count_;
+	std::atomic<int>        last_error_;
+	std::thread             publish_thread_;
+
+	bool        EnqueueInternal(const char *subject_name,
+		std::size_t subject_name_length, const char *interned_ptr,
+		const void *data_ptr, std::size_t data_length);
+	SlotHeader *GetSlot(uint64_t slot_pos) const;
+	SlotHeader *TryClaimForEnqueue(uint64_t &slot_pos);
+	SlotHeader *TryClaimForDequeue(uint64_t &slot_pos);
+	void        ReleaseForEnqueue(SlotHeader *slot_ptr, uint64_t slot_pos);
+	void        ReleaseForDequeue(SlotHeader *slot_ptr, uint64_t slot_pos);
+	bool        IsEmpty() const;
+	void        WakePublisher();
+	bool        WaitForMessages();
+	void        PublishBatch();
+	void        PublishThread();
+
+	NatsPublishQueue(const NatsPublishQueue &) = delete;
+	NatsPublishQueue & operator = (const NatsPublishQueue &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsPublishQueueStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsPublishQueue_hpp__HH
+
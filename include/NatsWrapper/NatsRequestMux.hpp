@@ -0,0 +1,240 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsRequestMux.hpp
+
+   File Description  :  Include file for the NatsRequestMux class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsRequestMux_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsRequestMux_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsRequestMux.hpp
+
+   \brief   Main include file for the NatsRequestMux class, which issues
+            concurrent requests over a single inbox subscription.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsConnection.hpp>
+#include <NatsWrapper/NatsInbox.hpp>
+#include <NatsWrapper/NatsMsg.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+# include <coroutine>
+# define NatsWrapper_HAS_COROUTINES 1
+#endif // #if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Invoked once for each request with \c NATS_OK and the reply, or with
+	\c NATS_TIMEOUT, \c NATS_NO_RESPONDERS or \c NATS_CONNECTION_CLOSED and
+	an empty message.
+*/
+using NatsRequestDoneFunc =
+	std::function<void (natsStatus nats_status, NatsMsg &nats_msg)>;
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+struct NatsRequestMuxStats
+{
+	NatsRequestMuxStats();
+
+	std::ostream &ToStream(std::ostream &o_str = std::cout) const;
+
+	uint64_t    request_count_;
+	uint64_t    reply_count_;
+	uint64_t    timeout_count_;
+	uint64_t    unmatched_count_;
+	std::size_t pending_count_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef NatsWrapper_HAS_COROUTINES
+class NatsRequestAwaitable;
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Multiplexes any number of outstanding requests over one connection.
+
+	A single subscription to \e <inbox>.* receives the replies. Each request
+	is published with a reply subject of \e <inbox>.<token>, where the token
+	is unique to the request, and the reply is matched to the request by
+	that token. A timer thread completes requests for which no reply
+	arrives within their timeout.
+
+	Completion functions are invoked on the NATS delivery thread or the
+	timer thread, without any lock held. They may issue further requests.
+
+	The connection must outlive the multiplexer. Its destructor drains the
+	subscription, so that replies already received are delivered, and waits
+	for the drain to complete; it therefore must not be invoked from a
+	completion function running on the NATS delivery thread. Requests still
+	outstanding after that are completed with \c NATS_CONNECTION_CLOSED.
+*/
+class NatsRequestMux
+{
+public:
+	static constexpr std::chrono::milliseconds DefaultTimeOut{5000};
+
+	explicit NatsRequestMux(NatsConnection &nats_conn,
+		std::chrono::milliseconds default_time_out = DefaultTimeOut);
+
+	virtual ~NatsRequestMux();
+
+	/**
+		Publishes a request and invokes \e done_func when it completes. Throws
+		if the request can't be published, in which case \e done_func is not
+		invoked.
+	*/
+	void AsyncRequest(const char *subject_name, const void *data_ptr,
+		std::size_t data_length, const NatsRequestDoneFunc &done_func,
+		std::chrono::milliseconds time_out = std::chrono::milliseconds::zero());
+	void AsyncRequest(const std::string &subject_name, const void *data_ptr,
+		std::size_t data_length, const NatsRequestDoneFunc &done_func,
+		std::chrono::milliseconds time_out = std::chrono::milliseconds::zero());
+
+	/**
+		Returns a future for the reply. Failures, including a timeout, are
+		delivered as a NatsExceptionStatus from the future.
+	*/
+	std::future<NatsMsg> Request(const char *subject_name,
+		const void *data_ptr, std::size_t data_length,
+		std::chrono::milliseconds time_out = std::chrono::milliseconds::zero());
+	std::future<NatsMsg> Request(const std::string &subject_name,
+		const void *data_ptr, std::size_t data_length,
+		std::chrono::milliseconds time_out = std::chrono::milliseconds::zero());
+
+#ifdef NatsWrapper_HAS_COROUTINES
+	/**
+		Returns an awaitable which publishes the request when awaited and
+		resumes the coroutine with the reply. Failures are thrown as a
+		NatsExceptionStatus from the co_await.
+
+		The subject and data must remain valid until the request is awaited.
+	*/
+	NatsRequestAwaitable AwaitRequest(const char *subject_name,
+		const void *data_ptr, std::size_t data_length,
+		std::chrono::milliseconds time_out = std::chrono::milliseconds::zero());
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+	const std::string   &GetInboxPrefix() const;
+	std::size_t          GetPendingCount() const;
+	NatsRequestMuxStats  GetStats() const;
+
+	/// The NATS callback. The closure is a pointer to the multiplexer.
+	static void NatsMsgHandler(natsConnection *nats_conn_ptr,
+		natsSubscription *nats_subs_ptr, natsMsg *nats_msg_ptr,
+		void *closure_ptr);
+
+private:
+	using Clock     = std::chrono::steady_clock;
+	using Deadline  = std::pair<Clock::time_point, uint64_t>;
+	using TimerHeap = std::priority_queue<Deadline, std::vector<Deadline>,
+		std::greater<Deadline>>;
+
+	NatsConnection                                  &nats_conn_;
+	std::chrono::milliseconds                        default_time_out_;
+	NatsInbox                                        nats_inbox_;
+	std::string                                      inbox_prefix_;
+	mutable std::mutex                               request_mutex_;
+	std::condition_variable                          timer_cv_;
+	std::unordered_map<uint64_t, NatsRequestDoneFunc> pending_map_;
+	TimerHeap                                        timer_heap_;
+	uint64_t                                         next_token_;
+	bool                                             stop_flag_;
+	uint64_t                                         request_count_;
+	uint64_t                                         reply_count_;
+	uint64_t                                         timeout_count_;
+	uint64_t                                         unmatched_count_;
+	std::thread                                      timer_thread_;
+	NatsSubscription                                 nats_subs_;
+
+	void HandleReply(NatsMsg &nats_msg);
+	void TimerThread();
+
+	NatsRequestMux(const NatsRequestMux &) = delete;
+	NatsRequestMux & operator = (const NatsRequestMux &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifdef NatsWrapper_HAS_COROUTINES
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	The result of NatsRequestMux::AwaitRequest(). The request is published
+	from await_suspend(), so that the coroutine is suspended before the
+	reply can resume it.
+*/
+class NatsRequestAwaitable
+{
+public:
+	NatsRequestAwaitable(NatsRequestMux &request_mux, const char *subject_name,
+		const void *data_ptr, std::size_t data_length,
+		std::chrono::milliseconds time_out);
+
+	bool    await_ready() const noexcept;
+	void    await_suspend(std::coroutine_handle<> coro_handle);
+	NatsMsg await_resume();
+
+private:
+	NatsRequestMux            *request_mux_ptr_;
+	const char                *subject_name_;
+	const void                *data_ptr_;
+	std::size_t                data_length_;
+	std::chrono::milliseconds  time_out_;
+	natsStatus                 nats_status_;
+	NatsMsg                    nats_msg_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+#endif // #ifdef NatsWrapper_HAS_COROUTINES
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str,
+	const NatsRequestMuxStats &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsRequestMux_hpp__HH
+
@@ -0,0 +1,149 @@
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// MLB NatsWrapper Library Include File
+// ////////////////////////////////////////////////////////////////////////////
+/*
+   File Name         :  NatsSubject.hpp
+
+   File Description  :  Include file for the NatsSubject class.
+
+   Revision History  :  2026-10-18 --- Creation.
+                           Michael L. Brock
+
+      Copyright Michael L. Brock 2026.
+      Distributed under the Boost Software License, Version 1.0.
+      (See accompanying file LICENSE_1_0.txt or copy at
+      http://www.boost.org/LICENSE_1_0.txt)
+
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+#ifndef HH__MLB__NatsWrapper__NatsSubject_hpp__HH
+
+#define HH__MLB__NatsWrapper__NatsSubject_hpp__HH 1
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+/**
+   \file NatsSubject.hpp
+
+   \brief   Main include file for the NatsSubject class, a subject name which
+            has been validated once so that it may be published upon without
+            further checks.
+*/
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+// ////////////////////////////////////////////////////////////////////////////
+// Required include files...
+// ////////////////////////////////////////////////////////////////////////////
+
+#include <NatsWrapper/NatsWrapper.hpp>
+
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// ////////////////////////////////////////////////////////////////////////////
+
+namespace MLB {
+
+namespace NatsWrapper {
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Returns true if the subject name consists of one or more non-empty tokens
+	separated by periods and contains no whitespace or control characters.
+	If \e wildcard_flag is true, a token may be '*' and the last token may be
+	'>', as in subscription subjects.
+*/
+bool IsValidNatsSubject(const std::string_view &subject_name,
+	bool wildcard_flag = false);
+
+/**
+	Returns true if a message published on \e subject_name is received by a
+	subscription to \e subject_pattern. A '*' token of the pattern matches
+	any one token and a final '>' token matches one or more tokens.
+*/
+bool IsNatsSubjectMatch(const std::string_view &subject_pattern,
+	const std::string_view &subject_name);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	A subject name which is validated when it is constructed. Its length is
+	retained and its text is NUL-terminated, so that it may be passed to the
+	NATS library without any per-message checks.
+*/
+class NatsSubject
+{
+public:
+	explicit NatsSubject(const std::string_view &subject_name,
+		bool wildcard_flag = false);
+	explicit NatsSubject(const std::string &subject_name,
+		bool wildcard_flag = false);
+	explicit NatsSubject(const char *subject_name, bool wildcard_flag = false);
+
+	const char        *GetPtr() const;
+	std::size_t        GetLength() const;
+	std::string_view   GetStringView() const;
+	const std::string &GetString() const;
+	/// True if a token of the subject is a wildcard.
+	bool               HasWildcard() const;
+
+	bool operator == (const NatsSubject &other) const;
+	bool operator != (const NatsSubject &other) const;
+	bool operator <  (const NatsSubject &other) const;
+
+private:
+	std::string subject_name_;
+	bool        has_wildcard_;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/**
+	Interns subject names: each distinct name is validated and stored once,
+	and the reference returned for it remains valid for the life of the
+	pool. Intern() may be invoked concurrently.
+*/
+class NatsSubjectPool
+{
+public:
+	NatsSubjectPool();
+
+	const NatsSubject &Intern(const std::string_view &subject_name);
+	const NatsSubject *Find(const std::string_view &subject_name) const;
+	std::size_t        GetCount() const;
+
+private:
+	using SubjectMap = std::unordered_map<std::string_view,
+		std::unique_ptr<NatsSubject>>;
+
+	mutable std::mutex subject_mutex_;
+	SubjectMap         subject_map_;
+
+	NatsSubjectPool(const NatsSubjectPool &) = delete;
+	NatsSubjectPool & operator = (const NatsSubjectPool &) = delete;
+};
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+/// Throws std::invalid_argument if a token of the subject is a wildcard.
+const NatsSubject &ThrowIfWildcard(const NatsSubject &subject,
+	const char *name_string);
+// ////////////////////////////////////////////////////////////////////////////
+
+// ////////////////////////////////////////////////////////////////////////////
+std::ostream & operator << (std::ostream &o_str, const NatsSubject &datum);
+// ////////////////////////////////////////////////////////////////////////////
+
+} // namespace NatsWrapper
+
+} // namespace MLB
+
+#endif // #ifndef HH__MLB__NatsWrapper__NatsSubject_hpp__HH
+
@@ -40,6 +40,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 // ////////////////////////////////////////////////////////////////////////////
 
@@ -80,7 +81,30 @@ public:
 	/// Returns a hollow NatMsg upon timeout.
 	NatsMsg NextMsg(int64_t time_out);
 
+	/**
+		Waits up to \e time_out milliseconds for a message and then takes any
+		further messages already pending, up to \e max_count in all. The
+		messages are moved into \e msg_array and their number is stored in
+		\e msg_count.
+
+		Errors are returned rather than thrown: \c NATS_TIMEOUT indicates that
+		no message arrived in time. If an error occurs after some messages
+		have been taken, \c NATS_OK is returned with those messages and the
+		error is reported by the next call.
+	*/
+	natsStatus NextMsgs(NatsMsg *msg_array, std::size_t max_count,
+		int64_t time_out, std::size_t &msg_count);
+	/// Appends the messages to \e msg_list.
+	natsStatus NextMsgs(std::vector<NatsMsg> &msg_list, std::size_t max_count,
+		int64_t time_out);
+
 	void Unsubscribe();
+	/**
+		Unsubscribes once the messages already received have been delivered
+		and waits up to \e time_out milliseconds (or, if it is zero, without
+		limit) for that to complete. Errors are returned rather than thrown.
+	*/
+	natsStatus Drain(int64_t time_out = 0);
 
 protected:
 	virtual void NatsMsgHandler(natsConnection *nats_conn_ptr,
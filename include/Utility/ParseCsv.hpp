@@ -63,6 +63,16 @@ public:
 		return(in_char == '\n');
 	}
 
+	inline bool IsQuoteChar(char in_char) const
+	{
+		return((in_char == '"') || (in_char == '\''));
+	}
+
+	inline bool IsCrLfEnabled() const
+	{
+		return(enable_crlf_);
+	}
+
 	inline bool IsValueSep(char in_char) const
 	{
 		return(value_sep_list_.find_first_of(in_char, 0) != std::string::npos);